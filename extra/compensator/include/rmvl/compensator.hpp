@@ -22,6 +22,7 @@
 #include <rmvl/rmvl_modules.hpp>
 
 #include "compensator/compensator.h"
+#include "compensator/shooting.h"
 
 #ifdef HAVE_RMVL_GRAVITY_COMPENSATOR
 #include "compensator/gravity_compensator.h"
@@ -11,10 +11,13 @@
 
 #pragma once
 
-#include <unordered_map>
+#include <functional>
 
+#include "rmvl/algorithm/math.hpp"
 #include "rmvl/group/group.h"
 
+#include "shooting.h"
+
 namespace rm
 {
 
@@ -33,13 +36,27 @@ struct CompensateInfo
      * @note 记载每一个追踪器对应的补偿值，`x` 表示水平方向补偿增量，`y`
      *       表示垂直方向补偿增量
      */
-    std::unordered_map<tracker::ptr, cv::Point2f> compensation;
+    TrackerMap<tracker::ptr, cv::Point2f> compensation;
 
     /**
      * @brief 飞行时间 (Time of Flying)
      * @note 记载每一个追踪器对应的飞行时间，表示弹丸击中目标所需要的子弹飞行时间
      */
-    std::unordered_map<tracker::ptr, double> tof;
+    TrackerMap<tracker::ptr, double> tof;
+};
+
+/**
+ * @brief 联合瞄准信息
+ * @note
+ * - 作为预测与弹道联合解算接口的返回值，仅对决策选中的目标追踪器求解
+ */
+struct AimInfo
+{
+    cv::Point2f compensation; //!< 命中时刻预测位置对应的补偿增量，含义与 `CompensateInfo::compensation` 相同
+    cv::Vec3f position;       //!< 命中时刻目标在陀螺仪坐标系下的预测位置，单位 `mm`
+    double tof{};             //!< 子弹飞行时间，与预测位置自洽
+    unsigned iter{};          //!< 不动点迭代次数
+    bool converged{};         //!< 是否收敛
 };
 
 //! 弹道下坠补偿模块
@@ -60,6 +77,41 @@ public:
      * @return 补偿模块信息
      */
     virtual CompensateInfo compensate(const std::vector<group::ptr> &groups, float shoot_speed, CompensateType com_flag) = 0;
+
+    /**
+     * @brief 仅根据手动调节补偿标志更新静态补偿，不进行补偿计算
+     * @note 默认实现以空的序列组调用 `compensate`，派生类可重写以直接更新静态补偿
+     *
+     * @param[in] com_flag 手动调节补偿标志
+     */
+    virtual void updateStatic(CompensateType com_flag) { compensate({}, 0.f, com_flag); }
+
+    /**
+     * @brief 预测与弹道的联合解算，迭代预测位置与飞行时间直至自洽，一般仅对决策选中的目标调用
+     * @note
+     * - `compensate` 以目标的当前位置计算飞行时间，而子弹实际需要命中的是飞行时间结束时的预测位置，两者距离不同时补偿与预测不一致
+     * @note
+     * - 默认实现使用真空抛物线弹道模型 `rm::VacuumBulletModel`，不含静态补偿，派生类可重写以使用自身的弹道模型
+     *
+     * @param[in] motion 目标运动模型，返回子弹飞行 `t` 秒后目标在陀螺仪坐标系下的位置，单位 `mm`
+     * @param[in] shoot_speed 子弹射速 (m/s)
+     * @return 联合瞄准信息
+     */
+    virtual AimInfo aim(const std::function<cv::Vec3f(double)> &motion, float shoot_speed)
+    {
+        AimInfo info{};
+        VacuumBulletModel model{};
+        auto ballistic = [&](double x, double y) { return shoot(model, x, y, static_cast<double>(shoot_speed)); };
+        // 陀螺仪坐标系的 y 轴竖直向下
+        auto target = [&](double t) {
+            info.position = motion(t);
+            return std::make_pair(std::hypot(info.position(0), info.position(2)) / 1000., -info.position(1) / 1000.);
+        };
+        auto res = rm::aim(ballistic, target);
+        info.compensation = {0.f, static_cast<float>(rad2deg(std::atan2(res.y, res.x) - res.pitch))};
+        info.tof = res.tof, info.iter = res.iter, info.converged = res.converged;
+        return info;
+    }
 };
 
 //! @} compensator
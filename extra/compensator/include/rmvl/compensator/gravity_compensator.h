@@ -31,6 +31,10 @@ public:
 
     /**
      * @brief 补偿函数，考虑空气阻力，使用 2 阶龙格库塔方法（中点公式）计算弹道
+     * @note
+     * - 参数 `USE_TABLE` 开启时，构造时预计算弹道表（可缓存至 `TABLE_CACHE` 指定的文件），补偿时直接查表插值，
+     *   在默认网格下补偿角度误差不超过 `0.07°`，飞行时间误差不超过 `2 ms`
+     * - 超出弹道表范围或目标不可达时，对所有此类目标使用带保护的牛顿打靶法批量求解，弹道灵敏度与弹道方程一同积分
      *
      * @param[in] groups 所有序列组
      * @param[in] shoot_speed 子弹射速 (m/s)
@@ -39,6 +43,22 @@ public:
      */
     CompensateInfo compensate(const std::vector<group::ptr> &groups, float shoot_speed, CompensateType com_flag) override;
 
+    /**
+     * @brief 仅根据手动调节补偿标志更新静态补偿
+     *
+     * @param[in] com_flag 手动调节补偿标志
+     */
+    void updateStatic(CompensateType com_flag) override;
+
+    /**
+     * @brief 预测与弹道的联合解算，每次迭代优先查询弹道表，查询失败时以上一次迭代的补偿角度热启动打靶法
+     *
+     * @param[in] motion 目标运动模型，返回子弹飞行 `t` 秒后目标在陀螺仪坐标系下的位置，单位 `mm`
+     * @param[in] shoot_speed 子弹射速 (m/s)
+     * @return 联合瞄准信息
+     */
+    AimInfo aim(const std::function<cv::Vec3f(double)> &motion, float shoot_speed) override;
+
 private:
     class Impl;
     Impl *_impl;
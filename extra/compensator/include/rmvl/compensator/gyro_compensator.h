@@ -24,6 +24,7 @@ class GyroCompensator final : public compensator
 {
     float _yaw_static_com;   //!< yaw 轴静态补偿，方向与 yaw 一致
     float _pitch_static_com; //!< pitch 轴静态补偿，方向与 pitch 一致
+    double _aim_tof{};       //!< 上一次联合解算的子弹飞行时间，作为下一次解算的初值
 
 public:
     //! 创建 GyroCompensator 对象
@@ -33,7 +34,7 @@ public:
     static inline auto make_compensator() { return std::make_unique<GyroCompensator>(); }
 
     /**
-     * @brief 补偿函数，未考虑空气阻力，仅使用抛物线模型 \cite icra2019
+     * @brief 补偿函数，未考虑空气阻力，仅使用抛物线模型 \cite icra2019 ，使用带保护的牛顿打靶法批量求解所有序列组的补偿角度
      *
      * @param[in] groups 所有序列组
      * @param[in] shoot_speed 子弹射速 (m/s)
@@ -41,6 +42,22 @@ public:
      * @return 补偿模块信息
      */
     CompensateInfo compensate(const std::vector<group::ptr> &groups, float shoot_speed, CompensateType com_flag) override;
+
+    /**
+     * @brief 仅根据手动调节补偿标志更新静态补偿
+     *
+     * @param[in] com_flag 手动调节补偿标志
+     */
+    void updateStatic(CompensateType com_flag) override;
+
+    /**
+     * @brief 预测与弹道的联合解算，弹道使用抛物线模型，每次迭代以上一次迭代的补偿角度热启动打靶法
+     *
+     * @param[in] motion 目标运动模型，返回子弹飞行 `t` 秒后目标在陀螺仪坐标系下的位置，单位 `mm`
+     * @param[in] shoot_speed 子弹射速 (m/s)
+     * @return 联合瞄准信息
+     */
+    AimInfo aim(const std::function<cv::Vec3f(double)> &motion, float shoot_speed) override;
 };
 
 //! @} compensator
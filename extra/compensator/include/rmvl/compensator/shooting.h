@@ -0,0 +1,239 @@
+/**
+ * @file shooting.h
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 弹道解算的打靶法求解器
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace rm
+{
+
+//! @addtogroup compensator
+//! @{
+
+//! 打靶法弹道解算结果
+struct ShootingResult
+{
+    double pitch{};   //!< 补偿角度，向上为正，单位 `rad`
+    double tof{};     //!< 子弹飞行时间，单位 `s`
+    unsigned iter{};  //!< 弹道模型的调用次数
+    bool converged{}; //!< 落点高度误差是否收敛至容许误差以内
+};
+
+/**
+ * @brief 真空中的抛物线弹道模型，弹道灵敏度使用解析解
+ * @brief
+ * 飞行时间与落点高度分别为 \f[t=\frac x{v\cos\theta},\quad y=x\tan\theta-\frac{gx^2}{2v^2\cos^2\theta}\f]
+ * 对发射角度的灵敏度为 \f[\frac{\partial y}{\partial\theta}=\frac x{\cos^2\theta}\left(1-\frac{gx\tan\theta}{v^2}\right)\f]
+ */
+struct VacuumBulletModel
+{
+    double g{9.788}; //!< 重力加速度，单位 `m/s^2`
+
+    /**
+     * @brief 计算弹丸飞行至水平距离 `x` 时的落点高度、灵敏度以及飞行时间
+     *
+     * @param[in] x 目标离枪口的水平距离，单位 `m`
+     * @param[in] v 枪口射速，单位 `m/s`
+     * @param[in] angle 发射角度，向上为正，单位 `rad`
+     * @return 落点高度 \f$y\f$、灵敏度 \f$\partial y/\partial\theta\f$ 以及飞行时间 \f$t\f$ 的三元组
+     */
+    inline std::tuple<double, double, double> operator()(double x, double v, double angle) const
+    {
+        double c = std::cos(angle), tn = std::tan(angle);
+        double sec2 = 1 / (c * c);
+        double k = g * x / (v * v);
+        return {x * tn - 0.5 * k * x * sec2, x * sec2 * (1 - k * tn), x / (v * c)};
+    }
+};
+
+/**
+ * @brief 带保护的牛顿打靶法迭代的状态
+ * @note 在 \f$[\theta_{lo},\theta_{hi}]\f$ 内维护一个包含解的区间，牛顿步越界、灵敏度非正或弹道不可达时退化为二分
+ */
+class ShootingIteration
+{
+public:
+    /**
+     * @brief 以视线角作为初值开始迭代
+     *
+     * @param[in] x 目标离枪口的水平距离，单位 `m`
+     * @param[in] y 目标离枪口的铅垂高度，单位 `m`
+     */
+    ShootingIteration(double x, double y) : _y(y), _angle(std::atan2(y, x)) {}
+
+    /**
+     * @brief 使用指定的发射角度替换初值，一般用于以相邻问题的解热启动
+     *
+     * @param[in] angle 初始发射角度，单位 `rad`，为 `NaN` 或越界时保持视线角
+     */
+    inline void seed(double angle)
+    {
+        if (angle > _lo && angle < _hi)
+            _angle = angle;
+    }
+
+    //! 当前的发射角度
+    inline double angle() const { return _angle; }
+
+    /**
+     * @brief 使用当前发射角度下的弹道结果更新发射角度
+     *
+     * @param[in] y 当前发射角度下的落点高度，弹道不可达时为 `NaN`
+     * @param[in] dy 当前发射角度下的灵敏度 \f$\partial y/\partial\theta\f$
+     * @param[in] tol 落点高度的容许误差，单位 `m`
+     * @return 是否已收敛
+     */
+    inline bool update(double y, double dy, double tol)
+    {
+        double f = y - _y;
+        if (std::abs(f) < tol)
+            return true;
+        // 弹道不可达或高于目标时收缩上界，否则收缩下界
+        !(f < 0) ? (_hi = _angle) : (_lo = _angle);
+        double next = _angle - f / dy;
+        if (!(dy > 0) || !(next > _lo && next < _hi))
+            next = 0.5 * (_lo + _hi);
+        _angle = next;
+        return false;
+    }
+
+private:
+    double _y;        //!< 目标高度
+    double _angle;    //!< 当前发射角度
+    double _lo{-1.5}; //!< 发射角度下界，单位 `rad`
+    double _hi{1.5};  //!< 发射角度上界，单位 `rad`
+};
+
+/**
+ * @brief 打靶法求解补偿角度及子弹飞行时间
+ *
+ * @tparam BulletModel 弹道模型，可调用对象，签名为 `std::tuple<double, double, double>(double x, double v, double angle)`，
+ *                     返回落点高度、灵敏度以及飞行时间，弹道不可达时落点高度为 `NaN`
+ * @param[in] model 弹道模型
+ * @param[in] x 目标离枪口的水平距离，单位 `m`
+ * @param[in] y 目标离枪口的铅垂高度，单位 `m`
+ * @param[in] v 枪口射速，单位 `m/s`
+ * @param[in] tol 落点高度的容许误差，单位 `m`
+ * @param[in] max_iter 最大迭代次数
+ * @param[in] init 初始发射角度，单位 `rad`，为 `NaN` 时以视线角作为初值
+ * @return 弹道解算结果
+ */
+template <typename BulletModel>
+ShootingResult shoot(BulletModel &&model, double x, double y, double v, double tol = 1e-3, unsigned max_iter = 20,
+                     double init = std::numeric_limits<double>::quiet_NaN())
+{
+    ShootingResult res{};
+    ShootingIteration it(x, y);
+    it.seed(init);
+    while (res.iter < max_iter)
+    {
+        res.pitch = it.angle();
+        auto [cur_y, cur_dy, cur_t] = model(x, v, res.pitch);
+        res.tof = cur_t, ++res.iter;
+        if (it.update(cur_y, cur_dy, tol))
+            return res.converged = true, res;
+    }
+    return res;
+}
+
+/**
+ * @brief 打靶法批量求解补偿角度及子弹飞行时间，所有目标按迭代步同步推进，已收敛的目标不再调用弹道模型
+ *
+ * @tparam BulletModel 弹道模型，参见 `rm::shoot`
+ * @param[in] model 弹道模型
+ * @param[in] xs 所有目标离枪口的水平距离，单位 `m`
+ * @param[in] ys 所有目标离枪口的铅垂高度，单位 `m`
+ * @param[in] v 枪口射速，单位 `m/s`
+ * @param[in] tol 落点高度的容许误差，单位 `m`
+ * @param[in] max_iter 最大迭代次数
+ * @return 与目标一一对应的弹道解算结果
+ */
+template <typename BulletModel>
+std::vector<ShootingResult> shoot(BulletModel &&model, const std::vector<double> &xs, const std::vector<double> &ys,
+                                  double v, double tol = 1e-3, unsigned max_iter = 20)
+{
+    const std::size_t n = xs.size();
+    std::vector<ShootingResult> res(n);
+    std::vector<ShootingIteration> its;
+    its.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+        its.emplace_back(xs[i], ys[i]);
+    std::size_t active = n;
+    for (unsigned k = 0; k < max_iter && active > 0; ++k)
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (res[i].converged)
+                continue;
+            res[i].pitch = its[i].angle();
+            auto [cur_y, cur_dy, cur_t] = model(xs[i], v, res[i].pitch);
+            res[i].tof = cur_t, ++res[i].iter;
+            if (its[i].update(cur_y, cur_dy, tol))
+                res[i].converged = true, --active;
+        }
+    return res;
+}
+
+//! 预测与弹道联合解算结果
+struct AimResult
+{
+    double pitch{};   //!< 补偿角度，向上为正，单位 `rad`
+    double tof{};     //!< 子弹飞行时间，单位 `s`
+    double x{};       //!< 命中时刻目标离枪口的水平距离，单位 `m`
+    double y{};       //!< 命中时刻目标离枪口的铅垂高度，单位 `m`
+    unsigned iter{};  //!< 不动点迭代次数，即弹道解算的次数
+    bool converged{}; //!< 飞行时间是否收敛至容许误差以内
+};
+
+/**
+ * @brief 预测与弹道的联合解算，对目标在 \f$t\f$ 时刻的预测位置求解飞行时间 \f$T(t)\f$，迭代 \f$t_{k+1}=T(t_k)\f$
+ *        直至飞行时间自洽，即子弹恰好在飞行时间结束时命中预测位置
+ * @note
+ * - 迭代的收缩因子约为目标径向速度与弹速之比，一般 2 ~ 4 次即可收敛
+ * - 每次迭代仅调用一次弹道解算，弹道解算可查表，或以上一次迭代的补偿角度热启动打靶法，无需从视线角重新开始
+ *
+ * @tparam Ballistic 弹道解算，可调用对象，签名为 `rm::ShootingResult(double x, double y)`
+ * @tparam Motion 目标运动模型，可调用对象，签名为 `std::pair<double, double>(double t)`，返回 `t` 秒后目标离枪口的水平距离与铅垂高度
+ * @param[in] ballistic 弹道解算
+ * @param[in] motion 目标运动模型
+ * @param[in] t0 飞行时间的初值，单位 `s`，一般使用上一帧的解
+ * @param[in] tol 飞行时间的容许误差，单位 `s`
+ * @param[in] max_iter 最大迭代次数
+ * @return 联合解算结果
+ */
+template <typename Ballistic, typename Motion>
+AimResult aim(Ballistic &&ballistic, Motion &&motion, double t0 = 0, double tol = 1e-4, unsigned max_iter = 10)
+{
+    AimResult res{};
+    res.tof = t0;
+    while (res.iter < max_iter)
+    {
+        double t = res.tof;
+        std::tie(res.x, res.y) = motion(t);
+        auto shot = ballistic(res.x, res.y);
+        ++res.iter;
+        if (!shot.converged)
+            return res;
+        res.pitch = shot.pitch, res.tof = shot.tof;
+        if (std::abs(res.tof - t) < tol)
+            return res.converged = true, res;
+    }
+    return res;
+}
+
+//! @} compensator
+
+} // namespace rm
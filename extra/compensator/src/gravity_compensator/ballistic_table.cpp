@@ -0,0 +1,220 @@
+/**
+ * @file ballistic_table.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 预计算弹道表
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <thread>
+
+#include "rmvl/algorithm/math.hpp"
+#include "rmvl/core/util.hpp"
+
+#include "ballistic_table.h"
+
+namespace rm
+{
+
+static constexpr double ANGLE_MIN = -60 * PI / 180;   //!< 发射角度下限
+static constexpr double ANGLE_MAX = 60 * PI / 180;    //!< 发射角度上限
+static constexpr double ANGLE_STEP = 0.25 * PI / 180; //!< 发射角度步长
+static constexpr std::uint32_t TABLE_MAGIC = 0x54424d52; //!< 缓存文件标识 "RMBT"
+
+std::size_t BallisticTable::Axis::size() const { return static_cast<std::size_t>(std::round((max - min) / step)) + 1; }
+
+/**
+ * @brief 构建单一射速下的弹道表切片
+ *
+ * @param[in] rk 龙格库塔求解器
+ * @param[in] h 龙格库塔迭代步长
+ * @param[in] v 枪口射速
+ * @param[in] xs 水平距离坐标轴
+ * @param[in] ys 铅垂高度坐标轴
+ * @param[out] slice 表格切片，按照 `[x][y][补偿角度增量, 飞行时间]` 排列
+ */
+static void buildSlice(RungeKutta2 &rk, double h, double v, const BallisticTable::Axis &xs,
+                       const BallisticTable::Axis &ys, float *slice)
+{
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::size_t nx = xs.size(), ny = ys.size();
+    const std::size_t na = static_cast<std::size_t>(std::round((ANGLE_MAX - ANGLE_MIN) / ANGLE_STEP)) + 1;
+    // 每条弹道在各水平距离网格处的落点高度与飞行时间，按照 [x][angle] 排列
+    std::vector<double> hy(nx * na, nan), ht(nx * na, nan);
+    for (std::size_t k = 0; k < na; ++k)
+    {
+        double angle = ANGLE_MIN + k * ANGLE_STEP;
+        double c = std::cos(angle), s = std::sin(angle);
+        // 与弹道模型相同的初值和步长，并额外延长积分时间以覆盖最远的网格
+        rk.init(0, {0, v * c, 0, v * s});
+        auto res = rk.solve(h, static_cast<std::size_t>(std::ceil(xs.max / (v * c) * 1.5 / h)));
+        std::size_t p{};
+        for (std::size_t i = 0; i < nx; ++i)
+        {
+            double x = xs.min + i * xs.step;
+            while (p + 1 < res.size() && res[p + 1][0] < x)
+                ++p;
+            if (p + 1 >= res.size())
+                break;
+            double r = (x - res[p][0]) / (res[p + 1][0] - res[p][0]);
+            hy[i * na + k] = res[p][2] + (res[p + 1][2] - res[p][2]) * r;
+            ht[i * na + k] = (p + r) * h;
+        }
+    }
+    // 在低弹道分支上按照落点高度反解补偿角度
+    for (std::size_t i = 0; i < nx; ++i)
+    {
+        double x = xs.min + i * xs.step;
+        const double *py = hy.data() + i * na, *pt = ht.data() + i * na;
+        std::size_t end{};
+        while (end + 1 < na && py[end + 1] > py[end])
+            ++end;
+        for (std::size_t j = 0; j < ny; ++j)
+        {
+            double y = ys.min + j * ys.step;
+            float *cell = slice + (i * ny + j) * 2;
+            if (std::isnan(py[0]) || end == 0 || y < py[0] || y > py[end])
+            {
+                cell[0] = cell[1] = std::numeric_limits<float>::quiet_NaN();
+                continue;
+            }
+            std::size_t k = std::upper_bound(py, py + end + 1, y) - py;
+            k = std::clamp<std::size_t>(k, 1, end) - 1;
+            double r = (y - py[k]) / (py[k + 1] - py[k]);
+            double angle = ANGLE_MIN + (k + r) * ANGLE_STEP;
+            cell[0] = static_cast<float>(angle - std::atan2(y, x));
+            cell[1] = static_cast<float>(pt[k] + (pt[k + 1] - pt[k]) * r);
+        }
+    }
+}
+
+void BallisticTable::build(const Odes &fs, double h, const Axis &xs, const Axis &ys, const Axis &vs)
+{
+    if (xs.step <= 0 || ys.step <= 0 || vs.step <= 0 || xs.size() < 2 || ys.size() < 2 || vs.size() < 4)
+        RMVL_Error(RMVL_StsBadArg, "The ballistic table requires at least 2 grid points on the distance and height axes, and 4 on the speed axis");
+    if (xs.min <= 0 || vs.min <= 0)
+        RMVL_Error(RMVL_StsBadArg, "The distance and the speed of the ballistic table must be positive");
+    _xs = xs, _ys = ys, _vs = vs;
+    const std::size_t nv = vs.size(), slice_size = xs.size() * ys.size() * 2;
+    _data.assign(nv * slice_size, 0.f);
+    // 各射速切片互相独立，按射速分配给多个线程
+    std::atomic_size_t next{};
+    auto worker = [&]() {
+        RungeKutta2 rk(fs);
+        for (std::size_t iv = next++; iv < nv; iv = next++)
+            buildSlice(rk, h, vs.min + iv * vs.step, xs, ys, _data.data() + iv * slice_size);
+    };
+    std::size_t nthreads = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, nv);
+    std::vector<std::thread> threads;
+    threads.reserve(nthreads - 1);
+    for (std::size_t t = 1; t < nthreads; ++t)
+        threads.emplace_back(worker);
+    worker();
+    for (auto &t : threads)
+        t.join();
+}
+
+bool BallisticTable::load(const std::string &path, const std::vector<double> &key)
+{
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs.is_open())
+        return false;
+    std::uint32_t magic{};
+    std::uint64_t key_size{};
+    ifs.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+    ifs.read(reinterpret_cast<char *>(&key_size), sizeof(key_size));
+    if (!ifs || magic != TABLE_MAGIC || key_size != key.size())
+        return false;
+    std::vector<double> file_key(key_size);
+    ifs.read(reinterpret_cast<char *>(file_key.data()), key_size * sizeof(double));
+    if (!ifs || file_key != key)
+        return false;
+    Axis axes[3];
+    ifs.read(reinterpret_cast<char *>(axes), sizeof(axes));
+    if (!ifs)
+        return false;
+    std::vector<float> data(axes[0].size() * axes[1].size() * axes[2].size() * 2);
+    ifs.read(reinterpret_cast<char *>(data.data()), data.size() * sizeof(float));
+    if (!ifs)
+        return false;
+    _xs = axes[0], _ys = axes[1], _vs = axes[2];
+    _data = std::move(data);
+    return true;
+}
+
+bool BallisticTable::save(const std::string &path, const std::vector<double> &key) const
+{
+    std::ofstream ofs(path, std::ios::binary);
+    if (!ofs.is_open())
+        return false;
+    std::uint64_t key_size = key.size();
+    Axis axes[3] = {_xs, _ys, _vs};
+    ofs.write(reinterpret_cast<const char *>(&TABLE_MAGIC), sizeof(TABLE_MAGIC));
+    ofs.write(reinterpret_cast<const char *>(&key_size), sizeof(key_size));
+    ofs.write(reinterpret_cast<const char *>(key.data()), key_size * sizeof(double));
+    ofs.write(reinterpret_cast<const char *>(axes), sizeof(axes));
+    ofs.write(reinterpret_cast<const char *>(_data.data()), _data.size() * sizeof(float));
+    return static_cast<bool>(ofs);
+}
+
+bool BallisticTable::query(double x, double y, double v, double &pitch, double &tof) const
+{
+    if (_data.empty())
+        return false;
+    const std::size_t nx = _xs.size(), ny = _ys.size(), nv = _vs.size();
+    double fx = (x - _xs.min) / _xs.step, fy = (y - _ys.min) / _ys.step, fv = (v - _vs.min) / _vs.step;
+    // 取反的比较可同时排除 NaN
+    if (!(fx >= 0 && fx <= nx - 1 && fy >= 0 && fy <= ny - 1 && fv >= 0 && fv <= nv - 1))
+        return false;
+    std::size_t ix = std::min(static_cast<std::size_t>(fx), nx - 2);
+    std::size_t iy = std::min(static_cast<std::size_t>(fy), ny - 2);
+    std::size_t iv = std::min(static_cast<std::size_t>(fv), nv - 2);
+    double ax = fx - ix, ay = fy - iy, av = fv - iv;
+    // 射速方向使用 Catmull-Rom 三次插值，权重分别作用于 iv - 1、iv、iv + 1、iv + 2 四个切片，边界外的切片由二次外推代替
+    double wv[4] = {((2 - av) * av - 1) * av * 0.5, ((3 * av - 5) * av * av + 2) * 0.5,
+                    ((4 - 3 * av) * av + 1) * av * 0.5, (av - 1) * av * av * 0.5};
+    if (iv == 0)
+        wv[1] += 3 * wv[0], wv[2] -= 3 * wv[0], wv[3] += wv[0], wv[0] = 0;
+    if (iv + 2 == nv)
+        wv[2] += 3 * wv[3], wv[1] -= 3 * wv[3], wv[0] += wv[3], wv[3] = 0;
+    const std::size_t sx = ny * 2, sv = nx * sx;
+    const float *base = _data.data() + ix * sx + iy * 2;
+    // 在射速方向插值后，在 (x, y) 平面上双线性插值，不可达处的 NaN 会传播至结果
+    double corner[4][2]{};
+    for (int k = 0; k < 4; ++k)
+    {
+        if (wv[k] == 0)
+            continue;
+        const float *p = base + (iv + k - 1) * sv;
+        for (int c = 0; c < 2; ++c)
+        {
+            corner[0][c] += wv[k] * p[c];
+            corner[1][c] += wv[k] * p[2 + c];
+            corner[2][c] += wv[k] * p[sx + c];
+            corner[3][c] += wv[k] * p[sx + 2 + c];
+        }
+    }
+    double res[2];
+    for (int c = 0; c < 2; ++c)
+    {
+        double c0 = corner[0][c] + (corner[1][c] - corner[0][c]) * ay;
+        double c1 = corner[2][c] + (corner[3][c] - corner[2][c]) * ay;
+        res[c] = c0 + (c1 - c0) * ax;
+    }
+    if (std::isnan(res[0]) || std::isnan(res[1]))
+        return false;
+    pitch = res[0] + std::atan2(y, x);
+    tof = res[1];
+    return true;
+}
+
+} // namespace rm
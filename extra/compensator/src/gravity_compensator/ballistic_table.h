@@ -0,0 +1,97 @@
+/**
+ * @file ballistic_table.h
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 预计算弹道表
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "rmvl/algorithm/numcal.hpp"
+
+namespace rm
+{
+
+/**
+ * @brief 预计算弹道表，记录（水平距离、铅垂高度、枪口射速）到（补偿角度、子弹飞行时间）的映射
+ * @note
+ * - 对每个射速，以固定的角度步长发射一系列弹道，在弹道上截取每个水平距离网格处的落点高度和飞行时间，
+ *   再按落点高度单调的低弹道分支反解出每个高度网格对应的补偿角度
+ * - 表中存储补偿角度相对于视线角 \f$\mathrm{atan2}(y,x)\f$ 的增量，该增量随距离、高度变化平缓，插值误差较小
+ * - 查询时在 \f$(x,y)\f$ 平面上双线性插值，在射速方向上使用 Catmull-Rom 三次插值；超出范围或落在不可达区域时查询失败
+ */
+class BallisticTable
+{
+public:
+    //! 等间距网格坐标轴
+    struct Axis
+    {
+        double min{};  //!< 最小值
+        double max{};  //!< 最大值
+        double step{}; //!< 步长
+
+        //! 网格点数
+        std::size_t size() const;
+    };
+
+    /**
+     * @brief 多线程构建弹道表
+     *
+     * @param[in] fs 弹道模型的常微分方程组，状态量为 \f$[x,v_x,y,v_y]^T\f$
+     * @param[in] h 龙格库塔迭代步长
+     * @param[in] xs 水平距离坐标轴，单位 `m`
+     * @param[in] ys 铅垂高度坐标轴，单位 `m`
+     * @param[in] vs 枪口射速坐标轴，单位 `m/s`
+     */
+    void build(const Odes &fs, double h, const Axis &xs, const Axis &ys, const Axis &vs);
+
+    /**
+     * @brief 从磁盘缓存中加载弹道表
+     *
+     * @param[in] path 缓存文件路径
+     * @param[in] key 缓存键，一般为弹道模型参数以及网格参数，与文件中的记录逐项相等时才会加载
+     * @return 是否加载成功
+     */
+    bool load(const std::string &path, const std::vector<double> &key);
+
+    /**
+     * @brief 将弹道表保存至磁盘缓存
+     *
+     * @param[in] path 缓存文件路径
+     * @param[in] key 缓存键
+     * @return 是否保存成功
+     */
+    bool save(const std::string &path, const std::vector<double> &key) const;
+
+    /**
+     * @brief 查询补偿角度以及子弹飞行时间
+     *
+     * @param[in] x 目标离枪口的水平距离，单位 `m`
+     * @param[in] y 目标离枪口的铅垂高度，单位 `m`
+     * @param[in] v 枪口射速，单位 `m/s`
+     * @param[out] pitch 补偿角度，向上为正，单位 `rad`
+     * @param[out] tof 子弹飞行时间，单位 `s`
+     * @return 是否查询成功
+     */
+    bool query(double x, double y, double v, double &pitch, double &tof) const;
+
+    //! 弹道表是否为空
+    inline bool empty() const { return _data.empty(); }
+
+private:
+    Axis _xs; //!< 水平距离坐标轴
+    Axis _ys; //!< 铅垂高度坐标轴
+    Axis _vs; //!< 枪口射速坐标轴
+
+    //! 按照 `[v][x][y][补偿角度增量, 飞行时间]` 排列的表格数据，不可达处为 `NaN`
+    std::vector<float> _data;
+};
+
+} // namespace rm
@@ -9,6 +9,9 @@
  *
  */
 
+#include <algorithm>
+#include <limits>
+
 #include "rmvlpara/compensator/gravity_compensator.h"
 
 #include "gravity_impl.h"
@@ -25,6 +28,13 @@ CompensateInfo GravityCompensator::compensate(const std::vector<group::ptr> &gro
     return _impl->compensate(groups, shoot_speed, com_flag);
 }
 
+void GravityCompensator::updateStatic(CompensateType com_flag) { _impl->updateStatic(com_flag); }
+
+AimInfo GravityCompensator::aim(const std::function<cv::Vec3f(double)> &motion, float shoot_speed)
+{
+    return _impl->aim(motion, shoot_speed);
+}
+
 GravityCompensator::Impl::Impl() : _yaw_static_com(para::gravity_compensator_param.PITCH_COMPENSATE),
                                    _pitch_static_com(para::gravity_compensator_param.YAW_COMPENSATE)
 {
@@ -40,6 +50,24 @@ GravityCompensator::Impl::Impl() : _yaw_static_com(para::gravity_compensator_par
     fs[2] = [](double, const std::vector<double> &x) { return x[3]; };
     fs[3] = [=](double, const std::vector<double> &x) { return a42 * x[1] + a44 * x[3] - gravity_compensator_param.g; };
     _rk = std::make_unique<RungeKutta2>(fs);
+    _rk_sens = SensitivityIntegrator({a22, a24, a42, a44, gravity_compensator_param.g});
+    if (gravity_compensator_param.USE_TABLE)
+        initTable(fs);
+}
+
+void GravityCompensator::Impl::initTable(const Odes &fs)
+{
+    const auto &param = para::gravity_compensator_param;
+    BallisticTable::Axis xs{param.TABLE_X_MIN, param.TABLE_X_MAX, param.TABLE_X_STEP};
+    BallisticTable::Axis ys{param.TABLE_Y_MIN, param.TABLE_Y_MAX, param.TABLE_Y_STEP};
+    BallisticTable::Axis vs{param.TABLE_V_MIN, param.TABLE_V_MAX, param.TABLE_V_STEP};
+    std::vector<double> key{param.g, param.m, param.rho, param.A, param.V, param.Cd, param.Cl, param.h,
+                            xs.min, xs.max, xs.step, ys.min, ys.max, ys.step, vs.min, vs.max, vs.step};
+    if (!param.TABLE_CACHE.empty() && _table.load(param.TABLE_CACHE, key))
+        return;
+    _table.build(fs, param.h, xs, ys, vs);
+    if (!param.TABLE_CACHE.empty())
+        _table.save(param.TABLE_CACHE, key);
 }
 
 std::pair<double, double> GravityCompensator::Impl::bulletModel(double x, double v, double angle)
@@ -48,7 +76,7 @@ std::pair<double, double> GravityCompensator::Impl::bulletModel(double x, double
     double t_pre{x / (v * cos(angle)) * 1.15};
     // 使用 RK2 方法计算较长一段时间的弹道轨迹
     _rk->init(0, {0, v * cos(angle), 0, v * sin(angle)});
-    auto res = _rk->solve(para::gravity_compensator_param.h, static_cast<size_t>(std::floor(t_pre / para::gravity_compensator_param.h)));
+    auto res = _rk->solve(para::gravity_compensator_param.h, static_cast<size_t>(std::ceil(t_pre / para::gravity_compensator_param.h)) + 1);
     // 在计算出的结果中根据 res[0] 二分查找最接近 x 的解
     size_t l{res.size() >> 1}, r{res.size() - 1};
     for (int i = 0; i < 2 * log2(res.size()); i++)
@@ -58,15 +86,73 @@ std::pair<double, double> GravityCompensator::Impl::bulletModel(double x, double
         size_t m = (l + r) >> 1;
         res[m][0] < x ? (l = m + 1) : (r = m);
     }
-    // 线性插值，获取 x 对应的落点高度 y 以及对应的子弹飞行时间 t
-    size_t i1 = res[l][0] < x ? l : l - 1;
-    size_t i2 = res[l][0] < x ? l + 1 : l;
+    // 线性插值，获取 x 对应的落点高度 y 以及对应的子弹飞行时间 t，弹道不可达时使用最后两点外插
+    size_t i2 = res[l][0] < x ? std::min(l + 1, res.size() - 1) : l;
+    size_t i1 = i2 - 1;
     double retval_y = res[i1][2] + (res[i2][2] - res[i1][2]) / (res[i2][0] - res[i1][0]) * (x - res[i1][0]);
     double retval_t = (i1 + (x - res[i1][0]) / (res[i2][0] - res[i1][0])) * para::gravity_compensator_param.h;
     return {retval_y, retval_t};
 }
 
-std::pair<double, double> GravityCompensator::Impl::calc(double x, double y, double velocity)
+std::tuple<double, double, double> GravityCompensator::Impl::bulletSensitivity(double x, double v, double angle)
+{
+    const double h = para::gravity_compensator_param.h;
+    double c = cos(angle), s = sin(angle);
+    // 预估子弹飞行时间，并延长 50% 以覆盖空气阻力带来的减速
+    double t_pre{x / (v * c) * 1.5};
+    std::size_t steps = static_cast<std::size_t>(std::ceil(t_pre / h)) + 1;
+    // 状态量 [x, vx, y, vy] 以及各自对发射角度的灵敏度，逐步积分直至越过水平距离 x
+    _rk_sens.init(0, {0, v * c, 0, v * s, 0, -v * s, 0, v * c}, h);
+    for (std::size_t i = 0; i < steps; ++i)
+    {
+        auto r1 = _rk_sens.x();
+        _rk_sens.step();
+        const auto &r2 = _rk_sens.x();
+        if (r2[0] < x)
+            continue;
+        // 线性插值，获取 x 对应的落点高度 y、灵敏度 dy/dθ 以及对应的子弹飞行时间 t
+        double r = (x - r1[0]) / (r2[0] - r1[0]);
+        double dy1 = r1[6] - r1[3] / r1[1] * r1[4], dy2 = r2[6] - r2[3] / r2[1] * r2[4];
+        double retval_t = (static_cast<double>(i) + r) * h;
+        return {r1[2] + (r2[2] - r1[2]) * r, dy1 + (dy2 - dy1) * r, retval_t};
+    }
+    return {std::numeric_limits<double>::quiet_NaN(), 0, 0};
+}
+
+std::vector<std::pair<double, double>> GravityCompensator::Impl::calc(const std::vector<double> &xs, const std::vector<double> &ys, double velocity)
+{
+    std::vector<std::pair<double, double>> retval(xs.size());
+    // 优先查询弹道表，超出范围或不可达的目标使用打靶法批量求解
+    std::vector<std::size_t> miss;
+    std::vector<double> miss_xs, miss_ys;
+    for (std::size_t i = 0; i < xs.size(); ++i)
+    {
+        auto &[angle, t] = retval[i];
+        if (_table.query(xs[i], ys[i], velocity, angle, t))
+            continue;
+        miss.push_back(i);
+        miss_xs.push_back(xs[i]);
+        miss_ys.push_back(ys[i]);
+    }
+    if (miss.empty())
+        return retval;
+    auto model = [this](double x, double v, double angle) { return bulletSensitivity(x, v, angle); };
+    auto shots = shoot(model, miss_xs, miss_ys, velocity);
+    // 打靶法不收敛的目标使用不动点迭代回退求解
+    for (std::size_t k = 0; k < miss.size(); ++k)
+        retval[miss[k]] = shots[k].converged ? std::make_pair(shots[k].pitch, shots[k].tof)
+                                             : calcFallback(miss_xs[k], miss_ys[k], velocity);
+    return retval;
+}
+
+std::pair<double, double> GravityCompensator::Impl::calcExact(double x, double y, double velocity)
+{
+    auto model = [this](double dis, double v, double angle) { return bulletSensitivity(dis, v, angle); };
+    auto res = shoot(model, x, y, velocity);
+    return res.converged ? std::make_pair(res.pitch, res.tof) : calcFallback(x, y, velocity);
+}
+
+std::pair<double, double> GravityCompensator::Impl::calcFallback(double x, double y, double velocity)
 {
     double y_temp{y};
     double angle{};
@@ -74,7 +160,8 @@ std::pair<double, double> GravityCompensator::Impl::calc(double x, double y, dou
     // 使用迭代法求得补偿角度，并获取对应的子弹飞行时间
     for (int i = 0; i < 50; i++)
     {
-        angle = atan2(y_temp, x);
+        // 限制发射角度，避免弹道不可达时预估飞行时间过长
+        angle = std::clamp(atan2(y_temp, x), -1.5, 1.5);
         // 通过子弹模型计算落点以及子弹飞行时间
         auto [cur_y, cur_t] = bulletModel(x, velocity, angle);
         t = cur_t;
@@ -117,7 +204,9 @@ CompensateInfo GravityCompensator::Impl::compensate(const std::vector<group::ptr
     CompensateInfo info{};
     // 补偿手动调节
     updateStaticCom(com_flag, _yaw_static_com, _pitch_static_com);
-    // 对每个序列组的每个追踪器按照一种方式进行补偿计算
+    // 收集所有序列组的所有追踪器，批量进行补偿计算
+    std::vector<tracker::ptr> trackers;
+    std::vector<double> angles, xs, ys;
     for (auto &p_group : groups)
     {
         for (auto &p_tracker : p_group->data())
@@ -129,16 +218,51 @@ CompensateInfo GravityCompensator::Impl::compensate(const std::vector<group::ptr
                                           p_tracker->front()->getGyroData().rotation.pitch);
             // 目标与云台转轴的连线与水平方向的夹角
             double angle = gyro_angle.y + p_tracker->getRelativeAngle().y;
-            // 计算补偿角度和对应的子弹飞行时间（模型中角度要求向上为正，这里需取反）
-            auto [angle_com, t_com] = calc(dis * cos(deg2rad(-angle)), dis * sin(deg2rad(-angle)), shoot_speed);
-            double gp = rad2deg(-angle_com);
-            double x_com = _yaw_static_com;
-            double y_com = gp - angle + _pitch_static_com;
-            // 更新
-            info.compensation.emplace(p_tracker, cv::Point2f(x_com, y_com));
-            info.tof.emplace(p_tracker, t_com);
+            trackers.push_back(p_tracker);
+            angles.push_back(angle);
+            // 模型中角度要求向上为正，这里需取反
+            xs.push_back(dis * cos(deg2rad(-angle)));
+            ys.push_back(dis * sin(deg2rad(-angle)));
         }
     }
+    // 计算补偿角度和对应的子弹飞行时间
+    auto coms = calc(xs, ys, shoot_speed);
+    for (std::size_t i = 0; i < trackers.size(); ++i)
+    {
+        auto [angle_com, t_com] = coms[i];
+        double gp = rad2deg(-angle_com);
+        double x_com = _yaw_static_com;
+        double y_com = gp - angles[i] + _pitch_static_com;
+        // 更新
+        info.compensation.emplace(trackers[i], cv::Point2f(x_com, y_com));
+        info.tof.emplace(trackers[i], t_com);
+    }
+    return info;
+}
+
+AimInfo GravityCompensator::Impl::aim(const std::function<cv::Vec3f(double)> &motion, float shoot_speed)
+{
+    AimInfo info{};
+    double velocity = shoot_speed, pitch = std::numeric_limits<double>::quiet_NaN();
+    auto model = [this](double dis, double v, double angle) { return bulletSensitivity(dis, v, angle); };
+    auto ballistic = [&](double x, double y) {
+        ShootingResult res{};
+        if (_table.query(x, y, velocity, res.pitch, res.tof))
+            res.converged = true;
+        else
+            res = shoot(model, x, y, velocity, 1e-3, 20, pitch);
+        pitch = res.pitch;
+        return res;
+    };
+    // 陀螺仪坐标系的 y 轴竖直向下
+    auto target = [&](double t) {
+        info.position = motion(t);
+        return std::make_pair(std::hypot(info.position(0), info.position(2)) / 1000., -info.position(1) / 1000.);
+    };
+    auto res = rm::aim(ballistic, target, _aim_tof);
+    info.compensation = {_yaw_static_com, static_cast<float>(rad2deg(std::atan2(res.y, res.x) - res.pitch)) + _pitch_static_com};
+    info.tof = res.tof, info.iter = res.iter, info.converged = res.converged;
+    _aim_tof = res.converged ? res.tof : 0;
     return info;
 }
 
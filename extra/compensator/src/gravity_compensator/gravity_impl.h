@@ -11,13 +11,34 @@
 
 #pragma once
 
+#include "rmvl/algorithm/numcal.hpp"
 #include "rmvl/compensator/gravity_compensator.h"
+#include "rmvl/compensator/shooting.h"
 
-#include "rmvl/algorithm/numcal.hpp"
+#include "ballistic_table.h"
 
 namespace rm
 {
 
+/**
+ * @brief 带灵敏度方程的弹道方程组，状态量为 \f$[x,v_x,y,v_y]\f$ 以及各自对发射角度的灵敏度
+ * @note 灵敏度方程与速度分量的方程形式相同：\f$\dot{\partial x}=\partial v_x,\ \dot{\partial v_x}=a_{22}\partial v_x+a_{24}\partial v_y\f$ 等
+ */
+struct BallisticSensitivityOdes
+{
+    double a22{}; //!< 水平速度对水平加速度的系数
+    double a24{}; //!< 竖直速度对水平加速度的系数
+    double a42{}; //!< 水平速度对竖直加速度的系数
+    double a44{}; //!< 竖直速度对竖直加速度的系数
+    double g{};   //!< 重力加速度
+
+    inline std::array<double, 8> operator()(double, const std::array<double, 8> &x) const
+    {
+        return {x[1], a22 * x[1] + a24 * x[3], x[3], a42 * x[1] + a44 * x[3] - g,
+                x[5], a22 * x[5] + a24 * x[7], x[7], a42 * x[5] + a44 * x[7]};
+    }
+};
+
 class GravityCompensator::Impl
 {
     float _yaw_static_com;   //!< yaw 轴静态补偿，方向与 yaw 一致
@@ -29,9 +50,15 @@ public:
     //! 补偿函数，考虑空气阻力，使用 2 阶龙格库塔方法（中点公式）计算弹道
     CompensateInfo compensate(const std::vector<group::ptr> &groups, float shoot_speed, CompensateType com_flag);
 
+    //! 仅更新静态补偿
+    inline void updateStatic(CompensateType com_flag) { updateStaticCom(com_flag, _yaw_static_com, _pitch_static_com); }
+
+    //! 预测与弹道的联合解算
+    AimInfo aim(const std::function<cv::Vec3f(double)> &motion, float shoot_speed);
+
 private:
     /**
-     * @brief 弹道模型
+     * @brief 弹道模型，不含灵敏度方程，作为打靶法不收敛时不动点迭代的回退模型，参考 `calcFallback`
      *
      * @param[in] x 目标离相机的水平距离，单位 `m`
      * @param[in] v 枪口射速，单位 `m/s`
@@ -41,6 +68,19 @@ private:
      */
     std::pair<double, double> bulletModel(double x, double v, double angle);
 
+    /**
+     * @brief 带灵敏度的弹道模型，在弹道方程中同时积分状态量对发射角度 \f$\theta\f$ 的灵敏度方程
+     * @brief
+     * 由于飞行至水平距离 \f$x\f$ 的时刻同样依赖于 \f$\theta\f$，落点高度的灵敏度为
+     * \f[\frac{\mathrm dy}{\mathrm d\theta}=\frac{\partial y}{\partial\theta}-\frac{v_y}{v_x}\frac{\partial x}{\partial\theta}\f]
+     *
+     * @param[in] x 目标离相机的水平距离，单位 `m`
+     * @param[in] v 枪口射速，单位 `m/s`
+     * @param[in] angle 当前枪口仰角、俯角，`+` 表示仰角，`-` 表示俯角，单位 `rad`
+     * @return 落点高度、灵敏度以及子弹飞行时间的三元组，弹道不可达时落点高度为 `NaN`
+     */
+    std::tuple<double, double, double> bulletSensitivity(double x, double v, double angle);
+
     /**
      * @brief 更新静态补偿
      *
@@ -51,19 +91,51 @@ private:
     void updateStaticCom(CompensateType com_flag, float &x_st, float &y_st);
 
     /**
-     * @brief 计算补偿角度以及子弹飞行时间
+     * @brief 批量计算补偿角度以及子弹飞行时间，优先查询弹道表，其余目标使用打靶法批量求解
      * @note
      * - 需要严格满足相机对水平方向的夹角等于 `gyro_angle.y`
      *
+     * @param[in] xs 所有目标离相机的水平宽度
+     * @param[in] ys 所有目标离相机的铅垂高度
+     * @param[in] velocity 枪口射速
+     *
+     * @return 与目标一一对应的补偿角度、子弹飞行时间的二元组
+     */
+    std::vector<std::pair<double, double>> calc(const std::vector<double> &xs, const std::vector<double> &ys, double velocity);
+
+    /**
+     * @brief 使用带保护的牛顿打靶法精确计算补偿角度以及子弹飞行时间
+     *
      * @param[in] x 目标离相机的水平宽度
      * @param[in] y 目标离相机的铅垂高度
      * @param[in] velocity 枪口射速
      *
      * @return 补偿角度、子弹飞行时间的二元组
      */
-    std::pair<double, double> calc(double x, double y, double velocity);
+    std::pair<double, double> calcExact(double x, double y, double velocity);
+
+    /**
+     * @brief 回退方案：基于 `bulletModel` 的不动点迭代，逐次以落点高度误差修正瞄准高度，
+     *        收敛较慢但不依赖灵敏度，用于打靶法不收敛的目标
+     *
+     * @param[in] x 目标离相机的水平宽度
+     * @param[in] y 目标离相机的铅垂高度
+     * @param[in] velocity 枪口射速
+     *
+     * @return 补偿角度、子弹飞行时间的二元组
+     */
+    std::pair<double, double> calcFallback(double x, double y, double velocity);
+
+    //! 加载或构建弹道表，缓存键为弹道模型参数以及网格参数
+    void initTable(const Odes &fs);
+
+    //! 带灵敏度方程的固定维度 2 阶龙格库塔求解器
+    using SensitivityIntegrator = OdeIntegrator<ButcherRK2, 8, BallisticSensitivityOdes>;
 
-    std::unique_ptr<RungeKutta2> _rk; //!< 2 阶龙格库塔求解器
+    std::unique_ptr<RungeKutta2> _rk;                           //!< 2 阶龙格库塔求解器
+    SensitivityIntegrator _rk_sens{BallisticSensitivityOdes{}}; //!< 带灵敏度方程的 2 阶龙格库塔求解器
+    BallisticTable _table;                                      //!< 预计算弹道表
+    double _aim_tof{};                                          //!< 上一次联合解算的子弹飞行时间，作为下一次解算的初值
 };
 
 } // namespace rm
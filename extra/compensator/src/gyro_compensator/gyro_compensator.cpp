@@ -9,7 +9,10 @@
  *
  */
 
+#include <limits>
+
 #include "rmvl/compensator/gyro_compensator.h"
+#include "rmvl/compensator/shooting.h"
 #include "rmvl/algorithm/transform.hpp"
 #include "rmvl/group/gyro_group.h"
 
@@ -19,23 +22,6 @@
 namespace rm
 {
 
-/**
- * @brief 弹道模型
- *
- * @param[in] x 目标离相机的水平距离，单位 `m`
- * @param[in] v 枪口射速，单位 `m/s`
- * @param[in] angle 当前枪口仰角、俯角，`+` 表示仰角，`-` 表示俯角，单位 `rad`
- * @return 弹丸飞行至水平距离`x`时，落点的垂直距离
- * @note 返回值为正表示落点在枪口上方，为负表示落点在枪口下方，单位 `m`
- */
-static double bulletModel(double x, double v, double angle)
-{
-    // 计算飞行 x 距离的子弹飞行时间
-    double t = x / (v * cos(angle));
-    // 计算子弹落点高度
-    return v * sin(angle) * t - para::gyro_compensator_param.g * t * t / 2.0;
-}
-
 static void updateStaticCom(CompensateType com_flag, float &x_st, float &y_st)
 {
     float com_step = para::gyro_compensator_param.MINIMUM_COM;
@@ -62,45 +48,21 @@ static void updateStaticCom(CompensateType com_flag, float &x_st, float &y_st)
     }
 }
 
-/**
- * @brief 获得补偿角度
- * @note
- * - 需要严格满足相机对水平方向的夹角等于 `gyro_angle.y`
- *
- * @param[in] x 目标离相机的水平宽度
- * @param[in] y 目标离相机的铅垂高度
- * @param[in] v 枪口射速
- *
- * @return 补偿角度
- */
-static double getPitch(double x, double y, double v)
-{
-    double y_temp = y;
-    double angle = 0.f;
-    // 使用迭代法求得补偿角度
-    for (int i = 0; i < 50; i++)
-    {
-        angle = atan2(y_temp, x);
-        double dy = y - bulletModel(x, v, angle);
-        y_temp += dy;
-        if (abs(dy) < 0.001)
-            break;
-    }
-    return angle;
-}
-
 GyroCompensator::GyroCompensator()
 {
     _pitch_static_com = para::gyro_compensator_param.PITCH_COMPENSATE;
     _yaw_static_com = para::gyro_compensator_param.YAW_COMPENSATE;
 }
 
+void GyroCompensator::updateStatic(CompensateType com_flag) { updateStaticCom(com_flag, _yaw_static_com, _pitch_static_com); }
+
 CompensateInfo GyroCompensator::compensate(const std::vector<group::ptr> &groups, float shoot_speed, CompensateType com_flag)
 {
     CompensateInfo info;
     // 补偿手动调节
     updateStaticCom(com_flag, _yaw_static_com, _pitch_static_com);
-    // 对每个序列组的中心点计算补偿
+    // 收集每个序列组的中心点，批量计算补偿
+    std::vector<double> angles, xs, ys;
     for (auto p_group : groups)
     {
         auto p_gyro_group = GyroGroup::cast(p_group);
@@ -115,20 +77,48 @@ CompensateInfo GyroCompensator::compensate(const std::vector<group::ptr> &groups
                                       p_gyro_group->getGyroData().rotation.pitch);
         // 目标与云台转轴的连线与水平方向的夹角
         double angle = gyro_angle.y + relative_angle.y;
-        double gp = rad2deg(-getPitch(dis * cos(deg2rad(-angle)), // 模型中角度要求向上为正，这里需取反
-                                      dis * sin(deg2rad(-angle)), static_cast<double>(shoot_speed)));
+        angles.push_back(angle);
+        // 模型中角度要求向上为正，这里需取反
+        xs.push_back(dis * cos(deg2rad(-angle)));
+        ys.push_back(dis * sin(deg2rad(-angle)));
+    }
+    // 使用抛物线模型的打靶法求解补偿角度以及子弹飞行时间
+    auto shots = shoot(VacuumBulletModel{para::gyro_compensator_param.g}, xs, ys, static_cast<double>(shoot_speed));
+    for (std::size_t i = 0; i < groups.size(); ++i)
+    {
+        double gp = rad2deg(-shots[i].pitch);
         double x_com = _yaw_static_com;
-        double y_com = gp - angle + _pitch_static_com;
-        // 子弹飞行时间计算
-        double tf = dis * cos(deg2rad(-angle)) / (static_cast<double>(shoot_speed) * cos(deg2rad(y_com + angle)));
+        double y_com = gp - angles[i] + _pitch_static_com;
         // 更新至每个 tracker
-        for (auto p_tracker : p_group->data())
+        for (auto p_tracker : groups[i]->data())
         {
             info.compensation.emplace(p_tracker, cv::Point2f(x_com, y_com));
-            info.tof.emplace(p_tracker, tf);
+            info.tof.emplace(p_tracker, shots[i].tof);
         }
     }
     return info;
 }
 
+AimInfo GyroCompensator::aim(const std::function<cv::Vec3f(double)> &motion, float shoot_speed)
+{
+    AimInfo info{};
+    VacuumBulletModel model{para::gyro_compensator_param.g};
+    double pitch = std::numeric_limits<double>::quiet_NaN();
+    auto ballistic = [&](double x, double y) {
+        auto res = shoot(model, x, y, static_cast<double>(shoot_speed), 1e-3, 20, pitch);
+        pitch = res.pitch;
+        return res;
+    };
+    // 陀螺仪坐标系的 y 轴竖直向下
+    auto target = [&](double t) {
+        info.position = motion(t);
+        return std::make_pair(std::hypot(info.position(0), info.position(2)) / 1000., -info.position(1) / 1000.);
+    };
+    auto res = rm::aim(ballistic, target, _aim_tof);
+    info.compensation = {_yaw_static_com, static_cast<float>(rad2deg(std::atan2(res.y, res.x) - res.pitch)) + _pitch_static_com};
+    info.tof = res.tof, info.iter = res.iter, info.converged = res.converged;
+    _aim_tof = res.converged ? res.tof : 0;
+    return info;
+}
+
 } // namespace rm
\ No newline at end of file
@@ -13,6 +13,9 @@
 
 #ifdef HAVE_RMVL_GRAVITY_COMPENSATOR
 
+#include <cstdio>
+#include <utility>
+
 #include <gtest/gtest.h>
 
 #define private public
@@ -40,6 +43,164 @@ TEST(GravityCompensator, bulletModel)
     double y = 16 * sin(rm::PI_4) * t - 0.5 * rm::para::gravity_compensator_param.g * t * t;
     EXPECT_NEAR(y, y_fric, 5e-2);
     EXPECT_NEAR(t, t_fric, 5e-2);
+    // 回退方案与打靶法精确求解一致
+    auto [pitch_fb, tof_fb] = impl.calcFallback(6, 0.5, 20);
+    auto [pitch_exact, tof_exact] = impl.calcExact(6, 0.5, 20);
+    EXPECT_NEAR(pitch_fb, pitch_exact, 1e-3);
+    EXPECT_NEAR(tof_fb, tof_exact, 1e-3);
+}
+
+// 真空模型下的打靶法与解析解
+TEST(GravityCompensator, shootingVacuum)
+{
+    rm::VacuumBulletModel model{9.8};
+    std::vector<double> xs, ys;
+    for (double x = 1; x < 12; x += 1.3)
+        for (double y = -2; y < 3; y += 0.45)
+            xs.push_back(x), ys.push_back(y);
+    auto shots = rm::shoot(model, xs, ys, 25.0, 1e-6);
+    for (std::size_t i = 0; i < xs.size(); ++i)
+    {
+        // 低弹道解析解：k·tan²θ - x·tanθ + (k + y) = 0，其中 k = gx² / (2v²)
+        double x = xs[i], y = ys[i], k = 9.8 * x * x / (2 * 25.0 * 25.0);
+        double tan_theta = (x - std::sqrt(x * x - 4 * k * (k + y))) / (2 * k);
+        ASSERT_TRUE(shots[i].converged);
+        EXPECT_LE(shots[i].iter, 6u);
+        EXPECT_NEAR(shots[i].pitch, std::atan(tan_theta), 1e-6);
+        EXPECT_NEAR(shots[i].tof, x / (25.0 * std::cos(shots[i].pitch)), 1e-9);
+        // 单个目标求解与批量求解一致
+        auto single = rm::shoot(model, x, y, 25.0, 1e-6);
+        EXPECT_EQ(single.pitch, shots[i].pitch);
+        EXPECT_EQ(single.iter, shots[i].iter);
+    }
+    // 不可达的目标不收敛
+    EXPECT_FALSE(rm::shoot(model, 100, 0, 10.0).converged);
+}
+
+// 空气阻力模型下的打靶法
+TEST(GravityCompensator, shootingDrag)
+{
+    rm::GravityCompensator::Impl impl;
+    for (double v : {12.0, 16.0, 30.0})
+        for (double x = 1.2; x < 12; x += 1.7)
+            for (double y = -2; y < 3; y += 0.8)
+            {
+                auto model = [&](double dis, double speed, double angle) { return impl.bulletSensitivity(dis, speed, angle); };
+                auto res = rm::shoot(model, x, y, v);
+                ASSERT_TRUE(res.converged);
+                EXPECT_LE(res.iter, 8u);
+                // 落点高度与不带灵敏度的弹道模型一致
+                auto [cur_y, cur_t] = impl.bulletModel(x, v, res.pitch);
+                EXPECT_NEAR(cur_y, y, 1e-3);
+                EXPECT_NEAR(cur_t, res.tof, 1e-9);
+            }
+}
+
+// 打靶法不收敛的目标使用回退方案求解
+TEST(GravityCompensator, calcFallback)
+{
+    rm::GravityCompensator::Impl impl;
+    auto coms = impl.calc({6, 60}, {0.5, 0}, 10);
+    auto [pitch_exact, tof_exact] = impl.calcExact(6, 0.5, 10);
+    EXPECT_EQ(coms[0].first, pitch_exact);
+    EXPECT_EQ(coms[0].second, tof_exact);
+    // 不可达的目标仍返回有限的补偿角度与飞行时间
+    EXPECT_TRUE(std::isfinite(coms[1].first));
+    EXPECT_TRUE(std::isfinite(coms[1].second));
+    EXPECT_LE(std::abs(coms[1].first), 1.5);
+}
+
+// 弹道表与迭代法精确求解的误差
+TEST(GravityCompensator, ballisticTable)
+{
+    // 弹道表默认关闭，测试时临时开启
+    auto &param = rm::para::gravity_compensator_param;
+    bool use_table = std::exchange(param.USE_TABLE, true);
+    rm::GravityCompensator::Impl impl;
+    param.USE_TABLE = use_table;
+    ASSERT_FALSE(impl._table.empty());
+    for (double v : {15.0, 18.0, 24.5, 30.0})
+        for (double x = 3.5; x < 9; x += 0.73)
+            for (double y = -1.23; y < 1.5; y += 0.37)
+            {
+                double pitch{}, tof{};
+                ASSERT_TRUE(impl._table.query(x, y, v, pitch, tof));
+                auto [pitch_exact, tof_exact] = impl.calcExact(x, y, v);
+                EXPECT_NEAR(pitch, pitch_exact, 1.2e-3);
+                EXPECT_NEAR(tof, tof_exact, 2e-3);
+            }
+    // 超出弹道表范围时退化为精确求解
+    double pitch{}, tof{};
+    EXPECT_FALSE(impl._table.query(20, 0, 15, pitch, tof));
+    EXPECT_FALSE(impl._table.query(5, 0, 100, pitch, tof));
+}
+
+// 弹道表的磁盘缓存
+TEST(GravityCompensator, ballisticTableCache)
+{
+    // 弹道表默认关闭，测试时临时开启
+    auto &param = rm::para::gravity_compensator_param;
+    bool use_table = std::exchange(param.USE_TABLE, true);
+    rm::GravityCompensator::Impl impl;
+    param.USE_TABLE = use_table;
+    ASSERT_FALSE(impl._table.empty());
+    std::string path = "ballistic_table_test.bin";
+    ASSERT_TRUE(impl._table.save(path, {1, 2, 3}));
+    rm::BallisticTable table;
+    EXPECT_FALSE(table.load(path, {1, 2, 4}));
+    EXPECT_TRUE(table.empty());
+    ASSERT_TRUE(table.load(path, {1, 2, 3}));
+    double p1{}, t1{}, p2{}, t2{};
+    ASSERT_TRUE(impl._table.query(5.5, 0.3, 16, p1, t1));
+    ASSERT_TRUE(table.query(5.5, 0.3, 16, p2, t2));
+    EXPECT_EQ(p1, p2);
+    EXPECT_EQ(t1, t2);
+    std::remove(path.c_str());
+}
+
+// 真空模型下预测与弹道的联合解算
+TEST(GravityCompensator, aimVacuum)
+{
+    rm::VacuumBulletModel model{9.8};
+    for (double vx : {-3.0, 0.0, 2.5})
+        for (double x = 2; x < 9; x += 1.1)
+        {
+            auto ballistic = [&](double dis, double height) { return rm::shoot(model, dis, height, 25.0, 1e-6); };
+            auto motion = [&](double t) { return std::make_pair(x + vx * t, 0.4 - 0.3 * t); };
+            auto res = rm::aim(ballistic, motion);
+            ASSERT_TRUE(res.converged);
+            EXPECT_LE(res.iter, 6u);
+            // 飞行时间与命中位置自洽
+            auto [hit_x, hit_y] = motion(res.tof);
+            EXPECT_NEAR(res.x, hit_x, 1e-3);
+            EXPECT_NEAR(res.y, hit_y, 1e-3);
+            auto [y, dy, t] = model(hit_x, 25.0, res.pitch);
+            EXPECT_NEAR(y, hit_y, 1e-3);
+            EXPECT_NEAR(t, res.tof, 1e-4);
+            // 以解作为初值时一次迭代即收敛
+            EXPECT_EQ(rm::aim(ballistic, motion, res.tof).iter, 1u);
+        }
+}
+
+// 重力补偿的联合解算：子弹在飞行时间结束时命中预测位置
+TEST(GravityCompensator, aimCompensator)
+{
+    rm::GravityCompensator::Impl impl;
+    // 陀螺仪坐标系下以 2 m/s 远离、0.5 m/s 横移的目标
+    auto motion = [](double t) { return cv::Vec3f(500 * t, -300, 5000 + 2000 * t); };
+    auto info = impl.aim(motion, 16);
+    ASSERT_TRUE(info.converged);
+    EXPECT_LE(info.iter, 6u);
+    cv::Vec3f hit = motion(info.tof);
+    EXPECT_NEAR(cv::norm(info.position - hit), 0, 1);
+    // 与命中位置的精确解一致
+    double x = std::hypot(hit(0), hit(2)) / 1000., y = -hit(1) / 1000.;
+    auto [pitch, tof] = impl.calcExact(x, y, 16);
+    EXPECT_NEAR(info.tof, tof, 2e-3);
+    float y_com = rm::rad2deg(std::atan2(y, x) - pitch) + impl._pitch_static_com;
+    EXPECT_NEAR(info.compensation.y, y_com, 0.1);
+    // 以上一次的飞行时间热启动
+    EXPECT_LE(impl.aim(motion, 16).iter, 2u);
 }
 
 } // namespace rm_test
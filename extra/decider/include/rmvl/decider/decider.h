@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "rmvl/compensator/compensator.h"
 #include "rmvl/detector/detector.h"
 #include "rmvl/predictor/predictor.h"
@@ -21,6 +23,25 @@ namespace rm
 //! @addtogroup decider
 //! @{
 
+/**
+ * @brief 控制频率下重新瞄准所需的目标运动状态
+ * @note
+ * - 由决策模块在每帧决策时填写，仅包含 POD 数据，可直接拷贝至高频控制线程，无需访问追踪器、序列组
+ * @note
+ * - 期望目标点按照 \f$\pmb p(t)=\pmb c+\pmb v\Delta t+R_y(\omega\Delta t)\pmb r\f$ 外推，其中
+ *   \f$\Delta t\f$ 为相对捕获时间点的时间增量，坐标均位于陀螺仪坐标系下
+ */
+struct ReaimInfo
+{
+    double tick{};      //!< 决策所用图像的捕获时间点 (s)
+    cv::Vec3f center;   //!< 捕获时间点的期望旋转中心 (mm)
+    cv::Vec3f velocity; //!< 旋转中心的平移速度 (mm/s)
+    cv::Vec3f radius;   //!< 期望目标点相对旋转中心的向量 (mm)
+    float rotspeed{};   //!< 绕 Y 轴的旋转角速度 (rad/s)
+    cv::Point2f offset; //!< 期望角度与期望目标点视线角之差，包含补偿以及响应修正
+    bool valid = false; //!< 是否可用于重新瞄准
+};
+
 /**
  * @brief 决策模块信息
  * @note
@@ -34,6 +55,76 @@ struct DecideInfo
     cv::Point2f exp_center2d; //!< 像素坐标系下的期望目标点
     cv::Point3f exp_center3d; //!< 相机坐标系下的期望目标点
     bool can_shoot = false;   //!< 能否射击
+    ReaimInfo reaim;          //!< 控制频率下重新瞄准所需的目标运动状态
+};
+
+/**
+ * @brief 按需计算的补偿、预测信息
+ * @note
+ * - 决策模块先使用优先级、距离等低代价的信息选出候选序列组，再仅对候选序列组请求补偿、预测信息，避免为最终不被使用的序列组计算
+ * @note
+ * - 以序列组为单位调用补偿、预测模块并缓存结果，同一序列组只计算一次，需要每帧重新构造
+ * @note
+ * - 有状态的预测模块在未被请求的帧内不会更新对应序列组的状态
+ */
+class LazyInfo
+{
+public:
+    /**
+     * @brief 创建按需计算的补偿、预测信息
+     *
+     * @param[in] com 补偿模块
+     * @param[in] pre 预测模块
+     * @param[in] shoot_speed 子弹射速 (m/s)
+     * @param[in] com_flag 手动调节补偿标志，构造时立即生效
+     */
+    LazyInfo(compensator &com, predictor &pre, float shoot_speed, CompensateType com_flag = CompensateType::UNKNOWN)
+        : _com(com), _pre(pre), _shoot_speed(shoot_speed) { _com.updateStatic(com_flag); }
+
+    /**
+     * @brief 请求指定序列组的补偿、预测信息，已请求过的序列组不再重复计算
+     *
+     * @param[in] p_group 候选序列组
+     */
+    void require(group::ptr p_group)
+    {
+        if (p_group == nullptr || std::find(_groups.begin(), _groups.end(), p_group) != _groups.end())
+            return;
+        _groups.push_back(p_group);
+        std::vector<group::ptr> groups{p_group};
+        auto com_info = _com.compensate(groups, _shoot_speed, CompensateType::UNKNOWN);
+        auto pre_info = _pre.predict(groups, com_info.tof);
+        _compensate_info.compensation.merge(com_info.compensation);
+        _compensate_info.tof.merge(com_info.tof);
+        _predict_info.static_prediction.merge(pre_info.static_prediction);
+        _predict_info.dynamic_prediction.merge(pre_info.dynamic_prediction);
+        _predict_info.shoot_delay_prediction.merge(pre_info.shoot_delay_prediction);
+    }
+
+    /**
+     * @brief 对决策选中的目标进行预测与弹道的联合解算，参考 `compensator::aim`
+     *
+     * @param[in] motion 目标运动模型，返回子弹飞行 `t` 秒后目标在陀螺仪坐标系下的位置，单位 `mm`
+     * @return 联合瞄准信息
+     */
+    inline AimInfo aim(const std::function<cv::Vec3f(double)> &motion) { return _com.aim(motion, _shoot_speed); }
+
+    //! 预测模块的流水线延迟估计值 (s)
+    inline double latency() const { return _pre.latency().value(); }
+    //! 已请求的序列组的补偿信息
+    inline const CompensateInfo &compensateInfo() const { return _compensate_info; }
+    //! 已请求的序列组的预测信息
+    inline const PredictInfo &predictInfo() const { return _predict_info; }
+    //! 已请求的序列组
+    inline const std::vector<group::ptr> &groups() const { return _groups; }
+
+private:
+    compensator &_com;               //!< 补偿模块
+    predictor &_pre;                 //!< 预测模块
+    float _shoot_speed{};            //!< 子弹射速
+    std::vector<group::ptr> _groups; //!< 已请求的序列组
+    CompensateInfo _compensate_info; //!< 已请求的序列组的补偿信息
+    PredictInfo _predict_info;       //!< 已请求的序列组的预测信息
 };
 
 //! 目标决策模块
@@ -60,6 +151,28 @@ public:
     virtual DecideInfo decide(const std::vector<group::ptr> &groups, RMStatus flag,
                               tracker::ptr last_target, const DetectInfo &detect_info,
                               const CompensateInfo &compensate_info, const PredictInfo &predict_info) = 0;
+
+    /**
+     * @brief 按需计算补偿、预测信息的决策函数
+     * @note
+     * - 派生类可先选出候选序列组，再通过 `LazyInfo::require` 仅对候选序列组请求补偿、预测信息
+     * @note
+     * - 默认请求所有序列组，与直接调用决策核心函数等价
+     *
+     * @param[in] groups 所有序列组
+     * @param[in] flag 决策状态模式
+     * @param[in] last_target 历史目标追踪器，为空则默认自动判断
+     * @param[in] detect_info 辅助决策的识别模块信息
+     * @param[in] lazy_info 按需计算的补偿、预测信息
+     * @return 决策模块信息
+     */
+    virtual DecideInfo decide(const std::vector<group::ptr> &groups, RMStatus flag,
+                              tracker::ptr last_target, const DetectInfo &detect_info, LazyInfo &lazy_info)
+    {
+        for (const auto &p_group : groups)
+            lazy_info.require(p_group);
+        return decide(groups, flag, last_target, detect_info, lazy_info.compensateInfo(), lazy_info.predictInfo());
+    }
 };
 
 //! @} decider
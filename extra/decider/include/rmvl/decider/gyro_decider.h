@@ -48,6 +48,41 @@ public:
                       tracker::ptr last_target, const DetectInfo &detect_info,
                       const CompensateInfo &compensate_info, const PredictInfo &predict_info) override;
 
+    /**
+     * @brief 按需计算补偿、预测信息的装甲板决策函数
+     * @note
+     * - 目标序列组的选取仅依赖于历史目标和数字决策优先级，因此先选出目标序列组，只对该序列组请求补偿、预测信息
+     * @note
+     * - 选出目标追踪器后，以 `GyroPredictor::motion` 为目标运动模型（序列组未经预测的状态加上流水线延迟）调用
+     *   `LazyInfo::aim` 进行预测与弹道的联合解算，收敛时使用命中时刻预测位置对应的补偿替换以当前位置计算的补偿
+     * - `DecideInfo::reaim` 已包含预测量，仅用于控制频率下的 `reaim`，不作为联合解算的运动模型
+     *
+     * @param[in] groups 所有序列组
+     * @param[in] flag 决策状态模式
+     * @param[in] last_target 历史目标追踪器，为空则默认自动判断
+     * @param[in] detect_info 辅助决策的识别模块信息
+     * @param[in] lazy_info 按需计算的补偿、预测信息
+     * @return 决策模块信息
+     */
+    DecideInfo decide(const std::vector<group::ptr> &groups, RMStatus flag,
+                      tracker::ptr last_target, const DetectInfo &detect_info, LazyInfo &lazy_info) override;
+
+    /**
+     * @brief 在两帧图像之间以控制频率重新计算云台响应的期望角度偏移量
+     * @note
+     * - 以决策时记录的目标运动状态闭式外推至 `tick` 时刻，并使用最新的云台姿态换算为相对角度，沿用决策时的补偿量
+     * @note
+     * - 不访问追踪器、序列组，不涉及识别与动态内存分配，可在高频控制线程中调用
+     * @note
+     * - 以决策所用图像的捕获时间点和云台姿态调用时，结果与 `DecideInfo::exp_angle` 一致（不计相机畸变的影响）
+     *
+     * @param[in] info 最近一次决策得到的 `DecideInfo::reaim`
+     * @param[in] tick 当前时间点，与组合体的时间点使用相同的时基 (s)
+     * @param[in] gyro_data 当前的云台姿态
+     * @return 云台响应的期望角度偏移量，`info` 不可用时返回零偏移量
+     */
+    static cv::Point2f reaim(const ReaimInfo &info, double tick, const GyroData &gyro_data);
+
     //! 构造 GyroDecider
     static inline std::unique_ptr<GyroDecider> make_decider() { return std::make_unique<GyroDecider>(); }
 
@@ -62,6 +97,15 @@ private:
      */
     tracker::ptr getClosestTracker(group::ptr p_group, const PredictInfo &info);
 
+    /**
+     * @brief 选取目标序列组，优先选取上一帧的目标所在的序列组，否则选取优先级最高的序列组
+     *
+     * @param[in] groups 所有序列组
+     * @param[in] last_target 历史目标追踪器
+     * @return 目标序列组
+     */
+    group::ptr getTargetGroup(const std::vector<group::ptr> &groups, tracker::ptr last_target);
+
     /**
      * @brief 获取优先级最高的目标序列组
      *
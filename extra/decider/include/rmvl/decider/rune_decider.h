@@ -35,6 +35,8 @@ public:
     //! 构造 RuneDecider
     static inline std::unique_ptr<RuneDecider> make_decider() { return std::make_unique<RuneDecider>(); }
 
+    using decider::decide;
+
     /**
      * @brief 神符决策核心函数
      *
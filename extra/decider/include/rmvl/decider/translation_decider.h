@@ -28,6 +28,8 @@ public:
     //! 构造 TranslationDecider
     static inline std::unique_ptr<TranslationDecider> make_decider() { return std::make_unique<TranslationDecider>(); }
 
+    using decider::decide;
+
     /**
      * @brief 平移目标决策核心函数
      *
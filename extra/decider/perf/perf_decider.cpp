@@ -0,0 +1,136 @@
+/**
+ * @file perf_decider.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 决策模块基准测试
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include "rmvl/rmvl_modules.hpp"
+
+#ifdef HAVE_RMVL_GYRO_DECIDER
+
+#include <benchmark/benchmark.h>
+
+#include "rmvl/decider/gyro_decider.h"
+#ifdef HAVE_RMVL_GRAVITY_COMPENSATOR
+#include "rmvl/compensator/gravity_compensator.h"
+#endif // HAVE_RMVL_GRAVITY_COMPENSATOR
+
+namespace rm_test
+{
+
+//! 4 m 外以 1 m/s 平移、6 rad/s 旋转的目标
+static rm::ReaimInfo buildReaimInfo(bool follow_armor)
+{
+    rm::ReaimInfo info;
+    info.tick = 1;
+    info.center = {0, 0, 4000};
+    info.velocity = {1000, 0, 0};
+    if (follow_armor)
+    {
+        info.radius = {0, 0, -250};
+        info.rotspeed = 6;
+    }
+    info.offset = {0.5f, -1.2f};
+    info.valid = true;
+    return info;
+}
+
+// 1 kHz 控制频率下，每次调用推进 1 ms 并更新云台姿态
+static void gyro_decider_reaim(benchmark::State &state)
+{
+    const auto info = buildReaimInfo(state.range(0));
+    rm::GyroData gyro_data{};
+    double tick = info.tick;
+    for (auto _ : state)
+    {
+        tick += 1e-3;
+        gyro_data.rotation.yaw += 1e-3f;
+        benchmark::DoNotOptimize(rm::GyroDecider::reaim(info, tick, gyro_data));
+    }
+}
+
+BENCHMARK(gyro_decider_reaim)->Name("gyro decider reaim - follow armor")->Arg(1);
+BENCHMARK(gyro_decider_reaim)->Name("gyro decider reaim - center axis ")->Arg(0);
+
+#ifdef HAVE_RMVL_GRAVITY_COMPENSATOR
+
+//! 带有距离、相对转角信息的组合体
+class BenchCombo final : public rm::combo
+{
+public:
+    BenchCombo(float distance, float pitch, double tick)
+    {
+        _extrinsic.distance(distance);
+        _relative_angle = {0.f, pitch};
+        _tick = tick;
+    }
+
+    rm::combo::ptr clone(double tick) override
+    {
+        auto retval = std::make_shared<BenchCombo>(*this);
+        retval->_tick = tick;
+        return retval;
+    }
+};
+
+//! 不执行任何预测的预测模块，仅用于隔离补偿模块的开销
+class NullPredictor final : public rm::predictor
+{
+public:
+    rm::PredictInfo predict(const std::vector<rm::group::ptr> &, const rm::TrackerMap<rm::tracker::ptr, double> &) override { return {}; }
+};
+
+/**
+ * @brief 构建序列组，每个序列组包含 4 个追踪器，即 4 块装甲板
+ *
+ * @param[in] num 序列组数量，即机器人数量
+ */
+static std::vector<rm::group::ptr> buildRobots(int num)
+{
+    std::vector<rm::group::ptr> groups;
+    for (int i = 0; i < num; ++i)
+    {
+        auto p_group = rm::DefaultGroup::make_group();
+        for (int j = 0; j < 4; ++j)
+            p_group->add(rm::DefaultTracker::make_tracker(std::make_shared<BenchCombo>(3000.f + 1000.f * i + 50.f * j, -2.f, 0)));
+        groups.push_back(p_group);
+    }
+    return groups;
+}
+
+//! 每帧对所有序列组计算补偿信息
+static void decider_compensate_eager(benchmark::State &state)
+{
+    auto groups = buildRobots(static_cast<int>(state.range(0)));
+    rm::GravityCompensator com;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(com.compensate(groups, 25.f, rm::CompensateType::UNKNOWN));
+}
+
+//! 每帧仅对决策选中的序列组计算补偿信息
+static void decider_compensate_lazy(benchmark::State &state)
+{
+    auto groups = buildRobots(static_cast<int>(state.range(0)));
+    rm::GravityCompensator com;
+    NullPredictor pre;
+    for (auto _ : state)
+    {
+        rm::LazyInfo lazy_info(com, pre, 25.f);
+        lazy_info.require(groups.front());
+        benchmark::DoNotOptimize(lazy_info.compensateInfo());
+    }
+}
+
+BENCHMARK(decider_compensate_eager)->Name("decider compensate - eager")->DenseRange(1, 5);
+BENCHMARK(decider_compensate_lazy)->Name("decider compensate - lazy ")->DenseRange(1, 5);
+
+#endif // HAVE_RMVL_GRAVITY_COMPENSATOR
+
+} // namespace rm_test
+
+#endif // HAVE_RMVL_GYRO_DECIDER
@@ -11,6 +11,7 @@
 
 #include "rmvl/decider/gyro_decider.h"
 #include "rmvl/group/gyro_group.h"
+#include "rmvl/predictor/gyro_predictor.h"
 #include "rmvl/algorithm/transform.hpp"
 #include "rmvl/tracker/gyro_tracker.h"
 
@@ -36,6 +37,29 @@ GyroDecider::GyroDecider()
                  {RobotType::SENTRY, type_priority.at(8) - '0'}};
 }
 
+/**
+ * @brief 计算陀螺仪坐标系下的目标预测点
+ *
+ * @param[in] p_gyro_group 参考的 group
+ * @param[in] p_tracker 参考的 tracker
+ * @param[in] translation_dp 平移预测增量
+ * @param[in] rotangle 旋转预测角度增量
+ * @return 目标预测点 (3D)
+ */
+static cv::Vec3f predictPoint(GyroGroup::ptr p_gyro_group, tracker::const_ptr p_tracker, cv::Vec3f translation_dp, float rotangle)
+{
+    // 旋转预测增量的分量计算
+    float c = cos(rotangle), s = sin(rotangle);
+    const auto &tvec = p_tracker->getExtrinsics().tvec();
+    cv::Vec3f center2combo_pose = tvec - p_gyro_group->getCenter3D(); // 旋转中心到 combo 的向量
+    cv::Matx33f rot = {c, 0, s,
+                       0, 1, 0,
+                       -s, 0, c};
+    cv::Vec3f rotation_dp = rot * center2combo_pose - center2combo_pose;
+    // 运动合成，计算 3D 预测增量
+    return tvec + translation_dp + rotation_dp;
+}
+
 /**
  * @brief 计算预测量
  *
@@ -53,17 +77,7 @@ static void calcPrediction(group::ptr p_group, tracker::const_ptr p_tracker, cv:
     GyroGroup::ptr p_gyro_group = GyroGroup::cast(p_group);
     if (p_gyro_group == nullptr)
         RMVL_Error(RMVL_BadDynamicType, "Fail to cast the type of \"p_group\" to \"GyroGroup::ptr\"");
-    // 旋转预测增量的分量计算
-    float c = cos(rotangle), s = sin(rotangle);
-    const auto &tvec = p_tracker->getExtrinsics().tvec();
-    cv::Vec3f center2combo_pose = tvec - p_gyro_group->getCenter3D(); // 旋转中心到 combo 的向量
-    cv::Matx33f rot = {c, 0, s,
-                       0, 1, 0,
-                       -s, 0, c};
-    cv::Vec3f rotation_dp = rot * center2combo_pose - center2combo_pose;
-    // 运动合成，计算 3D 预测增量
-    cv::Vec3f motion_dp = translation_dp + rotation_dp;
-    cv::Vec3f motion_p = tvec + motion_dp;
+    cv::Vec3f motion_p = predictPoint(p_gyro_group, p_tracker, translation_dp, rotangle);
     // 陀螺仪坐标系转相机坐标系
     cv::Matx33f I = cv::Matx33f::eye();
     Armor::gyroConvertToCamera(I, motion_p, p_gyro_group->getGyroData(), I, motion_p);
@@ -77,6 +91,49 @@ static void calcPrediction(group::ptr p_group, tracker::const_ptr p_tracker, cv:
                p_tracker->getRelativeAngle();
 }
 
+/**
+ * @brief 计算陀螺仪坐标系下的目标点在指定云台姿态下的相对角度
+ * @note 不考虑相机畸变，与 `Armor::gyroConvertToCamera` 使用相同的旋转关系，不涉及动态内存分配
+ *
+ * @param[in] p 陀螺仪坐标系下的目标点
+ * @param[in] gyro_data 云台姿态
+ * @return 相对角度，目标在图像右方，point.x 为正，目标在图像下方，point.y 为正
+ */
+static inline cv::Point2f gyroToRelativeAngle(const cv::Vec3f &p, const GyroData &gyro_data)
+{
+    auto rot = euler2Mat(deg2rad(gyro_data.rotation.yaw), Y) * euler2Mat(deg2rad(-gyro_data.rotation.pitch), X);
+    cv::Vec3f cam = rot.t() * p;
+    return {rad2deg(std::atan2(cam(0), cam(2))), rad2deg(std::atan2(cam(1), cam(2)))};
+}
+
+/**
+ * @brief 按照 `ReaimInfo` 的运动状态外推陀螺仪坐标系下的期望目标点
+ *
+ * @param[in] info 重新瞄准所需的目标运动状态
+ * @param[in] dt 相对捕获时间点的时间增量 (s)
+ * @return 期望目标点 (mm)
+ */
+static inline cv::Vec3f reaimPoint(const ReaimInfo &info, float dt)
+{
+    float c = std::cos(info.rotspeed * dt), s = std::sin(info.rotspeed * dt);
+    const auto &r = info.radius;
+    return info.center + info.velocity * dt + cv::Vec3f(c * r(0) + s * r(2), r(1), -s * r(0) + c * r(2));
+}
+
+/**
+ * @brief 根据补偿量更新射击中心以及能否射击
+ *
+ * @param[in] comp 目标追踪器的补偿量
+ * @param[in out] info 决策信息
+ */
+static void updateShootState(const cv::Point2f &comp, DecideInfo &info)
+{
+    // 将补偿的角度换算为坐标点
+    info.shoot_center = calculateRelativeCenter(para::camera_param.cameraMatrix, -comp);
+    info.can_shoot = getDistance(info.exp_center2d, info.shoot_center) <=
+                     para::gyro_decider_param.NORMAL_RADIUS_RATIO * info.target->front()->getHeight();
+}
+
 /**
  * @brief 计算高速状态下的基础响应
  *
@@ -115,17 +172,7 @@ DecideInfo GyroDecider::decide(const std::vector<group::ptr> &groups, RMStatus,
     if (groups.empty() || groups.front()->data().empty())
         return info;
     // -------------------------【选择目标序列组】-------------------------
-    // 初始化目标序列组
-    group::ptr target_group = nullptr;
-    // 若上一帧有目标序列组，将上一帧目标序列组作为目标
-    if (last_target != nullptr)
-        for (const auto &p_group : groups)
-            for (const auto &p_tracker : p_group->data())
-                if (p_tracker == last_target)
-                    target_group = p_group;
-    // 当目标没有被锁定或目标序列组不存在，按数字决策顺序选择目标
-    if (!target_group)
-        target_group = getHighestPriorityGroup(groups);
+    group::ptr target_group = getTargetGroup(groups, last_target);
 
     // ------------------------【选择目标追踪器】------------------------
     // 目标追踪器
@@ -193,19 +240,69 @@ DecideInfo GyroDecider::decide(const std::vector<group::ptr> &groups, RMStatus,
             info.exp_center3d = shoot_p3d;
         }
 
-        // 判断能否进行射击
-        if (info.target != nullptr)
+        // 记录重新瞄准所需的目标运动状态，高速状态瞄准中轴线，不跟随装甲板旋转
+        auto p_gyro_group = GyroGroup::cast(target_group);
+        auto &reaim = info.reaim;
+        reaim.tick = info.target->front()->getTick();
+        reaim.center = p_gyro_group->getCenter3D() + tdKt + tdB;
+        reaim.velocity = p_gyro_group->getSpeed3D();
+        if (rot_status == RotStatus::LOW_ROT_SPEED)
         {
-            // 将补偿的角度换算为坐标点
-            info.shoot_center = calculateRelativeCenter(para::camera_param.cameraMatrix, -comp);
-            if (getDistance(info.exp_center2d, info.shoot_center) <=
-                para::gyro_decider_param.NORMAL_RADIUS_RATIO * info.target->front()->getHeight())
-                info.can_shoot = true;
+            reaim.radius = predictPoint(p_gyro_group, info.target, tdKt + tdB, pKt(ANG_Y) + pB(ANG_Y)) - reaim.center;
+            reaim.rotspeed = p_gyro_group->getRotatedSpeed();
         }
+        reaim.offset = info.exp_angle - gyroToRelativeAngle(reaim.center + reaim.radius, p_gyro_group->getGyroData());
+        reaim.valid = true;
+
+        // 判断能否进行射击
+        updateShootState(comp, info);
     }
     return info;
 }
 
+DecideInfo GyroDecider::decide(const std::vector<group::ptr> &groups, RMStatus flag,
+                               tracker::ptr last_target, const DetectInfo &detect_info, LazyInfo &lazy_info)
+{
+    if (groups.empty() || groups.front()->data().empty())
+        return {};
+    // 仅对目标序列组请求补偿、预测信息
+    auto target_group = getTargetGroup(groups, last_target);
+    lazy_info.require(target_group);
+    auto info = decide(groups, flag, last_target, detect_info, lazy_info.compensateInfo(), lazy_info.predictInfo());
+    if (info.target == nullptr || !info.reaim.valid)
+        return info;
+    // 预测与弹道的联合解算，使用命中时刻预测位置对应的补偿替换以当前位置计算的补偿
+    // `ReaimInfo` 已包含按当前飞行时间、延迟外推的预测量，因此运动模型需从序列组未经预测的状态开始外推
+    double latency = lazy_info.latency();
+    auto aim_info = lazy_info.aim([&](double t) { return GyroPredictor::motion(target_group, info.target, t, latency); });
+    if (!aim_info.converged)
+        return info;
+    cv::Point2f delta = aim_info.compensation - lazy_info.compensateInfo().compensation.at(info.target);
+    info.exp_angle += delta;
+    info.reaim.offset += delta;
+    updateShootState(aim_info.compensation, info);
+    return info;
+}
+
+cv::Point2f GyroDecider::reaim(const ReaimInfo &info, double tick, const GyroData &gyro_data)
+{
+    if (!info.valid)
+        return {};
+    return gyroToRelativeAngle(reaimPoint(info, static_cast<float>(tick - info.tick)), gyro_data) + info.offset;
+}
+
+group::ptr GyroDecider::getTargetGroup(const std::vector<group::ptr> &groups, tracker::ptr last_target)
+{
+    // 若上一帧有目标序列组，将上一帧目标序列组作为目标
+    if (last_target != nullptr)
+        for (const auto &p_group : groups)
+            for (const auto &p_tracker : p_group->data())
+                if (p_tracker == last_target)
+                    return p_group;
+    // 当目标没有被锁定或目标序列组不存在，按数字决策顺序选择目标
+    return getHighestPriorityGroup(groups);
+}
+
 tracker::ptr GyroDecider::getClosestTracker(group::ptr p_group, const PredictInfo &info)
 {
     if (p_group == nullptr)
@@ -0,0 +1,197 @@
+/**
+ * @file test_gyro_decider.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 装甲板决策模块单元测试
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include "rmvl/rmvl_modules.hpp"
+
+#ifdef HAVE_RMVL_GYRO_DECIDER
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include <opencv2/calib3d.hpp>
+
+#include "rmvl/algorithm/transform.hpp"
+#include "rmvl/core/timer.hpp"
+#include "rmvl/decider/gyro_decider.h"
+#include "rmvl/compensator/gravity_compensator.h"
+#include "rmvl/group/gyro_group.h"
+#include "rmvl/predictor/gyro_predictor.h"
+#include "rmvl/tracker/gyro_tracker.h"
+
+#include "rmvlpara/camera/camera.h"
+#include "rmvlpara/combo/armor.h"
+
+namespace rm_test
+{
+
+class GyroDeciderTest : public testing::Test
+{
+    std::vector<cv::Point3f> world_points;
+
+    void SetUp() override
+    {
+        world_points = {{-67, 27, -7},
+                        {-67, -27, 7},
+                        {67, -27, 7},
+                        {67, 27, -7}};
+        rm::para::camera_param.cameraMatrix = {1250, 0, 640,
+                                               0, 1250, 512,
+                                               0, 0, 1};
+        rm::para::camera_param.distCoeffs = cv::Matx51f::zeros();
+        rm::para::armor_param.SMALL_ARMOR = world_points;
+    }
+
+public:
+    /**
+     * @brief 构建装甲板
+     *
+     * @param[in] tvec 平移向量
+     * @param[in] angle 绕 Y 轴旋转的角度（角度制）
+     * @param[in] gyro_data 云台姿态
+     * @param[in] tick 捕获时间点
+     * @return combo::ptr
+     */
+    rm::combo::ptr createArmor(cv::Vec3f tvec, float angle, const rm::GyroData &gyro_data, double tick = rm::Timer::now())
+    {
+        auto rmat = rm::euler2Mat(rm::deg2rad(angle), rm::Y);
+        cv::Vec3f rvec;
+        cv::Rodrigues(rmat, rvec);
+        std::vector<cv::Point2f> image_points;
+        cv::projectPoints(world_points, rvec, tvec, rm::para::camera_param.cameraMatrix,
+                          rm::para::camera_param.distCoeffs, image_points);
+        auto p_left = rm::LightBlob::make_feature(image_points[1], image_points[0], 10);
+        auto p_right = rm::LightBlob::make_feature(image_points[2], image_points[3], 10);
+        return rm::Armor::make_combo(p_left, p_right, gyro_data, tick, rm::ArmorSizeType::SMALL);
+    }
+};
+
+// 以决策所用的时间点和云台姿态重新瞄准，结果与决策得到的期望角度一致
+TEST_F(GyroDeciderTest, reaim_reproduces_exp_angle)
+{
+    rm::GyroData gyro_data{};
+    gyro_data.rotation.yaw = 5.f;
+    gyro_data.rotation.pitch = -2.f;
+    auto p_group = rm::GyroGroup::make_group({createArmor({300, -50, 3000}, -20, gyro_data)}, 4);
+    std::vector<rm::group::ptr> groups{p_group};
+
+    rm::CompensateInfo compensate_info;
+    rm::PredictInfo predict_info;
+    cv::Vec<double, 9> dp{};
+    dp(rm::POS_X) = 40, dp(rm::POS_Z) = -20;
+    for (const auto &p_tracker : p_group->data())
+    {
+        compensate_info.compensation[p_tracker] = {0.3f, -1.2f};
+        compensate_info.tof[p_tracker] = 0.12;
+        predict_info.static_prediction[p_tracker] = dp;
+        predict_info.dynamic_prediction[p_tracker] = dp;
+        predict_info.shoot_delay_prediction[p_tracker] = {};
+    }
+
+    rm::GyroDecider decider;
+    auto info = decider.decide(groups, rm::RMStatus{}, nullptr, rm::DetectInfo{}, compensate_info, predict_info);
+    ASSERT_NE(info.target, nullptr);
+    ASSERT_TRUE(info.reaim.valid);
+    auto angle = rm::GyroDecider::reaim(info.reaim, info.reaim.tick, p_group->getGyroData());
+    EXPECT_NEAR(angle.x, info.exp_angle.x, 1e-3);
+    EXPECT_NEAR(angle.y, info.exp_angle.y, 1e-3);
+    // 不可用的运动状态返回零偏移量
+    info.reaim.valid = false;
+    EXPECT_EQ(rm::GyroDecider::reaim(info.reaim, info.reaim.tick, p_group->getGyroData()), cv::Point2f());
+}
+
+// yaw 与 Y 轴欧拉角方向相同：目标在右方时 yaw 偏移量为正，云台转向目标后偏移量归零
+TEST_F(GyroDeciderTest, reaim_yaw_sign)
+{
+    rm::ReaimInfo info;
+    info.tick = 1;
+    info.center = {1000, 0, 4000};
+    info.velocity = {500, 0, 0};
+    info.valid = true;
+
+    rm::GyroData gyro_data{};
+    auto angle = rm::GyroDecider::reaim(info, info.tick, gyro_data);
+    EXPECT_NEAR(angle.x, rm::rad2deg(std::atan2(1000.f, 4000.f)), 1e-3);
+    EXPECT_NEAR(angle.y, 0, 1e-3);
+    // 目标向右平移，yaw 偏移量增大
+    EXPECT_GT(rm::GyroDecider::reaim(info, info.tick + 0.1, gyro_data).x, angle.x);
+    // 云台向右转过相同的角度
+    gyro_data.rotation.yaw = angle.x;
+    EXPECT_NEAR(rm::GyroDecider::reaim(info, info.tick, gyro_data).x, 0, 1e-3);
+    // 云台转过头，目标位于左方
+    gyro_data.rotation.yaw = angle.x + 5;
+    EXPECT_NEAR(rm::GyroDecider::reaim(info, info.tick, gyro_data).x, -5, 1e-3);
+}
+
+/**
+ * @brief 运动目标的按需决策与联合解算：目标沿 X 轴平移并远离相机，联合解算的运动模型应从序列组未经预测的状态外推，
+ *        结果与按照 `GyroPredictor::motion` 直接进行联合解算、再替换完整决策中的补偿量一致
+ */
+TEST_F(GyroDeciderTest, lazy_aim_moving_target)
+{
+    constexpr float shoot_speed = 25.f;
+    rm::GyroData gyro_data{};
+    const cv::Vec3f velocity = {800, 0, 600}; // mm/s
+    double tick = 100;
+    auto p_group = rm::GyroGroup::make_group({createArmor({300, -50, 3000}, -20, gyro_data, tick)}, 4);
+    // 以 100 Hz 更新可见的追踪器，建立序列组的平移速度
+    for (int i = 1; i <= 30; ++i)
+    {
+        tick += 0.01;
+        auto p_armor = createArmor(cv::Vec3f(300, -50, 3000) + velocity * (0.01f * i), -20, gyro_data, tick);
+        rm::tracker::ptr visible{};
+        float min_dis = std::numeric_limits<float>::max();
+        for (const auto &p_tracker : p_group->data())
+        {
+            float dis = static_cast<float>(cv::norm(p_tracker->getExtrinsics().tvec() - p_armor->getExtrinsics().tvec()));
+            if (dis < min_dis)
+                min_dis = dis, visible = p_tracker;
+        }
+        for (const auto &p_tracker : p_group->data())
+        {
+            auto p_gyro_tracker = rm::GyroTracker::cast(p_tracker);
+            if (p_tracker == visible)
+                p_gyro_tracker->update(p_armor), p_gyro_tracker->updateVanishState(rm::GyroTracker::APPEAR);
+            else
+                p_gyro_tracker->updateVanishState(rm::GyroTracker::VANISH);
+        }
+        p_group->sync(gyro_data, tick);
+    }
+    ASSERT_GT(cv::norm(p_group->getSpeed3D()), 100);
+    std::vector<rm::group::ptr> groups{p_group};
+
+    rm::GravityCompensator com;
+    rm::GyroPredictor pre;
+    pre.latency().update(0, 0.02);
+    rm::GyroDecider decider;
+    // 完整决策：以当前位置计算补偿
+    auto com_info = com.compensate(groups, shoot_speed, rm::CompensateType::UNKNOWN);
+    auto pre_info = pre.predict(groups, com_info.tof);
+    auto eager = decider.decide(groups, rm::RMStatus{}, nullptr, rm::DetectInfo{}, com_info, pre_info);
+    // 按需决策：以命中时刻的预测位置计算补偿
+    rm::LazyInfo lazy_info(com, pre, shoot_speed);
+    auto lazy = decider.decide(groups, rm::RMStatus{}, nullptr, rm::DetectInfo{}, lazy_info);
+    ASSERT_NE(eager.target, nullptr);
+    ASSERT_EQ(lazy.target, eager.target);
+
+    auto joint = com.aim([&](double t) { return rm::GyroPredictor::motion(p_group, eager.target, t, pre.latency().value()); }, shoot_speed);
+    ASSERT_TRUE(joint.converged);
+    cv::Point2f expected = eager.exp_angle + (joint.compensation - com_info.compensation.at(eager.target));
+    EXPECT_NEAR(lazy.exp_angle.x, expected.x, 1e-3);
+    EXPECT_NEAR(lazy.exp_angle.y, expected.y, 1e-3);
+    // 命中位置为子弹飞行 tof 后的预测位置，而非在预测量的基础上再次外推
+    auto hit = rm::GyroPredictor::motion(p_group, eager.target, joint.tof, pre.latency().value());
+    EXPECT_LT(cv::norm(joint.position - hit), 1.0);
+}
+
+} // namespace rm_test
+
+#endif // HAVE_RMVL_GYRO_DECIDER
@@ -72,9 +72,11 @@ private:
      * @param[in] src 预处理之后的图像
      * @param[out] features 找到的特征列表
      * @param[out] combos 找到的组合体列表
-     * @param[out] rois 找到的组合体对应的 ROI 列表
+     * @param[out] rois 找到的组合体对应的 ROI 列表，降级处理时沿用追踪器类型的组合体对应空的 ROI
+     * @param[in] tracked 降级处理时用于沿用已追踪目标类型的序列组容器，为 `nullptr` 时对所有装甲板进行分类
      */
-    void find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos, std::vector<cv::Mat> &rois);
+    void find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos,
+              std::vector<cv::Mat> &rois, const std::vector<group::ptr> *tracked = nullptr);
 
     /**
      * @brief 匹配、更新时间序列
@@ -11,9 +11,12 @@
 
 #pragma once
 
+#include <opencv2/imgproc.hpp>
+
 #include "rmvl/group/group.h"
 
 #include "rmvl/algorithm/pretreat.hpp"
+#include "rmvl/core/deadline.hpp"
 
 namespace rm
 {
@@ -38,14 +41,106 @@ struct DetectInfo
 
     std::vector<combo::ptr> combos;     //!< 当前帧所有组合体
     std::vector<feature::ptr> features; //!< 当前帧所有特征
+
+    bool degraded{}; //!< 当前帧是否因超出截止时间而降级处理
 };
 
 //! 识别检测模块
 class detector
 {
 protected:
-    double _tick;        //!< 每一帧对应的时间点
-    GyroData _gyro_data; //!< 每一帧对应的陀螺仪数据
+    double _tick;               //!< 每一帧对应的时间点
+    GyroData _gyro_data;        //!< 每一帧对应的陀螺仪数据
+    FrameDeadline *_deadline{}; //!< 帧截止时间策略
+
+    /**
+     * @brief 当前帧是否已超出降级处理的帧龄
+     * @note 未设置帧截止时间策略时始终返回 `false`
+     */
+    inline bool overdue() const { return _deadline != nullptr && _deadline->check(_tick) != FrameAction::Process; }
+
+    /**
+     * @brief 获取覆盖所有追踪器的感兴趣区域，用于降级处理时缩小识别范围
+     *
+     * @param[in] groups 序列组容器
+     * @param[in] size 图像尺寸
+     * @return 各追踪器外接矩形向四周各扩展 1 倍宽、高后的并集，不存在追踪器时返回整幅图像
+     */
+    static cv::Rect trackedROI(const std::vector<group::ptr> &groups, cv::Size size)
+    {
+        cv::Rect full(cv::Point(), size), roi;
+        for (const auto &p_group : groups)
+        {
+            for (const auto &p_tracker : p_group->data())
+            {
+                const auto &corners = p_tracker->getCorners();
+                if (corners.empty())
+                    continue;
+                auto rect = cv::boundingRect(corners);
+                rect -= cv::Point(rect.width, rect.height);
+                rect += cv::Size(2 * rect.width, 2 * rect.height);
+                roi = roi.empty() ? rect : (roi | rect);
+            }
+        }
+        return roi.empty() ? full : (roi & full);
+    }
+
+    /**
+     * @brief 获取与组合体对应的已知类型的追踪器，用于降级处理时跳过对已追踪目标的分类
+     *
+     * @param[in] groups 序列组容器
+     * @param[in] p_combo 组合体
+     * @return 中心点距离在组合体宽度一半以内、最近且类型已知的追踪器，不存在时返回 `nullptr`
+     */
+    static tracker::ptr trackedBy(const std::vector<group::ptr> &groups, combo::const_ptr p_combo)
+    {
+        tracker::ptr retval{};
+        float min_dis = p_combo->getWidth() / 2.f;
+        for (const auto &p_group : groups)
+        {
+            for (const auto &p_tracker : p_group->data())
+            {
+                if (p_tracker->getType().RobotTypeID == RobotType::UNKNOWN)
+                    continue;
+                float dis = getDistance(p_tracker->getCenter(), p_combo->getCenter());
+                if (dis < min_dis)
+                {
+                    min_dis = dis;
+                    retval = p_tracker;
+                }
+            }
+        }
+        return retval;
+    }
+
+    /**
+     * @brief 获取组合体的 ROI 并进行分类，降级处理时已追踪的组合体沿用追踪器的类型，不再调用分类函数
+     *
+     * @param[in] combos 待分类的组合体，需提供 `setType(RobotType)` 方法
+     * @param[out] rois 与 `combos` 一一对应的 ROI 列表，沿用追踪器类型的组合体对应空的 ROI
+     * @param[in] tracked 降级处理时用于沿用已追踪目标类型的序列组容器，为 `nullptr` 时对所有组合体进行分类
+     * @param[in] classify 分类函数，以组合体为参数，返回 `std::pair<cv::Mat, RobotType>`，即 ROI 与分类结果
+     */
+    template <typename ComboPtr, typename Classify>
+    static void classifyCombos(const std::vector<ComboPtr> &combos, std::vector<cv::Mat> &rois,
+                               const std::vector<group::ptr> *tracked, Classify &&classify)
+    {
+        rois.clear();
+        rois.reserve(combos.size());
+        for (const auto &p_combo : combos)
+        {
+            tracker::ptr p_tracker = tracked != nullptr ? trackedBy(*tracked, p_combo) : nullptr;
+            if (p_tracker != nullptr)
+            {
+                p_combo->setType(p_tracker->getType().RobotTypeID);
+                rois.emplace_back();
+                continue;
+            }
+            auto [roi, type] = classify(p_combo);
+            p_combo->setType(type);
+            rois.emplace_back(std::move(roi));
+        }
+    }
 
 public:
     using ptr = std::unique_ptr<detector>;
@@ -54,6 +149,16 @@ public:
 
     virtual ~detector() = default;
 
+    /**
+     * @brief 设置帧截止时间策略
+     * @note
+     * - 帧龄超过降级处理的阈值时，识别模块会缩小识别范围至已追踪目标附近，并跳过对已追踪目标的分类
+     * - 丢帧与统计量的记录由调用方完成，参考 `rm::FrameDeadline`
+     *
+     * @param[in] deadline 帧截止时间策略，为 `nullptr` 时关闭降级处理
+     */
+    inline void setDeadline(FrameDeadline *deadline) { _deadline = deadline; }
+
     /**
      * @brief 识别接口
      *
@@ -80,12 +80,20 @@ private:
      * @param[in] src 预处理之后的图像
      * @param[out] features 找到的特征列表
      * @param[out] combos 找到的组合体列表
-     * @param[out] rois 找到的组合体对应的 ROI 列表
+     * @param[out] rois 找到的组合体对应的 ROI 列表，降级处理时沿用追踪器类型的组合体对应空的 ROI
+     * @param[in] tracked 降级处理时用于沿用已追踪目标类型的序列组容器，为 `nullptr` 时对所有装甲板进行分类
      */
-    void find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos, std::vector<cv::Mat> &rois);
+    void find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos,
+              std::vector<cv::Mat> &rois, const std::vector<group::ptr> *tracked = nullptr);
 
     /**
      * @brief 匹配、更新时间序列
+     * @note
+     * - 装甲板分配至各序列组后，各序列组的追踪器更新与同步通过 `cv::parallel_for_` 并行执行，序列组的顺序与串行执行一致
+     * @note
+     * - 某个序列组在追踪器更新阶段抛出异常时，其余序列组均已完成更新与同步，随后按序列组的顺序重新抛出第一个异常，
+     *   此时 `groups` 中的序列组均已被更新，但不会删除同步失败的序列组；而串行执行会在出错的序列组处停止，
+     *   其后的序列组保持不变
      *
      * @param[in] groups 所有序列组
      * @param[in] combos 每一帧的所有目标
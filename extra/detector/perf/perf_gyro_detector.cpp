@@ -0,0 +1,72 @@
+/**
+ * @file perf_gyro_detector.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 整车状态识别模块基准测试
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include "rmvl/rmvl_modules.hpp"
+
+#ifdef HAVE_RMVL_GYRO_DETECTOR
+
+#include <benchmark/benchmark.h>
+
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include "rmvl/detector/gyro_detector.h"
+
+namespace rm_test
+{
+
+/**
+ * @brief 绘制多机器人场景：每个机器人露出一块装甲板，沿水平方向等间距排列
+ *
+ * @param[in] robots 机器人数量
+ * @param[in] shift 整体水平偏移，用于模拟连续帧中目标的移动
+ * @return 场景图像
+ */
+static cv::Mat buildScene(int robots, int shift)
+{
+    cv::Mat src = cv::Mat::zeros(cv::Size(1920, 1080), CV_8UC3);
+    for (int i = 0; i < robots; ++i)
+    {
+        cv::Point center(160 + 260 * i + shift, 540);
+        for (int dx : {-60, 60})
+            cv::line(src, center + cv::Point(dx, -25), center + cv::Point(dx, 25), cv::Scalar(0, 0, 255), 8);
+    }
+    return src;
+}
+
+/**
+ * @brief 连续帧的多机器人场景识别，参数依次为机器人数量、OpenCV 线程数
+ * @note 线程数为 `1` 时序列组的同步与追踪器的更新串行执行，可作为对照
+ */
+void gyro_detector_multi_robot(benchmark::State &state)
+{
+    int robots = static_cast<int>(state.range(0));
+    int threads = cv::getNumThreads();
+    cv::setNumThreads(static_cast<int>(state.range(1)));
+    cv::Mat frames[2] = {buildScene(robots, 0), buildScene(robots, 2)};
+    auto p_detector = rm::GyroDetector::make_detector(4);
+    std::vector<rm::group::ptr> groups;
+    double tick{};
+    std::size_t idx{};
+    for (auto _ : state)
+    {
+        auto info = p_detector->detect(groups, frames[idx++ % 2], rm::RED, rm::GyroData(), tick += 0.01);
+        benchmark::DoNotOptimize(info);
+    }
+    state.counters["groups"] = static_cast<double>(groups.size());
+    cv::setNumThreads(threads);
+}
+
+BENCHMARK(gyro_detector_multi_robot)->ArgsProduct({{1, 3, 5, 7}, {1, 4}})->Unit(benchmark::kMicrosecond);
+
+} // namespace rm_test
+
+#endif // HAVE_RMVL_GYRO_DETECTOR
@@ -19,7 +19,8 @@
 namespace rm
 {
 
-void ArmorDetector::find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos, std::vector<cv::Mat> &rois)
+void ArmorDetector::find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos,
+                         std::vector<cv::Mat> &rois, const std::vector<group::ptr> *tracked)
 {
     // ----------------------- light_blob -----------------------
     // 找到所有灯条
@@ -33,18 +34,14 @@ void ArmorDetector::find(cv::Mat &src, std::vector<feature::ptr> &features, std:
         std::vector<Armor::ptr> armors = findArmors(blobs);
         if (_ort)
         {
-            rois.clear();
-            rois.reserve(armors.size());
-            for (const auto &armor : armors)
-            {
+            classifyCombos(armors, rois, tracked, [&](const Armor::ptr &armor) {
                 cv::Mat roi = Armor::getNumberROI(src, armor);
                 PreprocessOptions preop;
                 preop.means = {para::armor_detector_param.MODEL_MEAN};
                 preop.stds = {para::armor_detector_param.MODEL_STD};
                 int idx = ClassificationNet::cast(_ort->inference({roi}, preop, {})).first;
-                armor->setType(_robot_t[idx]);
-                rois.emplace_back(roi);
-            }
+                return std::make_pair(roi, _robot_t[idx]);
+            });
             // eraseFakeArmors(armors);
         }
         else
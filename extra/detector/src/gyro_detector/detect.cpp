@@ -29,10 +29,19 @@ DetectInfo GyroDetector::detect(std::vector<group::ptr> &groups, cv::Mat &src, P
     // 二值化处理图像
     PixChannel ch_minus = color == RED ? BLUE : RED;
     int thesh = color == RED ? para::gyro_detector_param.GRAY_THRESHOLD_RED : para::gyro_detector_param.GRAY_THRESHOLD_BLUE;
-    info.bin = binary(info.src, color, ch_minus, thesh);
+    info.degraded = overdue();
+    if (info.degraded)
+    {
+        // 降级处理：仅在已追踪目标附近识别
+        cv::Rect roi = trackedROI(groups, src.size());
+        info.bin = cv::Mat::zeros(src.size(), CV_8UC1);
+        binary(src(roi), color, ch_minus, thesh).copyTo(info.bin(roi));
+    }
+    else
+        info.bin = binary(src, color, ch_minus, thesh);
 
-    // 找到所有的灯条和装甲板
-    find(info.bin, info.features, info.combos, info.rois);
+    // 找到所有的灯条和装甲板，降级处理时跳过已追踪目标的分类
+    find(info.bin, info.features, info.combos, info.rois, info.degraded ? &groups : nullptr);
     // 将目标匹配进序列组
     match(groups, info.combos);
     return info;
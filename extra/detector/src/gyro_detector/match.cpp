@@ -9,6 +9,10 @@
  *
  */
 
+#include <exception>
+
+#include <opencv2/core/utility.hpp>
+
 #include "rmvl/detector/gyro_detector.h"
 #include "rmvl/group/gyro_group.h"
 #include "rmvl/algorithm/datastruct.hpp"
@@ -109,6 +113,8 @@ void GyroDetector::match(std::vector<group::ptr> &groups, std::vector<combo::ptr
     // groups 非空，进行更新操作
     else
     {
+        // 各序列组匹配到的装甲板，在并行更新阶段完成追踪器的更新 [序列组:装甲板列表]
+        std::unordered_map<group::ptr, std::vector<combo::ptr>> assigned;
         // 装甲板集合代表元素对应的序列组中轴线坐标 [代表元素:旋转中心点]
         std::unordered_map<combo::const_ptr, cv::Point3f> groups_center;
         // 遍历装甲板组，构建 groups_center
@@ -151,7 +157,7 @@ void GyroDetector::match(std::vector<group::ptr> &groups, std::vector<combo::ptr
                     return getDistance(groups_center[lhs], cv::Point3f(p_gyro_group->getCenter3D())) <
                            getDistance(groups_center[rhs], cv::Point3f(p_gyro_group->getCenter3D()));
                 });
-                matchOneGroup(p_group, combo_maps[min_it]);
+                assigned[p_group] = combo_maps[min_it];
                 represent_set.erase(min_it);
             }
             // 没有匹配到的装甲板组作为新的序列
@@ -176,12 +182,12 @@ void GyroDetector::match(std::vector<group::ptr> &groups, std::vector<combo::ptr
                     return getDistance(groups_center[combo_map.first], cv::Point3f(lhs->getCenter3D())) <
                            getDistance(groups_center[combo_map.first], cv::Point3f(rhs->getCenter3D()));
                 });
-                matchOneGroup(*min_it, combo_map.second);
+                assigned[*min_it] = combo_map.second;
                 group_set.erase(*min_it);
             }
             // 没有匹配到的序列组传入空集合
             for (const auto &p_group : group_set)
-                matchOneGroup(p_group, {});
+                assigned[p_group] = {};
         }
         // combo_maps = groups
         else
@@ -207,34 +213,54 @@ void GyroDetector::match(std::vector<group::ptr> &groups, std::vector<combo::ptr
                 if (min_dis > para::gyro_detector_param.MAX_GROUP_DELTA_DIS)
                 {
                     // 创建新序列，原来的序列组打入 nullptr
-                    matchOneGroup(p_gyro_group, {});
+                    assigned[p_gyro_group] = {};
                     // 没有匹配到的装甲板作为新的序列组
                     groups.emplace_back(GyroGroup::make_group(combo_maps.at(min_it), _armor_num));
                 }
                 else
-                    matchOneGroup(p_gyro_group, combo_maps[min_it]);
+                    assigned[p_gyro_group] = combo_maps[min_it];
                 represent_set.erase(min_it);
             }
         }
-        // 为所有序列组进行同步，并记录出现异常的 group
-        std::unordered_set<group::const_ptr> remove_set;
-        for (const auto &p_group : groups)
-        {
-            try
-            {
-                p_group->sync(_gyro_data, _tick);
-            }
-            catch (const rm::Exception &e)
+        // 完成装甲板与序列组的匹配后，各序列组相互独立，并行更新追踪器并同步序列组，并记录出现异常的 group
+        std::vector<std::exception_ptr> match_errors(groups.size());
+        std::vector<char> sync_failed(groups.size());
+        cv::parallel_for_(cv::Range(0, static_cast<int>(groups.size())), [&](const cv::Range &range) {
+            for (int i = range.start; i < range.end; ++i)
             {
-                ERROR_("Occurred an exception! %s", e.err.c_str());
-                remove_set.insert(p_group);
+                const auto &p_group = groups[i];
+                auto it = assigned.find(p_group);
+                try
+                {
+                    if (it != assigned.end())
+                        matchOneGroup(p_group, it->second);
+                }
+                catch (...)
+                {
+                    match_errors[i] = std::current_exception();
+                    continue;
+                }
+                try
+                {
+                    p_group->sync(_gyro_data, _tick);
+                }
+                catch (const rm::Exception &e)
+                {
+                    ERROR_("Occurred an exception! %s", e.err.c_str());
+                    sync_failed[i] = true;
+                }
             }
-        }
+        });
+        // 按序列组的顺序抛出匹配阶段的第一个异常，抛出的异常与串行执行相同，但此时其余序列组均已完成更新与同步
+        for (const auto &e : match_errors)
+            if (e)
+                std::rethrow_exception(e);
         // 删除异常 group
-        groups.erase(remove_if(groups.begin(), groups.end(), [&remove_set](group::const_ptr val) {
-                         return remove_set.find(val) != remove_set.end();
-                     }),
-                     groups.end());
+        std::size_t remain{};
+        for (std::size_t i = 0; i < groups.size(); ++i)
+            if (!sync_failed[i])
+                groups[remain++] = groups[i];
+        groups.resize(remain);
     }
     // 删除四个 tracker 同时消失数量过多的 group
     groups.erase(remove_if(groups.begin(), groups.end(), [](group::const_ptr p_group) {
@@ -13,6 +13,8 @@
 
 #ifdef HAVE_RMVL_ARMOR_DETECTOR
 
+#include "rmvl/tracker/planar_tracker.h"
+
 #include "armor_detector_test.h"
 
 using namespace rm;
@@ -148,6 +150,51 @@ TEST_F(ArmorDetectorTest, more_armor_disturb)
     EXPECT_EQ(info.combos.size(), 2);
 }
 
+//! 暴露识别模块的分类流程
+class ClassifyDetector : public rm::detector
+{
+public:
+    using detector::classifyCombos;
+
+    DetectInfo detect(std::vector<group::ptr> &, cv::Mat &, PixChannel, const GyroData &, double) override { return {}; }
+};
+
+// 降级处理时仅对未追踪的装甲板分类，已追踪的装甲板沿用追踪器的类型，ROI 与装甲板保持一一对应
+TEST_F(ArmorDetectorTest, degraded_classify_tracked_and_untracked)
+{
+    buildArmorImg(cv::Point(300, 500), 5);
+    buildArmorImg(cv::Point(900, 500), -5);
+    auto info = p_detector->detect(groups, src, RED, GyroData(), Timer::now());
+    ASSERT_EQ(info.combos.size(), 2);
+    std::vector<Armor::ptr> armors;
+    for (const auto &p_combo : info.combos)
+        armors.push_back(Armor::cast(p_combo));
+    // 仅第 1 个装甲板已被追踪
+    armors[0]->setType(RobotType::HERO);
+    auto p_group = DefaultGroup::make_group();
+    p_group->add(PlanarTracker::make_tracker(armors[0]));
+    std::vector<group::ptr> tracked{p_group};
+
+    std::size_t calls{};
+    auto classify = [&](const Armor::ptr &) {
+        ++calls;
+        return std::make_pair(cv::Mat(cv::Mat::ones(28, 28, CV_8UC1)), RobotType::INFANTRY_3);
+    };
+    std::vector<cv::Mat> rois;
+    ClassifyDetector::classifyCombos(armors, rois, &tracked, classify);
+    EXPECT_EQ(calls, 1u);
+    ASSERT_EQ(rois.size(), armors.size());
+    EXPECT_TRUE(rois[0].empty());
+    EXPECT_FALSE(rois[1].empty());
+    EXPECT_EQ(armors[0]->getType().RobotTypeID, RobotType::HERO);
+    EXPECT_EQ(armors[1]->getType().RobotTypeID, RobotType::INFANTRY_3);
+    // 非降级处理时对所有装甲板分类
+    ClassifyDetector::classifyCombos(armors, rois, nullptr, classify);
+    EXPECT_EQ(calls, 3u);
+    EXPECT_EQ(rois.size(), armors.size());
+    EXPECT_EQ(armors[0]->getType().RobotTypeID, RobotType::INFANTRY_3);
+}
+
 } // namespace rm_test
 
 #endif 
@@ -22,6 +22,7 @@
 #include <rmvl/rmvl_modules.hpp>
 
 #include "group/group.h"
+#include "group/snapshot.h"
 
 #ifdef HAVE_RMVL_GYRO_GROUP
 #include "group/gyro_group.h"
@@ -41,6 +41,17 @@ public:
      */
     virtual ptr clone() = 0;
 
+    /**
+     * @brief 以给定的追踪器快照创建序列组的快照
+     * @note
+     * - 拷贝序列组自身的状态，并将内部的追踪器替换为 `trackers`，参考 `rm::GroupSnapshotPublisher`
+     * - 派生类应以拷贝构造实现，避免复制追踪器
+     *
+     * @param[in] trackers 与 `data()` 一一对应的追踪器快照
+     * @return 指向快照的共享指针
+     */
+    virtual ptr snapshot(const std::vector<tracker::ptr> &trackers) const = 0;
+
     /**
      * @brief 序列组同步操作
      * @note 根据当前已知的所有的 `tracker` 信息，同步整体 `group`
@@ -70,6 +81,9 @@ public:
      */
     inline auto &data() { return _trackers; }
 
+    //! @overload
+    inline const auto &data() const { return _trackers; }
+
     /**
      * @brief 获取同组追踪器的数量
      *
@@ -137,6 +151,14 @@ public:
         return retval;
     }
 
+    //! 以给定的追踪器快照创建序列组的快照，参考 `group::snapshot()`
+    group::ptr snapshot(const std::vector<tracker::ptr> &trackers) const override
+    {
+        auto retval = std::make_shared<DefaultGroup>(*this);
+        retval->_trackers = trackers;
+        return retval;
+    }
+
     /**
      * @brief 动态类型转换
      *
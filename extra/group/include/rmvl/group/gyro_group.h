@@ -32,10 +32,10 @@ class GyroGroup final : public group
     GyroData _gyro_data; //!< 当前陀螺仪数据
     bool _is_tracked{};  //!< 是否为目标序列组
 
-    //! 追踪器状态哈希表 [追踪器 : 追踪器状态]
-    std::unordered_map<tracker::ptr, TrackerState> _tracker_state;
+    //! 追踪器状态表 [追踪器 : 追踪器状态]
+    TrackerMap<tracker::ptr, TrackerState> _tracker_state;
 
-    KF63f _center3d_filter; //!< 旋转中心点位置滤波器
+    KF63fCV _center3d_filter; //!< 旋转中心点位置滤波器
 
     std::deque<float> _rotspeed_deq; //!< 旋转速度时间队列（原始数据）
 
@@ -74,6 +74,9 @@ public:
      */
     group::ptr clone() override;
 
+    //! 以给定的追踪器快照创建序列组的快照，参考 `group::snapshot()`
+    group::ptr snapshot(const std::vector<tracker::ptr> &trackers) const override;
+
     /**
      * @brief 动态类型转换
      *
@@ -38,6 +38,9 @@ public:
      */
     group::ptr clone() override;
 
+    //! 以给定的追踪器快照创建序列组的快照，参考 `group::snapshot()`
+    group::ptr snapshot(const std::vector<tracker::ptr> &trackers) const override;
+
     /**
      * @brief 动态类型转换
      *
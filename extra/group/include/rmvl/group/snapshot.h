@@ -0,0 +1,124 @@
+/**
+ * @file snapshot.h
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 序列组快照
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "group.h"
+
+namespace rm
+{
+
+//! @addtogroup group
+//! @{
+
+//! 序列组快照，发布后不再修改，可在多个线程中同时读取
+struct GroupSnapshot
+{
+    using ptr = std::shared_ptr<const GroupSnapshot>;
+
+    std::vector<group::ptr> groups; //!< 序列组，各处理阶段仅可读取，不可调用 `sync`、`update` 等修改操作
+    double tick{};                  //!< 对应的时间点
+    std::size_t version{};          //!< 版本号，每次发布时递增
+};
+
+/**
+ * @brief 序列组快照发布器，用于在识别、预测、决策等不同线程的处理阶段之间无锁地传递序列组
+ * @brief
+ * - 识别线程在每帧更新序列组后调用 `publish` 发布快照，其余线程通过 `load` 获取最新的完整快照，快照之间通过原子指针交换
+ * - 快照与原序列组共享组合体，自上次发布以来未发生变化的追踪器直接沿用上一版快照中的追踪器，仅拷贝发生变化的追踪器与序列组自身，
+ *   相比于 `group::clone()` 的深拷贝，不会复制组合体与特征
+ * @note
+ * - `publish` 仅允许在一个线程中调用，`load` 可在任意线程中调用
+ */
+class GroupSnapshotPublisher
+{
+    //! 追踪器快照缓存项
+    struct Cached
+    {
+        combo::ptr front;      //!< 创建快照时追踪器的最新组合体
+        uint32_t vanish_num{}; //!< 创建快照时追踪器的消失帧数
+        std::size_t size{};    //!< 创建快照时追踪器的观测数量
+        tracker::ptr snapshot; //!< 追踪器快照
+    };
+
+    TrackerMap<tracker::ptr, Cached> _cache; //!< 上一次发布时各追踪器的快照
+    TrackerMap<tracker::ptr, Cached> _next;  //!< 本次发布时各追踪器的快照
+    std::vector<tracker::ptr> _trackers;     //!< 单个序列组的追踪器快照缓冲区
+    std::size_t _version{};                  //!< 已发布的版本号
+
+#if __cpp_lib_atomic_shared_ptr >= 201711L
+    std::atomic<GroupSnapshot::ptr> _current; //!< 最新的快照
+#else
+    GroupSnapshot::ptr _current; //!< 最新的快照，通过 `std::atomic_load` 与 `std::atomic_store` 访问
+#endif
+
+public:
+    /**
+     * @brief 发布序列组的快照
+     *
+     * @param[in] groups 识别模块更新后的序列组
+     * @param[in] tick 对应的时间点
+     * @return 发布的快照
+     */
+    GroupSnapshot::ptr publish(const std::vector<group::ptr> &groups, double tick)
+    {
+        auto snap = std::make_shared<GroupSnapshot>();
+        snap->groups.reserve(groups.size());
+        for (const auto &p_group : groups)
+        {
+            const auto &trackers = p_group->data();
+            _trackers.clear();
+            _trackers.reserve(trackers.size());
+            for (const auto &p_tracker : trackers)
+            {
+                // 最新组合体、消失帧数、观测数量均未变化时，追踪器自上次发布以来未被更新
+                auto it = _cache.find(p_tracker);
+                bool unchanged = it != _cache.end() && it->second.front == p_tracker->front() &&
+                                 it->second.vanish_num == p_tracker->getVanishNumber() && it->second.size == p_tracker->size();
+                auto p_snapshot = unchanged ? it->second.snapshot : p_tracker->snapshot();
+                _next[p_tracker] = {p_tracker->front(), p_tracker->getVanishNumber(), p_tracker->size(), p_snapshot};
+                _trackers.push_back(p_snapshot);
+            }
+            snap->groups.push_back(p_group->snapshot(_trackers));
+        }
+        // 仅保留本次发布涉及的追踪器，已删除的追踪器随之释放
+        std::swap(_cache, _next);
+        _next.clear();
+        snap->tick = tick;
+        snap->version = ++_version;
+#if __cpp_lib_atomic_shared_ptr >= 201711L
+        _current.store(snap);
+#else
+        std::atomic_store(&_current, GroupSnapshot::ptr(snap));
+#endif
+        return snap;
+    }
+
+    /**
+     * @brief 获取最新发布的快照
+     *
+     * @return 最新发布的快照，尚未发布时返回 `nullptr`
+     */
+    GroupSnapshot::ptr load() const
+    {
+#if __cpp_lib_atomic_shared_ptr >= 201711L
+        return _current.load();
+#else
+        return std::atomic_load(&_current);
+#endif
+    }
+};
+
+//! @} group
+
+} // namespace rm
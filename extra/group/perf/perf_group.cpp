@@ -0,0 +1,111 @@
+/**
+ * @file perf_group.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 序列组基准测试
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include "rmvl/rmvl_modules.hpp"
+
+#ifdef HAVE_RMVL_GROUP
+
+#include <benchmark/benchmark.h>
+
+#include "rmvl/group/snapshot.h"
+
+namespace rm_test
+{
+
+/**
+ * @brief 构建序列组，每个序列组包含 4 个追踪器
+ *
+ * @param[in] num 序列组数量
+ */
+static std::vector<rm::group::ptr> buildGroups(int num)
+{
+    std::vector<rm::group::ptr> groups;
+    for (int i = 0; i < num; ++i)
+    {
+        auto p_group = rm::DefaultGroup::make_group();
+        for (int j = 0; j < 4; ++j)
+            p_group->add(rm::DefaultTracker::make_tracker(rm::DefaultCombo::make_combo(rm::DefaultFeature::make_feature({1.f * j, 1.f * i}), 0)));
+        groups.push_back(p_group);
+    }
+    return groups;
+}
+
+/**
+ * @brief 模拟一帧的识别：每个序列组中有 2 个追踪器捕获到新的组合体，其余追踪器消失
+ *
+ * @param[in] groups 序列组
+ * @param[in] tick 当前时间点
+ */
+static void updateGroups(std::vector<rm::group::ptr> &groups, double tick)
+{
+    for (auto &p_group : groups)
+    {
+        auto &trackers = p_group->data();
+        for (std::size_t j = 0; j < trackers.size(); ++j)
+        {
+            if (j < 2)
+                trackers[j]->update(rm::DefaultCombo::make_combo(rm::DefaultFeature::make_feature({1.f * j, 0.f}), tick));
+            else
+                trackers[j]->update(tick, rm::GyroData());
+        }
+    }
+}
+
+//! 通过 `clone()` 深拷贝所有序列组，用于线程间传递
+void group_handoff_clone(benchmark::State &state)
+{
+    auto groups = buildGroups(static_cast<int>(state.range(0)));
+    double tick{};
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        updateGroups(groups, tick += 0.01);
+        state.ResumeTiming();
+        std::vector<rm::group::ptr> copied;
+        copied.reserve(groups.size());
+        for (const auto &p_group : groups)
+            copied.push_back(p_group->clone());
+        benchmark::DoNotOptimize(copied);
+    }
+}
+
+//! 通过 `GroupSnapshotPublisher` 发布快照，用于线程间传递
+void group_handoff_snapshot(benchmark::State &state)
+{
+    auto groups = buildGroups(static_cast<int>(state.range(0)));
+    rm::GroupSnapshotPublisher publisher;
+    double tick{};
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        updateGroups(groups, tick += 0.01);
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(publisher.publish(groups, tick));
+    }
+}
+
+//! 序列组未发生变化时发布快照，所有追踪器均沿用上一版快照
+void group_handoff_snapshot_unchanged(benchmark::State &state)
+{
+    auto groups = buildGroups(static_cast<int>(state.range(0)));
+    rm::GroupSnapshotPublisher publisher;
+    double tick{};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(publisher.publish(groups, tick += 0.01));
+}
+
+BENCHMARK(group_handoff_clone)->DenseRange(1, 8)->Unit(benchmark::kMicrosecond);
+BENCHMARK(group_handoff_snapshot)->DenseRange(1, 8)->Unit(benchmark::kMicrosecond);
+BENCHMARK(group_handoff_snapshot_unchanged)->DenseRange(1, 8)->Unit(benchmark::kMicrosecond);
+
+} // namespace rm_test
+
+#endif // HAVE_RMVL_GROUP
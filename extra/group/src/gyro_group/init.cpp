@@ -91,4 +91,17 @@ group::ptr GyroGroup::clone()
     return retval;
 }
 
+group::ptr GyroGroup::snapshot(const std::vector<tracker::ptr> &trackers) const
+{
+    if (trackers.size() != _trackers.size())
+        RMVL_Error_(RMVL_StsBadSize, "Bad size of the \"trackers\", size = %zu, expected %zu", trackers.size(), _trackers.size());
+    auto retval = std::make_shared<GyroGroup>(*this);
+    retval->_trackers = trackers;
+    // 追踪器状态哈希表以快照中的追踪器为键
+    retval->_tracker_state.clear();
+    for (std::size_t i = 0; i < trackers.size(); ++i)
+        retval->_tracker_state[trackers[i]] = _tracker_state.at(_trackers[i]);
+    return retval;
+}
+
 } // namespace rm
@@ -61,4 +61,11 @@ group::ptr RuneGroup::clone()
     return retval;
 }
 
+group::ptr RuneGroup::snapshot(const std::vector<tracker::ptr> &trackers) const
+{
+    auto retval = std::make_shared<RuneGroup>(*this);
+    retval->_trackers = trackers;
+    return retval;
+}
+
 } // namespace rm
@@ -0,0 +1,99 @@
+/**
+ * @file test_snapshot.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 序列组快照单元测试
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include "rmvl/rmvl_modules.hpp"
+
+#ifdef HAVE_RMVL_GROUP
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/group/snapshot.h"
+
+namespace rm_test
+{
+
+static rm::combo::ptr createCombo(float x, double tick)
+{
+    return rm::DefaultCombo::make_combo(rm::DefaultFeature::make_feature({x, 0}), tick);
+}
+
+TEST(GroupSnapshotTest, structural_sharing)
+{
+    auto p_group = rm::DefaultGroup::make_group();
+    p_group->add(rm::DefaultTracker::make_tracker(createCombo(1, 0)));
+    p_group->add(rm::DefaultTracker::make_tracker(createCombo(2, 0)));
+    std::vector<rm::group::ptr> groups = {p_group};
+
+    rm::GroupSnapshotPublisher publisher;
+    EXPECT_EQ(publisher.load(), nullptr);
+    auto v1 = publisher.publish(groups, 0);
+    ASSERT_EQ(v1->groups.size(), 1u);
+    const auto &t1 = v1->groups.front()->data();
+    ASSERT_EQ(t1.size(), 2u);
+    // 快照与原追踪器共享组合体
+    EXPECT_NE(t1[0], p_group->at(0));
+    EXPECT_EQ(t1[0]->front(), p_group->at(0)->front());
+
+    // 仅更新第 1 个追踪器，第 2 个追踪器沿用上一版快照
+    p_group->at(0)->update(createCombo(1.5f, 0.01));
+    auto v2 = publisher.publish(groups, 0.01);
+    EXPECT_EQ(publisher.load(), v2);
+    EXPECT_EQ(v2->version, v1->version + 1);
+    EXPECT_EQ(v2->tick, 0.01);
+    const auto &t2 = v2->groups.front()->data();
+    EXPECT_NE(t2[0], t1[0]);
+    EXPECT_EQ(t2[1], t1[1]);
+    // 旧快照不受后续更新的影响
+    EXPECT_EQ(t1[0]->getCenter().x, 1.f);
+    EXPECT_EQ(t2[0]->getCenter().x, 1.5f);
+
+    // 仅更新消失帧数同样视为发生变化
+    p_group->at(1)->update(0.02, rm::GyroData());
+    auto v3 = publisher.publish(groups, 0.02);
+    const auto &t3 = v3->groups.front()->data();
+    EXPECT_EQ(t3[0], t2[0]);
+    EXPECT_NE(t3[1], t2[1]);
+    EXPECT_EQ(t3[1]->getVanishNumber(), 1u);
+}
+
+TEST(GroupSnapshotTest, concurrent_readers)
+{
+    auto p_group = rm::DefaultGroup::make_group();
+    p_group->add(rm::DefaultTracker::make_tracker(createCombo(0, 0)));
+    std::vector<rm::group::ptr> groups = {p_group};
+    rm::GroupSnapshotPublisher publisher;
+    publisher.publish(groups, 0);
+
+    constexpr int frames = 2000;
+    std::thread reader([&] {
+        std::size_t last{};
+        while (last < frames + 1)
+        {
+            auto snap = publisher.load();
+            // 版本号单调递增，且快照内的数据与版本号一致
+            EXPECT_GE(snap->version, last);
+            EXPECT_EQ(snap->groups.front()->at(0)->getCenter().x, static_cast<float>(snap->version - 1));
+            last = snap->version;
+        }
+    });
+    for (int i = 1; i <= frames; ++i)
+    {
+        p_group->at(0)->update(createCombo(static_cast<float>(i), i * 0.001));
+        publisher.publish(groups, i * 0.001);
+    }
+    reader.join();
+}
+
+} // namespace rm_test
+
+#endif // HAVE_RMVL_GROUP
@@ -31,7 +31,7 @@ public:
      * @note
      * - 遍历所有 group 中所有 tracker，采用统一的预测方案：线性预测
      * @note
-     * - 静态响应预测量 `B` 生效: `YAW`，`PITCH`
+     * - 静态响应预测量 `B` 生效: `YAW`，`PITCH`，包含流水线延迟估计值
      * @note
      * - 动态响应预测量 `Kt` 生效: `YAW`，`PITCH`
      *
@@ -40,7 +40,7 @@ public:
      * @return 预测模块信息
      */
     PredictInfo predict(const std::vector<group::ptr> &groups,
-                        const std::unordered_map<tracker::ptr, double> &tof) override;
+                        const TrackerMap<tracker::ptr, double> &tof) override;
 };
 
 //! @} armor_predictor
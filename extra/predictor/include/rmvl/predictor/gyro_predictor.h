@@ -31,7 +31,7 @@ public:
      * @note
      * - 遍历所有 group 中所有 tracker，采用统一的预测方案：三维预测
      * @note
-     * - 静态响应预测量 `B` 生效: `POS_X`，`POS_Y`，`POS_Z`，`ANG_Y`
+     * - 静态响应预测量 `B` 生效: `POS_X`，`POS_Y`，`POS_Z`，`ANG_Y`，包含流水线延迟估计值
      * @note
      * - 动态响应预测量 `Kt` 生效: `POS_X`，`POS_Y`，`POS_Z`，`ANG_Y`
      * @note
@@ -42,7 +42,21 @@ public:
      * @return 预测模块信息
      */
     PredictInfo predict(const std::vector<group::ptr> &groups,
-                        const std::unordered_map<tracker::ptr, double> &tof) override;
+                        const TrackerMap<tracker::ptr, double> &tof) override;
+
+    /**
+     * @brief 目标运动模型，计算子弹飞行 `tf` 后目标追踪器在陀螺仪坐标系下的位置，可作为 `compensator::aim` 的运动模型
+     * @note
+     * - 与 `predict` 的静态响应、动态响应预测量一致：平移增量为 \f$\pmb v(Kt_f+B+L)\f$，绕旋转中心的转角增量为
+     *   \f$\omega(Kt_f+B+L)\f$，其中 \f$L\f$ 为流水线延迟
+     *
+     * @param[in] p_group 目标追踪器所在的序列组
+     * @param[in] p_tracker 目标追踪器
+     * @param[in] tf 子弹飞行时间 (s)
+     * @param[in] latency 流水线延迟 (s)，一般为 `latency().value()`
+     * @return 预测位置，单位 `mm`
+     */
+    static cv::Vec3f motion(group::ptr p_group, tracker::const_ptr p_tracker, double tf, double latency = 0);
 };
 
 //! @} gyro_predictor
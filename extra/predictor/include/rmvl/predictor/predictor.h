@@ -11,8 +11,7 @@
 
 #pragma once
 
-#include <unordered_map>
-
+#include "rmvl/core/deadline.hpp"
 #include "rmvl/group/group.h"
 
 namespace rm
@@ -46,11 +45,11 @@ enum : std::size_t
 struct PredictInfo
 {
     //! 静态响应预测增量 B
-    std::unordered_map<tracker::const_ptr, cv::Vec<double, 9>> static_prediction;
+    TrackerMap<tracker::const_ptr, cv::Vec<double, 9>> static_prediction;
     //! 动态响应预测增量 Kt
-    std::unordered_map<tracker::const_ptr, cv::Vec<double, 9>> dynamic_prediction;
+    TrackerMap<tracker::const_ptr, cv::Vec<double, 9>> dynamic_prediction;
     //! 射击延迟预测增量 Bs
-    std::unordered_map<tracker::const_ptr, cv::Vec<double, 9>> shoot_delay_prediction;
+    TrackerMap<tracker::const_ptr, cv::Vec<double, 9>> shoot_delay_prediction;
 };
 
 //! 目标预测模块
@@ -71,7 +70,42 @@ public:
      * @return 预测模块信息
      */
     virtual PredictInfo predict(const std::vector<group::ptr> &groups,
-                                const std::unordered_map<tracker::ptr, double> &tof) = 0;
+                                const TrackerMap<tracker::ptr, double> &tof) = 0;
+
+    /**
+     * @brief 获取流水线延迟估计器
+     * @note
+     * - 每次发送控制指令后，以该指令所用图像的捕获时间戳更新估计器，例如
+     *   `p_predictor->latency().update(capture_tick, Timer::now())`
+     * - 静态响应预测量会在参数 `B` 的基础上叠加延迟估计值，即外推至 `捕获时间戳 + 延迟 + 子弹飞行时间` 的时刻，
+     *   此时参数 `B` 仅需补偿估计器未覆盖的固定延迟，例如串口传输、云台响应
+     *
+     * @return 延迟估计器
+     */
+    inline LatencyEstimator &latency() { return _latency; }
+
+    //! 获取流水线延迟估计器
+    inline const LatencyEstimator &latency() const { return _latency; }
+
+    /**
+     * @brief 设置帧截止时间策略
+     * @note 帧龄超过降级处理的阈值时，预测模块会跳过模型参数的拟合，沿用上一次拟合的结果
+     *
+     * @param[in] deadline 帧截止时间策略，为 `nullptr` 时关闭降级处理
+     */
+    inline void setDeadline(FrameDeadline *deadline) { _deadline = deadline; }
+
+protected:
+    LatencyEstimator _latency;  //!< 从图像捕获到控制指令生效的延迟估计
+    FrameDeadline *_deadline{}; //!< 帧截止时间策略
+
+    /**
+     * @brief 指定捕获时间点的帧是否已超出降级处理的帧龄
+     * @note 未设置帧截止时间策略时始终返回 `false`
+     *
+     * @param[in] tick 帧的捕获时间点
+     */
+    inline bool overdue(double tick) const { return _deadline != nullptr && _deadline->check(tick) != FrameAction::Process; }
 };
 
 //! @} predictor
@@ -30,7 +30,7 @@ public:
     /**
      * @brief 神符预测核心函数
      * @note
-     * - 静态响应预测量 `B` 生效: `ANG_Z`
+     * - 静态响应预测量 `B` 生效: `ANG_Z`，包含流水线延迟估计值
      * @note
      * - 动态响应预测量 `Kt` 生效: `ANG_Z`
      *
@@ -39,7 +39,7 @@ public:
      * @return 预测模块信息
      */
     PredictInfo predict(const std::vector<group::ptr> &groups,
-                        const std::unordered_map<tracker::ptr, double> &tof) override;
+                        const TrackerMap<tracker::ptr, double> &tof) override;
 
     //! 构建 RunePredictor
     static inline std::unique_ptr<RunePredictor> make_predictor() { return std::make_unique<RunePredictor>(); }
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <deque>
 #include <vector>
 
 #include "predictor.h"
@@ -21,13 +22,19 @@ namespace rm
 //! @addtogroup spi_rune_predictor
 //! @{
 
-//! 系统参数辨识神符预测类
+/**
+ * @brief 系统参数辨识神符预测类
+ * @brief
+ * - 神符转速满足正弦速度模型 \f$v(t)=a\sin(\omega t+\varphi)+b\f$，以相隔若干帧的角度差分作为转速观测量，使用带遗忘因子的递推
+ *   Gauss-Newton 法在线辨识 4 个模型参数 \f$[a,\omega,\varphi,b]\f$，参数与协方差矩阵均为固定大小，每帧不涉及动态内存分配
+ * - 样本数量首次满足要求时，以滑动窗口内的转速样本进行最小二乘频谱估计，得到参数的初值
+ */
 class SpiRunePredictor final : public predictor
 {
-    const size_t _n;        //!< 模型阶数
-    const double _interval; //!< 采样间隔
-    cv::Mat _pm;            //!< 协方差矩阵
-    cv::Mat _xm;            //!< 待求解系数向量
+    const double _interval; //!< 采样间隔（单位：s）
+    bool _seeded{};         //!< 模型参数是否已完成初始化
+    cv::Matx44d _pm;        //!< 协方差矩阵
+    cv::Vec4d _xm;          //!< 待求解参数向量 \f$[a,\omega,\varphi,b]^T\f$
 
 public:
     //! 构造函数
@@ -36,7 +43,7 @@ public:
     /**
      * @brief 系统参数辨识神符预测核心函数
      * @note
-     * - 静态响应预测量 `B` 生效: `ANG_Z`
+     * - 静态响应预测量 `B` 生效: `ANG_Z`，包含流水线延迟估计值
      * @note
      * - 动态响应预测量 `Kt` 生效: `ANG_Z`
      *
@@ -45,12 +52,15 @@ public:
      * @return 预测模块信息
      */
     PredictInfo predict(const std::vector<group::ptr> &groups,
-                        const std::unordered_map<tracker::ptr, double> &tof) override;
+                        const TrackerMap<tracker::ptr, double> &tof) override;
 
     //! 构建 SpiRunePredictor
     static inline std::unique_ptr<SpiRunePredictor> make_predictor() { return std::make_unique<SpiRunePredictor>(); }
 
 private:
+    //! 重置模型参数与协方差矩阵
+    void reset();
+
     /**
      * @brief 从单个追踪器中计算静态预测增量
      *
@@ -69,11 +79,19 @@ private:
     double anglePredict(const std::deque<double> &rawdatas, double tf);
 
     /**
-     * @brief 递推最小二乘的系统参数辨识过程
+     * @brief 递推 Gauss-Newton 的系统参数辨识过程，每帧调用一次
+     *
+     * @param[in] rawdatas 原始数据队列
+     * @param[in] update 是否以最新样本更新模型参数，为 `false` 时仅将相位参考点推进至最新样本时刻
+     */
+    void identifier(const std::deque<double> &rawdatas, bool update = true);
+
+    /**
+     * @brief 以原始数据队列中的全部转速样本进行最小二乘频谱估计，初始化模型参数与协方差矩阵
      *
      * @param[in] rawdatas 原始数据队列
      */
-    void identifier(const std::deque<double> &rawdatas);
+    void seed(const std::deque<double> &rawdatas);
 };
 
 //! @} spi_rune_predictor
@@ -0,0 +1,135 @@
+/**
+ * @file perf_spi_rune_predictor.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 系统参数辨识神符预测基准测试
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include "rmvl/rmvl_modules.hpp"
+
+#ifdef HAVE_RMVL_SPI_RUNE_PREDICTOR
+
+#include <cmath>
+#include <deque>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "rmvl/algorithm/math.hpp"
+#include "rmvl/predictor/predictor.h"
+
+#define private public
+#include "rmvl/predictor/spi_rune_predictor.h"
+#undef private
+
+namespace rm_test
+{
+
+//! 合成神符角度（单位：°），转速为 \f$0.9\sin(1.942t+0.5)+1.19\f$ rad/s
+static double runeAngle(double t)
+{
+    constexpr double a = rm::rad2deg(0.9), omega = 1.942, phi = 0.5, b = rm::rad2deg(1.19);
+    return b * t - a / omega * std::cos(omega * t + phi);
+}
+
+/**
+ * @brief 生成合成神符角度序列，10 ms 采样，叠加高斯噪声
+ *
+ * @param[in] frames 帧数
+ * @param[in] noise 角度噪声标准差（单位：°）
+ * @return 角度序列（单位：°），按照时间顺序排列
+ */
+static std::vector<double> buildTrace(int frames, double noise)
+{
+    std::mt19937 rng(42);
+    std::normal_distribution<double> dist(0, noise);
+    std::vector<double> trace(frames);
+    for (int i = 0; i < frames; ++i)
+        trace[i] = runeAngle(i * 0.01) + dist(rng);
+    return trace;
+}
+
+//! 单次递推辨识的耗时
+void spi_rune_identifier(benchmark::State &state)
+{
+    auto trace = buildTrace(2000, 0.2);
+    rm::SpiRunePredictor predictor;
+    std::deque<double> datas;
+    std::size_t idx{};
+    for (auto _ : state)
+    {
+        datas.push_front(trace[idx++ % trace.size()]);
+        if (datas.size() > 500)
+            datas.pop_back();
+        predictor.identifier(datas);
+        benchmark::DoNotOptimize(predictor.anglePredict(datas, 0.3));
+    }
+}
+
+//! 原先的 61 维自回归模型递推最小二乘（`cv::Mat`）单次辨识的耗时，作为对照
+void spi_rune_identifier_ar61(benchmark::State &state)
+{
+    constexpr int n = 60, nf = 35;
+    auto trace = buildTrace(2000, 0.2);
+    cv::Mat pm = 200 * cv::Mat::eye(n + 1, n + 1, CV_64FC1), xm = cv::Mat::zeros(n + 1, 1, CV_64FC1);
+    std::deque<double> datas;
+    std::size_t idx{};
+    for (auto _ : state)
+    {
+        datas.push_front(trace[idx++ % trace.size()]);
+        if (datas.size() > 500)
+            datas.pop_back();
+        if (datas.size() < n + nf)
+            continue;
+        cv::Mat am(1, n + 1, CV_64FC1);
+        am.at<double>(0) = 1;
+        for (int i = 0; i < n; ++i)
+            am.at<double>(i + 1) = datas[nf + i];
+        cv::Mat amt = am.t();
+        pm = pm - (pm * amt * am * pm) / (1 + cv::Mat(am * pm * amt).at<double>(0));
+        xm = xm + pm * amt * (datas[0] - cv::Mat(am * xm).at<double>(0));
+        benchmark::DoNotOptimize(xm.data);
+    }
+}
+
+/**
+ * @brief 收敛时间：在噪声标准差为 `state.range(0) / 10` ° 的 15 s 合成序列上，0.3 s 角度预测误差最后一次超过 1° 的时刻
+ */
+void spi_rune_convergence(benchmark::State &state)
+{
+    constexpr double tf = 0.3;
+    auto trace = buildTrace(1500, static_cast<double>(state.range(0)) / 10);
+    double converge{};
+    for (auto _ : state)
+    {
+        rm::SpiRunePredictor predictor;
+        std::deque<double> datas;
+        int last{-1};
+        for (int i = 0; i < static_cast<int>(trace.size()); ++i)
+        {
+            datas.push_front(trace[i]);
+            if (datas.size() > 500)
+                datas.pop_back();
+            predictor.identifier(datas);
+            // 以无噪声的真实角度增量作为参考
+            double t = i * 0.01;
+            if (std::abs(predictor.anglePredict(datas, tf) - (runeAngle(t + tf) - runeAngle(t))) > 1)
+                last = i;
+        }
+        converge = (last + 1) * 0.01;
+    }
+    state.counters["converge_s"] = converge;
+}
+
+BENCHMARK(spi_rune_identifier)->Unit(benchmark::kMicrosecond);
+BENCHMARK(spi_rune_identifier_ar61)->Unit(benchmark::kMicrosecond);
+BENCHMARK(spi_rune_convergence)->Arg(2)->Arg(5)->Unit(benchmark::kMillisecond);
+
+} // namespace rm_test
+
+#endif // HAVE_RMVL_SPI_RUNE_PREDICTOR
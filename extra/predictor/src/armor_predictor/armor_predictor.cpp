@@ -17,10 +17,11 @@
 namespace rm
 {
 
-PredictInfo ArmorPredictor::predict(const std::vector<group::ptr> &groups, const std::unordered_map<tracker::ptr, double> &tof)
+PredictInfo ArmorPredictor::predict(const std::vector<group::ptr> &groups, const TrackerMap<tracker::ptr, double> &tof)
 {
     // 预测信息
     PredictInfo info{};
+    double latency = _latency.value();
     for (auto p_group : groups)
     {
         for (auto p_tracker : p_group->data())
@@ -31,8 +32,8 @@ PredictInfo ArmorPredictor::predict(const std::vector<group::ptr> &groups, const
                                       p_tracker->front()->getGyroData().rotation.pitch_speed};
             // 计算用于预测的合成角速度
             cv::Point2f speed = p_tracker->getSpeed() + gyro_speed;
-            double dB_yaw = speed.x * para::armor_predictor_param.YAW_B;
-            double dB_pitch = speed.y * para::armor_predictor_param.PITCH_B;
+            double dB_yaw = speed.x * (para::armor_predictor_param.YAW_B + latency);
+            double dB_pitch = speed.y * (para::armor_predictor_param.PITCH_B + latency);
             double dKt_yaw = speed.x * para::armor_predictor_param.YAW_K * tf;
             double dKt_pitch = speed.y * para::armor_predictor_param.PITCH_K * tf;
 
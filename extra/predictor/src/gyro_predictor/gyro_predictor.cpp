@@ -19,10 +19,12 @@ namespace rm
 {
 
 PredictInfo GyroPredictor::predict(const std::vector<group::ptr> &groups,
-                                   const std::unordered_map<tracker::ptr, double> &tof)
+                                   const TrackerMap<tracker::ptr, double> &tof)
 {
     // 预测信息
     PredictInfo info{};
+    // 静态响应延迟：实测的流水线延迟与固定延迟之和
+    double delay = para::gyro_predictor_param.B + _latency.value();
     for (auto p_group : groups)
     {
         auto p_gyro_group = GyroGroup::cast(p_group);
@@ -32,10 +34,10 @@ PredictInfo GyroPredictor::predict(const std::vector<group::ptr> &groups,
             auto p_gyro_tracker = GyroTracker::cast(p_tracker);
             // 平移
             auto dKt_T = p_gyro_group->getSpeed3D() * para::gyro_predictor_param.K * tf;
-            auto dB_T = p_gyro_group->getSpeed3D() * para::gyro_predictor_param.B;
+            auto dB_T = p_gyro_group->getSpeed3D() * delay;
             // 旋转
             auto dKt_R = p_gyro_group->getRotatedSpeed() * para::gyro_predictor_param.K * tf;
-            auto dB_R = p_gyro_group->getRotatedSpeed() * para::gyro_predictor_param.B;
+            auto dB_R = p_gyro_group->getRotatedSpeed() * delay;
             auto dBs_R = p_gyro_group->getRotatedSpeed() * para::gyro_predictor_param.SHOOT_B;
             // 更新预测量
             auto &dynamic_vec = info.dynamic_prediction[p_tracker];
@@ -55,4 +57,22 @@ PredictInfo GyroPredictor::predict(const std::vector<group::ptr> &groups,
     return info;
 }
 
+cv::Vec3f GyroPredictor::motion(group::ptr p_group, tracker::const_ptr p_tracker, double tf, double latency)
+{
+    auto p_gyro_group = GyroGroup::cast(p_group);
+    if (p_gyro_group == nullptr)
+        RMVL_Error(RMVL_BadDynamicType, "Fail to cast the type of \"p_group\" to \"GyroGroup::ptr\"");
+    float dt = static_cast<float>(para::gyro_predictor_param.K * tf + para::gyro_predictor_param.B + latency);
+    // 平移
+    cv::Vec3f center = p_gyro_group->getCenter3D() + p_gyro_group->getSpeed3D() * dt;
+    // 绕旋转中心旋转
+    float rotangle = p_gyro_group->getRotatedSpeed() * dt;
+    float c = std::cos(rotangle), s = std::sin(rotangle);
+    cv::Vec3f r = p_tracker->getExtrinsics().tvec() - p_gyro_group->getCenter3D();
+    cv::Matx33f rot = {c, 0, s,
+                       0, 1, 0,
+                       -s, 0, c};
+    return center + rot * r;
+}
+
 } // namespace rm
@@ -20,7 +20,7 @@
 namespace rm
 {
 
-PredictInfo RunePredictor::predict(const std::vector<group::ptr> &groups, const std::unordered_map<tracker::ptr, double> &tof)
+PredictInfo RunePredictor::predict(const std::vector<group::ptr> &groups, const TrackerMap<tracker::ptr, double> &tof)
 {
     if (groups.size() != 1)
         RMVL_Error(RMVL_StsBadSize, "Size of the groups is not equal to \'1\'");
@@ -35,7 +35,7 @@ PredictInfo RunePredictor::predict(const std::vector<group::ptr> &groups, const
         double tf = (tof.find(p_tracker) == tof.end()) ? 0. : tof.at(p_tracker);
         // Kt + B 预测模型
         double dKt = p_rune_tracker->getRotatedSpeed() * para::rune_predictor_param.PREDICT_K * tf;
-        double dB = p_rune_tracker->getRotatedSpeed() * para::rune_predictor_param.PREDICT_B;
+        double dB = p_rune_tracker->getRotatedSpeed() * (para::rune_predictor_param.PREDICT_B + _latency.value());
         // 更新预测量
         info.dynamic_prediction.at(p_tracker)[ANG_Z] = dKt;
         info.static_prediction.at(p_tracker)[ANG_Z] = dB;
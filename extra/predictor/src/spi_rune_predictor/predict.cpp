@@ -9,6 +9,11 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "rmvl/algorithm/math.hpp"
 #include "rmvl/group/rune_group.h"
 #include "rmvl/predictor/spi_rune_predictor.h"
 #include "rmvl/tracker/rune_tracker.h"
@@ -19,50 +24,134 @@
 namespace rm
 {
 
+SpiRunePredictor::SpiRunePredictor() : _interval(para::spi_rune_predictor_param.SAMPLE_INTERVAL * 1e-3) { reset(); }
+
+void SpiRunePredictor::reset()
+{
+    _seeded = false;
+    _pm = para::spi_rune_predictor_param.KP * cv::Matx44d::eye();
+    _xm = cv::Vec4d();
+}
+
+/**
+ * @brief 计算转速观测量
+ *
+ * @param[in] raw_datas 原始数据队列
+ * @param[in] idx 样本下标
+ * @param[in] lag 角度差分间隔
+ * @param[in] interval 采样间隔
+ * @return 第 `idx` 个样本与其前 `lag` 个样本之间的平均转速，对应 `(idx + lag / 2)` 帧之前的瞬时转速
+ */
+static inline double speed(const std::deque<double> &raw_datas, std::size_t idx, std::size_t lag, double interval)
+{
+    return (raw_datas[idx] - raw_datas[idx + lag]) / (static_cast<double>(lag) * interval);
+}
+
 /**
- * @brief 重置、初始化 Pm、xm
+ * @brief 正弦速度模型关于参数 \f$[a,\omega,\varphi,b]\f$ 的 Jacobian 矩阵
  *
- * @param[in] n 模型阶数
- * @param[out] Pm 协方差矩阵
- * @param[out] xm 待求解系数向量
+ * @param[in] xm 模型参数，其中 \f$\varphi\f$ 为最新样本时刻的相位
+ * @param[in] tau 相对于最新样本的时间（单位：s）
+ * @return Jacobian 矩阵
  */
-inline void resetPmxm(size_t n, cv::Mat &Pm, cv::Mat &xm)
+static inline cv::Vec4d jacobian(const cv::Vec4d &xm, double tau)
 {
-    Pm = para::spi_rune_predictor_param.KP * cv::Mat::eye(n + 1, n + 1, CV_64FC1);
-    xm = cv::Mat::zeros(n + 1, 1, CV_64FC1);
+    double psi = xm(1) * tau + xm(2);
+    double c = xm(0) * std::cos(psi);
+    return {std::sin(psi), c * tau, c, 1.};
 }
 
-SpiRunePredictor::SpiRunePredictor() : _n(para::spi_rune_predictor_param.DIFF_ORDER),
-                                       _interval(para::spi_rune_predictor_param.SAMPLE_INTERVAL)
+void SpiRunePredictor::seed(const std::deque<double> &raw_datas)
 {
-    resetPmxm(_n, _pm, _xm);
+    const auto &param = para::spi_rune_predictor_param;
+    const std::size_t lag = param.SPEED_LAG;
+    const std::size_t num = raw_datas.size() - lag;
+    // 最小二乘频谱估计：在角频率范围内搜索，对每个角频率求解线性最小二乘 v = A·sin(ωτ) + B·cos(ωτ) + b，取残差最小者
+    double best_ssr = std::numeric_limits<double>::max();
+    std::size_t steps = std::max<std::size_t>(param.OMEGA_STEPS, 1);
+    for (std::size_t k = 0; k < steps; ++k)
+    {
+        double omega = steps == 1 ? (param.OMEGA_MIN + param.OMEGA_MAX) / 2
+                                  : param.OMEGA_MIN + (param.OMEGA_MAX - param.OMEGA_MIN) * k / (steps - 1);
+        cv::Matx33d hth;
+        cv::Vec3d hty;
+        double yty{}, w{1};
+        for (std::size_t i = 0; i < num; ++i, w *= param.FORGET)
+        {
+            double tau = -(static_cast<double>(i) + 0.5 * lag) * _interval;
+            double v = speed(raw_datas, i, lag, _interval);
+            cv::Vec3d h(std::sin(omega * tau), std::cos(omega * tau), 1);
+            hth += w * h * h.t();
+            hty += w * v * h;
+            yty += w * v * v;
+        }
+        cv::Vec3d c = hth.inv(cv::DECOMP_CHOLESKY) * hty;
+        double ssr = yty - c.dot(hty);
+        if (ssr < best_ssr)
+        {
+            best_ssr = ssr;
+            _xm = {std::hypot(c(0), c(1)), omega, std::atan2(c(1), c(0)), c(2)};
+        }
+    }
+    // 以窗口内的加权信息矩阵与先验协方差初始化协方差矩阵，使后续递推与整个窗口的批量解衔接
+    cv::Matx44d info = (1. / param.KP) * cv::Matx44d::eye();
+    double w{1};
+    for (std::size_t i = 0; i < num; ++i, w *= param.FORGET)
+    {
+        auto j = jacobian(_xm, -(static_cast<double>(i) + 0.5 * lag) * _interval);
+        info += w * j * j.t();
+    }
+    _pm = info.inv(cv::DECOMP_CHOLESKY);
+    _seeded = true;
 }
 
-void SpiRunePredictor::identifier(const std::deque<double> &raw_datas)
+void SpiRunePredictor::identifier(const std::deque<double> &raw_datas, bool update)
 {
+    const auto &param = para::spi_rune_predictor_param;
+    // 时间推进：相位参考点移至最新样本时刻，φ ← φ + ωT
+    if (_seeded)
+    {
+        cv::Matx44d f = cv::Matx44d::eye();
+        f(2, 1) = _interval;
+        _xm(2) = std::remainder(_xm(2) + _xm(1) * _interval, 2 * PI);
+        _pm = f * _pm * f.t();
+    }
     // 允许辨识的最小容量
-    if (raw_datas.size() < para::spi_rune_predictor_param.MAX_NF + para::spi_rune_predictor_param.DIFF_ORDER)
+    if (!update || raw_datas.size() < std::max(param.MIN_SAMPLES, param.SPEED_LAG + 1))
         return;
-    // 获取 nf: 直接设定为最大值
-    size_t nf = para::spi_rune_predictor_param.MAX_NF;
-    // 系数提取
-    cv::Mat am = cv::Mat(1, _n + 1, CV_64FC1);
-    am.at<double>(0) = 1;
-    for (uint i = 0; i < _n; ++i)
-        am.at<double>(i + 1) = raw_datas[nf + i];
-    cv::Mat amt = am.t();
-    double bm = raw_datas[0];
-    // 最小二乘递推
-    _pm = _pm - (_pm * amt * am * _pm) / (1 + cv::Mat(am * _pm * amt).at<double>(0));
-    _xm = _xm + _pm * amt * (bm - cv::Mat(am * _xm).at<double>(0));
+    if (!_seeded)
+    {
+        seed(raw_datas);
+        return;
+    }
+    // 带遗忘因子的递推 Gauss-Newton
+    double tau = -0.5 * param.SPEED_LAG * _interval;
+    double psi = _xm(1) * tau + _xm(2);
+    double err = speed(raw_datas, 0, param.SPEED_LAG, _interval) - (_xm(0) * std::sin(psi) + _xm(3));
+    auto j = jacobian(_xm, tau);
+    cv::Vec4d pj = _pm * j;
+    cv::Vec4d k = pj / (param.FORGET + j.dot(pj));
+    _xm += err * k;
+    _pm = (_pm - k * pj.t()) * (1. / param.FORGET);
+    // 参数约束：幅值非负，角频率限制在给定范围内
+    if (_xm(0) < 0)
+    {
+        _xm(0) = -_xm(0);
+        _xm(2) = std::remainder(_xm(2) + PI, 2 * PI);
+    }
+    _xm(1) = std::clamp(_xm(1), param.OMEGA_MIN, param.OMEGA_MAX);
+    // 未被激励的参数方向上协方差会随遗忘因子持续增长（例如匀速转动时的 ω、φ），此时限制协方差矩阵的迹
+    double trace = _pm(0, 0) + _pm(1, 1) + _pm(2, 2) + _pm(3, 3);
+    if (trace > 4 * param.KP)
+        _pm = _pm * (4 * param.KP / trace);
 }
 
-PredictInfo SpiRunePredictor::predict(const std::vector<group::ptr> &groups, const std::unordered_map<tracker::ptr, double> &tof)
+PredictInfo SpiRunePredictor::predict(const std::vector<group::ptr> &groups, const TrackerMap<tracker::ptr, double> &tof)
 {
     PredictInfo info{};
     if (groups.empty() || groups.front()->data().empty())
     {
-        resetPmxm(_n, _pm, _xm);
+        reset();
         return info;
     }
     if (groups.size() > 1)
@@ -71,7 +160,8 @@ PredictInfo SpiRunePredictor::predict(const std::vector<group::ptr> &groups, con
     auto p_rune_group = RuneGroup::cast(groups.front());
     const auto &trackers = p_rune_group->data();
     const auto &raw_datas = p_rune_group->getRawDatas();
-    identifier(raw_datas);
+    // 帧已超出降级处理的帧龄时跳过拟合，沿用上一次辨识的参数
+    identifier(raw_datas, !overdue(trackers.front()->front()->getTick()));
     // ---------------------- 预测量计算 ----------------------
     for (auto p_tracker : trackers)
     {
@@ -91,7 +181,7 @@ float SpiRunePredictor::staticPredict(tracker::ptr p_tracker)
     auto p_rune_tracker = RuneTracker::cast(p_tracker);
     if (p_rune_tracker == nullptr)
         RMVL_Error(RMVL_BadDynamicType, "failed to convert the type of \"p_tracker\" to \"RuneTracker\"");
-    return p_rune_tracker->getRotatedSpeed() * para::spi_rune_predictor_param.B;
+    return p_rune_tracker->getRotatedSpeed() * (para::spi_rune_predictor_param.B + _latency.value());
 }
 
 double SpiRunePredictor::anglePredict(const std::deque<double> &raw_datas, double tf)
@@ -101,33 +191,11 @@ double SpiRunePredictor::anglePredict(const std::deque<double> &raw_datas, doubl
     if (tf <= 0)
         RMVL_Error_(RMVL_StsOutOfRange, "Flying time is <= 0, tf = %f", tf);
     // 允许预测的最小容量
-    if (raw_datas.size() < para::spi_rune_predictor_param.MAX_NF + para::spi_rune_predictor_param.DIFF_ORDER)
+    if (!_seeded || raw_datas.size() < para::spi_rune_predictor_param.MIN_SAMPLES)
         return sgn(raw_datas.front() - raw_datas.back()) * para::spi_rune_predictor_param.FIXED_ANGLE;
-    size_t max_nf = para::spi_rune_predictor_param.MAX_NF;
-    double nf = floor(1000 * tf / _interval) + 1;
-    // 范围限制
-    if (nf > static_cast<double>(max_nf))
-        nf = max_nf;
-    else if (nf < 1)
-        nf = 1;
-    double k1 = nf - 1000 * tf / _interval; // 预测量取 nf - 1 的置信权重
-    double k2 = 1 - k1;                     // 预测量取 nf 的置信权重
-    // 以 max_nf 为基准，实际 nf 进行预测需要滞后的帧数
-    size_t delay_k2 = max_nf - static_cast<size_t>(nf); // 预测量取 nf 的滞后帧数
-    size_t delay_k1 = delay_k2 + 1;                     // 预测量取 nf - 1 的滞后帧数
-    // 系数提取
-    cv::Mat am1(1, _n + 1, CV_64FC1);
-    am1.at<double>(0) = 1;
-    for (uint i = 0; i < _n; ++i)
-        am1.at<double>(i + 1) = raw_datas[delay_k1 + i];
-    cv::Mat am2(1, _n + 1, CV_64FC1);
-    am2.at<double>(0) = 1;
-    for (uint i = 0; i < _n; ++i)
-        am2.at<double>(i + 1) = raw_datas[delay_k2 + i];
-    // 预测
-    auto x = cv::Mat(am1 * _xm);
-    // 线性插值得到 Δθ
-    return cv::Mat(am1 * _xm).at<double>(0) * k1 + cv::Mat(am2 * _xm).at<double>(0) * k2 - raw_datas[0];
+    // 对转速模型积分：Δθ = b·tf - a / ω · [cos(ω·tf + φ) - cos(φ)]
+    const auto &[a, omega, phi, b] = _xm.val;
+    return b * tf - a / omega * (std::cos(omega * tf + phi) - std::cos(phi));
 }
 
 } // namespace rm
@@ -13,6 +13,8 @@
 
 #ifdef HAVE_RMVL_SPI_RUNE_PREDICTOR
 
+#include <random>
+
 #include <gtest/gtest.h>
 
 #define private public
@@ -72,17 +74,17 @@ TEST(PredictModel, uniform_data_from_0_600)
     {
         // 获取原始数据
         datas.push_front(static_cast<double>(i) + 0.1);
-        if (datas.size() > para::spi_rune_predictor_param.MAX_NF + para::spi_rune_predictor_param.DIFF_ORDER + 2)
+        if (datas.size() > para::spi_rune_predictor_param.MIN_SAMPLES + 2)
             datas.pop_back();
         // 递推
         p_predictor->identifier(datas);
-        // 预测（必须满足 x * SAMPLE_INTERVAL < MAX_NF，当前 x = 0.2）
+        // 预测
         double pre = p_predictor->anglePredict(datas, 0.2);
         if (datas.size() == 1)
         {
             EXPECT_EQ(pre, 0);
         }
-        else if (datas.size() < para::spi_rune_predictor_param.MAX_NF + para::spi_rune_predictor_param.DIFF_ORDER)
+        else if (datas.size() < para::spi_rune_predictor_param.MIN_SAMPLES)
         {
             EXPECT_EQ(pre, para::spi_rune_predictor_param.FIXED_ANGLE);
         }
@@ -93,8 +95,44 @@ TEST(PredictModel, uniform_data_from_0_600)
     }
 }
 
+/**
+ * @brief 合成神符转速 \f$v(t)=a\sin(\omega t+\varphi)+b\f$（单位：°/s），角度观测叠加标准差为 0.2° 的噪声，
+ *        辨识收敛后 0.3 s 的角度预测误差应足够小
+ */
+static void sinTrace(SpiRunePredictor &predictor, bool skip_half)
+{
+    constexpr double a = rad2deg(0.9), omega = 1.942, phi = 0.5, b = rad2deg(2.09 - 0.9), tf = 0.3;
+    const double interval = para::spi_rune_predictor_param.SAMPLE_INTERVAL * 1e-3;
+    auto angle = [&](double t) { return b * t - a / omega * std::cos(omega * t + phi); };
+    std::mt19937 rng(42);
+    std::normal_distribution<double> noise(0, 0.2);
+    std::deque<double> datas;
+    for (int i = 0; i < 600; ++i)
+    {
+        double t = i * interval;
+        datas.push_front(angle(t) + noise(rng));
+        if (datas.size() > 500)
+            datas.pop_back();
+        // 模拟帧超时：后半段每隔一帧跳过参数更新，仅推进相位参考点
+        predictor.identifier(datas, !skip_half || i < 300 || i % 2 == 0);
+        double pre = predictor.anglePredict(datas, tf);
+        if (i > 400)
+        {
+            EXPECT_NEAR(pre, angle(t + tf) - angle(t), 1.5);
+        }
+    }
+}
+
 TEST(PredictModel, sin_data_from_0_600)
 {
+    auto p_predictor = SpiRunePredictor::make_predictor();
+    sinTrace(*p_predictor, false);
+}
+
+TEST(PredictModel, sin_data_with_skipped_updates)
+{
+    auto p_predictor = SpiRunePredictor::make_predictor();
+    sinTrace(*p_predictor, true);
 }
 
 } // namespace rm_test
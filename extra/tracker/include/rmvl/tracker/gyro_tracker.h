@@ -38,8 +38,8 @@ private:
     cv::Vec2f _pose;   //!< 修正后的装甲板姿态法向量
     float _rotspeed{}; //!< 绕 y 轴自转角速度（俯视顺时针为正，滤波数据，弧度）
 
-    KF63f _center3d_filter; //!< 位置滤波器
-    KF42f _pose_filter;     //!< 姿态滤波器
+    KF63fCV _center3d_filter; //!< 位置滤波器
+    KF42fCV _pose_filter;     //!< 姿态滤波器
 
     std::deque<RobotType> _type_deque; //!< 装甲板状态队列（数字）
 
@@ -66,6 +66,9 @@ public:
      */
     tracker::ptr clone() override;
 
+    //! 创建与本追踪器共享组合体的快照，参考 `tracker::snapshot()`
+    tracker::ptr snapshot() const override { return shareSlot(std::make_shared<GyroTracker>(*this)); }
+
     /**
      * @brief 动态类型转换
      *
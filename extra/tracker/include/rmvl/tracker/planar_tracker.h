@@ -26,8 +26,8 @@ namespace rm
 class PlanarTracker final : public tracker
 {
 private:
-    KF21f _distance_filter;             //!< 距离滤波器
-    KF42f _motion_filter;               //!< 运动滤波器
+    KF21fCV _distance_filter;           //!< 距离滤波器
+    KF42fCV _motion_filter;             //!< 运动滤波器
     std::deque<float> _relative_speeds; //!< 图像速度的容器
     std::deque<RMStatus> _type_deque;   //!< 状态队列
 
@@ -56,6 +56,9 @@ public:
      */
     tracker::ptr clone() override;
 
+    //! 创建与本追踪器共享组合体的快照，参考 `tracker::snapshot()`
+    tracker::ptr snapshot() const override { return shareSlot(std::make_shared<PlanarTracker>(*this)); }
+
     /**
      * @brief 动态类型转换
      *
@@ -33,7 +33,7 @@ class RuneTracker final : public tracker
 {
     int _round{};         //!< 圈数
     float _rotated_speed; //!< 神符旋转角速度
-    KF21f _filter;        //!< 神符的角度滤波器
+    KF21fCV _filter;      //!< 神符的角度滤波器
 
 public:
     using ptr = std::shared_ptr<RuneTracker>;
@@ -62,6 +62,9 @@ public:
      */
     tracker::ptr clone() override;
 
+    //! 创建与本追踪器共享组合体的快照，参考 `tracker::snapshot()`
+    tracker::ptr snapshot() const override { return shareSlot(std::make_shared<RuneTracker>(*this)); }
+
     /**
      * @brief 动态类型转换
      *
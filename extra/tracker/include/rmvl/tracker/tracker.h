@@ -11,7 +11,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <deque>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
+#include <utility>
 
 #include "rmvl/combo/combo.h"
 
@@ -21,12 +27,161 @@ namespace rm
 //! @addtogroup tracker
 //! @{
 
+//! 追踪器观测历史，采用定长环形缓冲区并按 SoA 布局存储 POD 观测量，下标 `0` 表示最新一次观测
+class TrackerHistory
+{
+public:
+    static constexpr std::size_t MAX_CAPACITY = 32; //!< 最大容量
+
+private:
+    std::array<double, MAX_CAPACITY> _ticks{};        //!< 时间点
+    std::array<cv::Point2f, MAX_CAPACITY> _centers{}; //!< 图像中心点
+    std::array<float, MAX_CAPACITY> _angles{};        //!< 角度（组合体原始角度）
+    std::array<cv::Vec2f, MAX_CAPACITY> _poses{};     //!< 姿态法向量（仅装甲板有效）
+    std::array<cv::Vec3f, MAX_CAPACITY> _tvecs{};     //!< 相机外参平移向量
+
+    std::size_t _capacity{MAX_CAPACITY}; //!< 容量
+    std::size_t _head{};                 //!< 最新观测所在的物理下标
+    std::size_t _size{};                 //!< 观测数量
+
+public:
+    /**
+     * @brief 创建观测历史
+     *
+     * @param[in] capacity 容量，不超过 `MAX_CAPACITY`
+     */
+    explicit TrackerHistory(std::size_t capacity = MAX_CAPACITY) : _capacity(capacity)
+    {
+        if (capacity == 0 || capacity > MAX_CAPACITY)
+            RMVL_Error_(RMVL_StsOutOfRange, "capacity of the tracker history must be in [1, %zu]", MAX_CAPACITY);
+    }
+
+    /**
+     * @brief 添加最新观测，容量已满时覆盖最旧的观测
+     *
+     * @param[in] tick 时间点
+     * @param[in] center 图像中心点
+     * @param[in] angle 角度
+     * @param[in] pose 姿态法向量
+     * @param[in] tvec 相机外参平移向量
+     */
+    inline void push(double tick, const cv::Point2f &center, float angle, const cv::Vec2f &pose, const cv::Vec3f &tvec)
+    {
+        _head = (_head + _capacity - 1) % _capacity;
+        _ticks[_head] = tick;
+        _centers[_head] = center;
+        _angles[_head] = angle;
+        _poses[_head] = pose;
+        _tvecs[_head] = tvec;
+        if (_size < _capacity)
+            _size++;
+    }
+
+    /**
+     * @brief 使用新的时间点重复添加最新一次观测（即目标丢失时的操作）
+     *
+     * @param[in] tick 时间点
+     */
+    inline void repeat(double tick)
+    {
+        if (_size == 0)
+            return;
+        std::size_t last = _head;
+        push(tick, _centers[last], _angles[last], _poses[last], _tvecs[last]);
+    }
+
+    /**
+     * @brief 获取平均采样帧差时间
+     *
+     * @param[in] dft 观测数量不足 `2` 时返回的默认帧差时间
+     * @return 平均采样帧差时间
+     */
+    inline double duration(double dft) const { return _size >= 2 ? (tick(0) - tick(_size - 1)) / static_cast<double>(_size - 1) : dft; }
+
+    //! 获取第 `n` 新的观测时间点
+    inline double tick(std::size_t n) const { return _ticks[index(n)]; }
+    //! 获取第 `n` 新的观测图像中心点
+    inline const cv::Point2f &center(std::size_t n) const { return _centers[index(n)]; }
+    //! 获取第 `n` 新的观测角度
+    inline float angle(std::size_t n) const { return _angles[index(n)]; }
+    //! 获取第 `n` 新的观测姿态法向量
+    inline const cv::Vec2f &pose(std::size_t n) const { return _poses[index(n)]; }
+    //! 获取第 `n` 新的观测平移向量
+    inline const cv::Vec3f &tvec(std::size_t n) const { return _tvecs[index(n)]; }
+
+    //! 观测数量
+    inline std::size_t size() const { return _size; }
+    //! 容量
+    inline std::size_t capacity() const { return _capacity; }
+    //! 是否为空
+    inline bool empty() const { return _size == 0; }
+    //! 清空观测历史
+    inline void clear() { _head = _size = 0; }
+
+private:
+    //! 逻辑下标转换为物理下标，需保证下标安全
+    inline std::size_t index(std::size_t n) const
+    {
+        if (n >= _size)
+            RMVL_Error_(RMVL_StsOutOfRange, "index %zu is out of range of the tracker history (size: %zu)", n, _size);
+        return (_head + n) % _capacity;
+    }
+};
+
+/**
+ * @brief 追踪器槽位，为每个存活的追踪器分配一个稳定的小整数下标
+ * @note
+ * - 总是分配当前空闲的最小下标，追踪器析构后下标可被新的追踪器复用，因此下标不超过同时存活的追踪器数量
+ * @note
+ * - 拷贝构造（例如 `clone`）得到的追踪器会分配新的下标，赋值不改变下标
+ * @note
+ * - 快照通过 `share` 与原追踪器共享同一个下标，下标在共享者全部析构后才会被回收
+ */
+class TrackerSlot
+{
+public:
+    TrackerSlot() : _owner(std::make_shared<const Owner>()), _slot(_owner->slot) {}
+    TrackerSlot(const TrackerSlot &) : TrackerSlot() {}
+    TrackerSlot &operator=(const TrackerSlot &) { return *this; }
+
+    //! 槽位下标
+    inline std::size_t value() const { return _slot; }
+
+    /**
+     * @brief 改为与另一个槽位共享下标，原有下标在无其他共享者时被回收
+     *
+     * @param[in] other 另一个槽位
+     */
+    inline void share(const TrackerSlot &other) { _owner = other._owner, _slot = other._slot; }
+
+private:
+    //! 分配空闲的最小下标
+    static std::size_t acquire();
+    //! 回收下标
+    static void release(std::size_t slot);
+
+    //! 下标的所有者，最后一个共享者析构时回收下标
+    struct Owner
+    {
+        std::size_t slot{acquire()}; //!< 槽位下标
+
+        Owner() = default;
+        Owner(const Owner &) = delete;
+        Owner &operator=(const Owner &) = delete;
+        ~Owner() { release(slot); }
+    };
+
+    std::shared_ptr<const Owner> _owner; //!< 下标的所有者
+    std::size_t _slot;                   //!< 槽位下标，缓存以避免间接访问
+};
+
 //! 组合体时间序列
 class tracker
 {
 protected:
-    std::deque<combo::ptr> _combo_deque; //!< 组合体时间队列
-    uint32_t _vanish_num{};              //!< 消失帧数
+    combo::ptr _combo;       //!< 最新的组合体
+    TrackerHistory _history; //!< 观测历史
+    uint32_t _vanish_num{};  //!< 消失帧数
 
     RMStatus _type{};                  //!< 追踪器类型
     float _height{};                   //!< 追踪器高度（可表示修正后）
@@ -37,11 +192,45 @@ protected:
     std::vector<cv::Point2f> _corners; //!< 追踪器角点（可表示修正后）
     CameraExtrinsics _extrinsic;       //!< 相机外参（可表示修正后）
     cv::Point2f _speed;                //!< 相对目标转角速度
+    TrackerSlot _slot;                 //!< 槽位
+
+    /**
+     * @brief 创建追踪器
+     *
+     * @param[in] capacity 观测历史容量
+     */
+    explicit tracker(std::size_t capacity = TrackerHistory::MAX_CAPACITY) : _history(capacity) {}
+
+    /**
+     * @brief 将组合体作为最新观测，更新至时间序列
+     *
+     * @param[in] p_combo 组合体
+     * @param[in] pose 姿态法向量（仅装甲板有效）
+     */
+    inline void pushCombo(combo::ptr p_combo, const cv::Vec2f &pose = {})
+    {
+        _combo = p_combo;
+        _history.push(p_combo->getTick(), p_combo->getCenter(), p_combo->getAngle(), pose, p_combo->getExtrinsics().tvec());
+    }
+
+    /**
+     * @brief 令快照与本追踪器共享槽位下标，用于实现 `snapshot()`
+     *
+     * @param[in] p_snapshot 由本追踪器拷贝得到的快照
+     * @return 快照
+     */
+    inline std::shared_ptr<tracker> shareSlot(std::shared_ptr<tracker> p_snapshot) const
+    {
+        p_snapshot->_slot.share(_slot);
+        return p_snapshot;
+    }
 
 public:
     using ptr = std::shared_ptr<tracker>;
     using const_ptr = std::shared_ptr<const tracker>;
 
+    virtual ~tracker() = default;
+
     /**
      * @brief 从另一个追踪器进行构造
      *
@@ -49,6 +238,19 @@ public:
      */
     virtual ptr clone() = 0;
 
+    /**
+     * @brief 创建追踪器的快照
+     * @note
+     * - 与 `clone()` 不同，快照与本追踪器共享最新的组合体（组合体构造完成后不再修改），仅拷贝追踪器自身的状态
+     * - 快照用于在线程间传递序列组的只读视图，参考 `rm::GroupSnapshotPublisher`，不应再对快照调用 `update`
+     * - 快照与本追踪器共享槽位下标，不占用新的下标，因此不应与本追踪器存放在同一个 `TrackerMap` 中
+     * @note
+     * - 派生类应以拷贝构造实现，并通过 `shareSlot` 共享槽位下标，避免复制组合体
+     *
+     * @return 指向快照的共享指针
+     */
+    virtual ptr snapshot() const = 0;
+
     /**
      * @brief 使用已捕获的 `combo` 更新追踪器
      *
@@ -64,20 +266,42 @@ public:
      */
     virtual void update(double tick, const GyroData &gyro_data) = 0;
 
-    //! 获取时间队列中最新的组合体
-    inline combo::ptr front() const { return _combo_deque.front(); }
-    //! 获取时间队列中最后的组合体
-    inline combo::ptr back() const { return _combo_deque.back(); }
+    //! 获取时间序列中最新的组合体
+    inline combo::ptr front() const { return _combo; }
+    //! 获取时间序列中最旧的组合体，序列长度大于 `1` 时为重建的组合体，不能向下转型，参考 `at()`
+    inline combo::ptr back() const { return at(_history.size() - 1); }
     //! 获取掉帧数
     inline uint32_t getVanishNumber() const { return _vanish_num; }
     //! 获取序列数量信息
-    inline size_t size() const { return _combo_deque.size(); }
-    //! 获取时间序列原始数据
-    inline const auto &data() const { return _combo_deque; }
+    inline size_t size() const { return _history.size(); }
+    //! 获取时间序列的观测历史
+    inline const TrackerHistory &history() const { return _history; }
     //! 序列是否为空
-    inline bool empty() const { return _combo_deque.empty(); }
-    //! 索引 - 容器仅能通过内部 at 实现访问保证下标安全
-    inline combo::ptr at(size_t _n) const { return _combo_deque.at(_n); }
+    inline bool empty() const { return _history.empty(); }
+
+    /**
+     * @brief 索引 - 获取第 `n` 新的组合体
+     * @note
+     * - 时间序列仅保留最新的组合体，`n > 0` 时由观测历史重建组合体：时间点、中心点、角度和相机外参的平移向量取自
+     *   第 `n` 新的观测，其余属性与最新的组合体相同，且不包含特征
+     * @note
+     * - 重建的组合体是通用的组合体类型，而不是最新组合体的具体类型（例如 `Armor`），因此不能向下转型，
+     *   `Armor::cast(p_tracker->at(1))` 等调用将返回空指针；需要具体类型的属性（例如装甲板大小类型）时请使用 `front()`
+     * @note
+     * - 重建的组合体每次调用均会分配内存，仅需要观测量时请直接使用 `history()` 访问
+     *
+     * @param[in] _n 下标，`0` 表示最新的组合体
+     * @return 第 `n` 新的组合体
+     */
+    combo::ptr at(size_t _n) const;
+
+    /**
+     * @brief 获取时间序列原始数据，即由新至旧排列的全部组合体，参考 `at()`
+     * @deprecated 每次调用都会重建全部历史组合体，请使用 `history()` 访问观测量
+     *
+     * @return 组合体列表
+     */
+    [[deprecated("use \"history()\" instead")]] std::deque<combo::ptr> data() const;
 
     //! 追踪器类型
     inline RMStatus getType() const { return _type; }
@@ -97,6 +321,8 @@ public:
     inline const CameraExtrinsics &getExtrinsics() const { return _extrinsic; }
     //! 获取追踪器修正后的目标转角速度（角度制）
     inline const cv::Point2f &getSpeed() const { return _speed; }
+    //! 获取追踪器的槽位下标，在追踪器的生命周期内保持不变，可作为稠密表格的下标
+    inline std::size_t slot() const { return _slot.value(); }
 };
 
 //! 默认追踪器，时间序列仅用于存储组合体，可退化为 `combos` 使用
@@ -124,6 +350,9 @@ public:
      */
     tracker::ptr clone() override;
 
+    //! 创建与本追踪器共享组合体的快照，参考 `tracker::snapshot()`
+    tracker::ptr snapshot() const override { return shareSlot(std::make_shared<DefaultTracker>(*this)); }
+
     /**
      * @brief 使用已捕获的 `combo` 更新追踪器
      *
@@ -143,6 +372,231 @@ private:
     void updateData(combo::ptr p_combo);
 };
 
+/**
+ * @brief 以追踪器槽位下标寻址的紧凑映射表，用于替代 `std::unordered_map<tracker::ptr, T>`
+ * @note
+ * - 键值对按照插入顺序紧凑地存储在连续的数组中，另以槽位下标为索引记录每个键值对在数组中的位置，查找、插入均为
+ *   \f$O(1)\f$ 的数组访问，不需要计算哈希，也没有节点分配
+ * @note
+ * - 键值对数组的大小仅与插入的元素数量有关，与槽位下标无关，例如仅存放一个序列组的追踪器时，不会因为其他序列组占用了较小的
+ *   槽位下标而分配、遍历空的键值对；槽位索引每项仅占用 4 字节
+ * @note
+ * - 提供 `operator[]`、`at`、`find`、`emplace`、`merge` 以及范围 `for` 等与 `std::unordered_map` 相同的接口，
+ *   未删除元素时遍历顺序为插入顺序
+ * @note
+ * - `erase` 以末尾的键值对填补被删除的位置，反复插入、删除时键值对数组的大小始终等于元素数量；`clear` 保留已分配的内存，
+ *   每帧复用同一个映射表时不会产生内存分配
+ * @note
+ * - 迭代器失效规则与 `std::vector` 类似：插入新元素可能使所有迭代器、引用失效，删除元素使被删除元素以及末尾元素的
+ *   迭代器、引用失效
+ *
+ * @tparam Key 键类型，`tracker::ptr` 或 `tracker::const_ptr`
+ * @tparam T 值类型，需要支持默认构造
+ */
+template <typename Key, typename T>
+class TrackerMap
+{
+public:
+    using key_type = Key;                 //!< 键类型
+    using mapped_type = T;                //!< 值类型
+    using value_type = std::pair<Key, T>; //!< 键值对类型
+    using size_type = std::size_t;        //!< 大小类型
+
+    using iterator = value_type *;             //!< 迭代器
+    using const_iterator = const value_type *; //!< 常量迭代器
+
+    TrackerMap() = default;
+
+    /**
+     * @brief 从 `std::unordered_map` 构造，用于兼容旧接口
+     *
+     * @param[in] map 以追踪器为键的哈希表
+     */
+    template <typename K>
+    TrackerMap(const std::unordered_map<K, T> &map)
+    {
+        for (const auto &[key, val] : map)
+            (*this)[key] = val;
+    }
+
+    inline iterator begin() { return _data.data(); }
+    inline iterator end() { return _data.data() + _data.size(); }
+    inline const_iterator begin() const { return _data.data(); }
+    inline const_iterator end() const { return _data.data() + _data.size(); }
+
+    //! 元素数量
+    inline size_type size() const { return _data.size(); }
+    //! 是否为空
+    inline bool empty() const { return _data.empty(); }
+    //! 已分配的键值对存储空间
+    inline size_type capacity() const { return _data.capacity(); }
+
+    /**
+     * @brief 预留元素的存储空间，避免插入时重新分配内存
+     *
+     * @param[in] n 元素数量
+     */
+    inline void reserve(size_type n) { _data.reserve(n); }
+
+    //! 清空所有元素，保留已分配的内存
+    inline void clear()
+    {
+        for (const auto &entry : _data)
+            _index[entry.first->slot()] = 0;
+        _data.clear();
+    }
+
+    /**
+     * @brief 查找追踪器对应的元素
+     *
+     * @param[in] key 追踪器
+     * @return 指向该元素的迭代器，不存在时返回 `end()`
+     */
+    template <typename P>
+    inline iterator find(const P &key)
+    {
+        auto p = lookup(key);
+        return p ? p : end();
+    }
+
+    //! @overload
+    template <typename P>
+    inline const_iterator find(const P &key) const
+    {
+        auto p = lookup(key);
+        return p ? p : end();
+    }
+
+    //! 是否包含追踪器对应的元素
+    template <typename P>
+    inline size_type count(const P &key) const { return find(key) != end(); }
+
+    /**
+     * @brief 访问追踪器对应的元素
+     *
+     * @param[in] key 追踪器
+     * @return 元素的引用，不存在时抛出 `RMVL_StsOutOfRange` 异常
+     */
+    template <typename P>
+    inline T &at(const P &key) { return const_cast<T &>(std::as_const(*this).at(key)); }
+
+    //! @overload
+    template <typename P>
+    const T &at(const P &key) const
+    {
+        auto p = lookup(key);
+        if (p == nullptr)
+            RMVL_Error(RMVL_StsOutOfRange, "the tracker does not exist in the tracker map");
+        return p->second;
+    }
+
+    /**
+     * @brief 访问追踪器对应的元素，不存在时插入默认值
+     *
+     * @param[in] key 追踪器
+     * @return 元素的引用
+     */
+    T &operator[](const Key &key) { return emplace(key).first->second; }
+
+    /**
+     * @brief 原位构造追踪器对应的元素，已存在时不做任何操作
+     *
+     * @param[in] key 追踪器，不允许与表中已有的其他追踪器（例如自身的快照）占用同一个槽位
+     * @param[in] args 值的构造参数
+     * @return 指向该元素的迭代器以及是否插入成功
+     * @note 插入新元素时可能重新分配键值对数组，此前获取的所有迭代器、引用均会失效
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(const Key &key, Args &&...args)
+    {
+        std::size_t slot = key->slot();
+        if (slot >= _index.size())
+        {
+            // 槽位下标一般较小，首次分配时即预留足够的空间，避免逐个增长
+            if (slot >= _index.capacity())
+                _index.reserve(std::max<std::size_t>(2 * slot + 2, 16));
+            _index.resize(slot + 1);
+        }
+        auto &pos = _index[slot];
+        if (pos != 0)
+        {
+            auto &entry = _data[pos - 1];
+            if (entry.first != key)
+                RMVL_Error_(RMVL_StsBadArg, "slot %zu is already used by another tracker in the tracker map", slot);
+            return {&entry, false};
+        }
+        _data.emplace_back(key, T(std::forward<Args>(args)...));
+        pos = static_cast<uint32_t>(_data.size());
+        return {&_data.back(), true};
+    }
+
+    /**
+     * @brief 删除追踪器对应的元素
+     * @note 以末尾的键值对填补被删除的位置，键值对数组始终保持紧凑。指向被删除元素和末尾元素的迭代器、引用会失效，
+     *       其余元素不受影响，因此不能在遍历本表的同时删除元素
+     *
+     * @param[in] key 追踪器
+     * @return 删除的元素数量
+     */
+    template <typename P>
+    size_type erase(const P &key)
+    {
+        auto p = lookup(key);
+        if (p == nullptr)
+            return 0;
+        _index[p->first->slot()] = 0;
+        if (p != &_data.back())
+        {
+            *p = std::move(_data.back());
+            _index[p->first->slot()] = static_cast<uint32_t>(p - _data.data() + 1);
+        }
+        _data.pop_back();
+        return 1;
+    }
+
+    /**
+     * @brief 将另一个映射表中本表不存在的元素移动至本表，与 `std::unordered_map::merge` 语义相同
+     *
+     * @param[in] other 另一个映射表，移动成功的元素会从中删除
+     */
+    void merge(TrackerMap &other)
+    {
+        if (&other == this)
+            return;
+        // 逆序遍历，删除时用于填补的末尾元素均已访问过
+        for (std::size_t i = other._data.size(); i-- > 0;)
+        {
+            auto key = other._data[i].first;
+            if (emplace(key, std::move(other._data[i].second)).second)
+                other.erase(key);
+        }
+    }
+
+    //! @overload
+    inline void merge(TrackerMap &&other) { merge(other); }
+
+private:
+    //! 查找追踪器所在的槽位，不存在时返回空指针
+    template <typename P>
+    inline const value_type *lookup(const P &key) const
+    {
+        if (key == nullptr)
+            return nullptr;
+        std::size_t slot = key->slot();
+        if (slot >= _index.size() || _index[slot] == 0)
+            return nullptr;
+        const auto &entry = _data[_index[slot] - 1];
+        return entry.first == key ? &entry : nullptr;
+    }
+
+    //! @overload
+    template <typename P>
+    inline value_type *lookup(const P &key) { return const_cast<value_type *>(std::as_const(*this).lookup(key)); }
+
+    std::vector<value_type> _data; //!< 紧凑排列的键值对
+    std::vector<uint32_t> _index;  //!< 以槽位下标为索引的键值对位置，`0` 表示不存在，否则为位置 `+1`
+};
+
 //! @} tracker
 
 } // namespace rm
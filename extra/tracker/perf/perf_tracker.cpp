@@ -0,0 +1,127 @@
+/**
+ * @file perf_tracker.cpp
+ * @author RoboMaster Vision Community
+ * @brief 追踪器更新、拷贝开销及内存占用基准测试
+ * @version 1.0
+ * @date 2024-10-17
+ *
+ * @copyright Copyright 2024 (c), RoboMaster Vision Community
+ *
+ */
+
+#include "rmvl/rmvl_modules.hpp"
+
+#if defined(HAVE_RMVL_PLANAR_TRACKER) && defined(HAVE_RMVL_GYRO_TRACKER)
+
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+
+#include "rmvl/tracker/gyro_tracker.h"
+#include "rmvl/tracker/planar_tracker.h"
+
+#include "rmvlpara/camera/camera.h"
+
+namespace rm_test
+{
+
+static rm::LightBlob::ptr buildBlob(float angle, cv::Point center)
+{
+    cv::Mat src = cv::Mat::zeros(cv::Size(1280, 1024), CV_8UC1);
+    cv::Point base_bias(static_cast<int>(-110 * std::sin(rm::deg2rad(angle))),
+                        static_cast<int>(110 * std::cos(rm::deg2rad(angle))));
+    cv::line(src, center - base_bias / 2, center + base_bias / 2, cv::Scalar(255), 12);
+    std::vector<std::vector<cv::Point>> contours;
+    cv::findContours(src, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE);
+    return rm::LightBlob::make_feature(contours.front());
+}
+
+//! 构造 `n` 帧连续移动的装甲板
+static std::vector<rm::combo::ptr> buildArmors(std::size_t n)
+{
+    rm::para::camera_param.cameraMatrix = {1500, 0, 640,
+                                           0, 1500, 512,
+                                           0, 0, 1};
+    rm::para::camera_param.distCoeffs = {};
+    std::vector<rm::combo::ptr> armors;
+    armors.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        cv::Point center(400 + static_cast<int>(i % 64) * 4, 300);
+        auto left = buildBlob(8, center - cv::Point(124, 17));
+        auto right = buildBlob(8, center + cv::Point(124, 17));
+        armors.push_back(rm::Armor::make_combo(left, right, rm::GyroData(), 0.01 * static_cast<double>(i)));
+    }
+    return armors;
+}
+
+template <typename Tracker>
+static void tracker_update(benchmark::State &state)
+{
+    static const auto armors = buildArmors(128);
+    for (auto _ : state)
+    {
+        auto p_tracker = Tracker::make_tracker(armors.front());
+        for (std::size_t i = 1; i < armors.size(); ++i)
+            p_tracker->update(armors[i]);
+        benchmark::DoNotOptimize(p_tracker->getSpeed());
+    }
+    state.counters["bytes/tracker"] = sizeof(Tracker);
+}
+
+template <typename Tracker>
+static void tracker_clone(benchmark::State &state)
+{
+    static const auto armors = buildArmors(128);
+    auto p_tracker = Tracker::make_tracker(armors.front());
+    for (std::size_t i = 1; i < armors.size(); ++i)
+        p_tracker->update(armors[i]);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(p_tracker->clone());
+    state.counters["history"] = static_cast<double>(p_tracker->size());
+}
+
+static void planar_tracker_vanish(benchmark::State &state)
+{
+    static const auto armors = buildArmors(1);
+    for (auto _ : state)
+    {
+        auto p_tracker = rm::PlanarTracker::make_tracker(armors.front());
+        for (int i = 0; i < 128; ++i)
+            p_tracker->update(0.01 * i, rm::GyroData());
+        benchmark::DoNotOptimize(p_tracker->size());
+    }
+}
+
+// 每帧 5 张结果表（补偿、飞行时间、预测量），20 个追踪器，先写入后查询
+template <typename Map>
+static void result_table(benchmark::State &state)
+{
+    static const auto armors = buildArmors(20);
+    std::vector<rm::tracker::ptr> trackers;
+    for (const auto &p_armor : armors)
+        trackers.push_back(rm::GyroTracker::make_tracker(p_armor));
+    double sum{};
+    for (auto _ : state)
+    {
+        Map maps[5];
+        for (auto &map : maps)
+            for (const auto &p_tracker : trackers)
+                map[p_tracker] = sum;
+        for (const auto &map : maps)
+            for (const auto &p_tracker : trackers)
+                sum += map.at(p_tracker);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(tracker_update<rm::PlanarTracker>)->Name("planar tracker update (n: 128)")->Iterations(100);
+BENCHMARK(tracker_update<rm::GyroTracker>)->Name("gyro tracker update (n: 128)  ")->Iterations(100);
+BENCHMARK(tracker_clone<rm::PlanarTracker>)->Name("planar tracker clone         ")->Iterations(10000);
+BENCHMARK(tracker_clone<rm::GyroTracker>)->Name("gyro tracker clone           ")->Iterations(10000);
+BENCHMARK(planar_tracker_vanish)->Name("planar tracker vanish (n: 128)")->Iterations(1000);
+BENCHMARK(result_table<std::unordered_map<rm::tracker::ptr, double>>)->Name("result table - unordered_map ");
+BENCHMARK(result_table<rm::TrackerMap<rm::tracker::ptr, double>>)->Name("result table - TrackerMap    ");
+
+} // namespace rm_test
+
+#endif
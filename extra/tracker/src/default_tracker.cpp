@@ -24,30 +24,27 @@ void DefaultTracker::updateData(combo::ptr p_combo)
     _extrinsic = p_combo->getExtrinsics();
 }
 
-DefaultTracker::DefaultTracker(combo::ptr p_combo) : tracker()
+DefaultTracker::DefaultTracker(combo::ptr p_combo) : tracker(32)
 {
     if (p_combo == nullptr)
         RMVL_Error(RMVL_StsBadArg, "Pointer of the input argument \"combo::ptr\" is null pointer");
-    _combo_deque = {p_combo};
+    pushCombo(p_combo);
     updateData(p_combo);
 }
 
 tracker::ptr DefaultTracker::clone()
 {
     auto retval = std::make_shared<DefaultTracker>(*this);
-    // 更新内部所有组合体
-    for (auto &p_combo : retval->_combo_deque)
-        p_combo = p_combo->clone(p_combo->getTick());
+    // 观测历史为 POD 数据，仅需更新最新的组合体
+    if (retval->_combo != nullptr)
+        retval->_combo = retval->_combo->clone(retval->_combo->getTick());
     return retval;
 }
 
-
 void DefaultTracker::update(combo::ptr p_combo)
 {
     updateData(p_combo);
-    _combo_deque.push_front(p_combo);
-    if (_combo_deque.size() > 32U)
-        _combo_deque.pop_back();
+    pushCombo(p_combo);
     _vanish_num = 0;
 }
 
@@ -19,17 +19,16 @@ namespace rm
 
 void GyroTracker::initFilter()
 {
-    auto first_combo = _combo_deque.front();
     // 初始化位置滤波器
     _center3d_filter.setR(para::gyro_tracker_param.POSITION_R);
     _center3d_filter.setQ(para::gyro_tracker_param.POSITION_Q);
-    const auto &tvec = first_combo->getExtrinsics().tvec();
+    const auto &tvec = _history.tvec(0);
     cv::Matx61f init_position_vec = {tvec(0), tvec(1), tvec(2), 0, 0, 0};
     _center3d_filter.init(init_position_vec, 1e5f);
     // 初始化姿态滤波器
     _pose_filter.setR(para::gyro_tracker_param.POSE_R);
     _pose_filter.setQ(para::gyro_tracker_param.POSE_Q);
-    const auto &pose = Armor::cast(first_combo)->getPose();
+    const auto &pose = _history.pose(0);
     cv::Vec4f init_pose_vec = {pose(0), pose(1), 0, 0};
     _pose_filter.init(init_pose_vec, 1e5f);
 }
@@ -47,7 +46,7 @@ void GyroTracker::updatePositionFilter()
     // 预测
     _center3d_filter.predict();
     // 更新
-    cv::Vec3f tvec = at(0)->getExtrinsics().tvec();
+    cv::Vec3f tvec = _history.tvec(0);
     cv::Matx61f correct_position = _center3d_filter.correct(tvec);
     _extrinsic.tvec({correct_position(0), correct_position(1), correct_position(2)});
 }
@@ -63,7 +62,7 @@ void GyroTracker::updatePoseFilter()
     // 预测
     _pose_filter.predict();
     // 更新
-    cv::Vec2f pose = Armor::cast(front())->getPose();
+    cv::Vec2f pose = _history.pose(0);
     cv::Matx41f correct_pose = _pose_filter.correct(pose);
     _pose = {correct_pose(0), correct_pose(1)};
 }
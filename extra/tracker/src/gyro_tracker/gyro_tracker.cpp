@@ -27,7 +27,7 @@ void GyroTracker::updateFromCombo(combo::ptr p_combo)
     _pose = Armor::cast(p_combo)->getPose();
 }
 
-GyroTracker::GyroTracker(combo::ptr p_armor)
+GyroTracker::GyroTracker(combo::ptr p_armor) : tracker(32)
 {
     if (p_armor == nullptr)
         RMVL_Error(RMVL_StsBadArg, "Input argument \"p_armor\" is nullptr.");
@@ -35,7 +35,7 @@ GyroTracker::GyroTracker(combo::ptr p_armor)
 
     _extrinsic = p_armor->getExtrinsics();
     _type = p_armor->getType();
-    _combo_deque.push_back(p_armor);
+    pushCombo(p_armor, _pose);
     _type_deque.push_back(_type.RobotTypeID);
     _duration = para::gyro_tracker_param.SAMPLE_INTERVAL / 1000.;
     initFilter();
@@ -44,9 +44,8 @@ GyroTracker::GyroTracker(combo::ptr p_armor)
 tracker::ptr GyroTracker::clone()
 {
     auto retval = std::make_shared<GyroTracker>(*this);
-    // 更新内部所有组合体
-    for (auto &p_combo : retval->_combo_deque)
-        p_combo = p_combo->clone(p_combo->getTick());
+    // 观测历史为 POD 数据，仅需更新最新的组合体
+    retval->_combo = retval->_combo->clone(retval->_combo->getTick());
     return retval;
 }
 
@@ -56,15 +55,11 @@ void GyroTracker::update(combo::ptr p_armor)
         RMVL_Error(RMVL_StsBadArg, "Input argument \"p_armor\" is nullptr.");
     // Reset the vanish number
     updateFromCombo(p_armor);
-    _combo_deque.emplace_front(p_armor);
+    pushCombo(p_armor, _pose);
     // 更新装甲板类型
     updateType(p_armor->getType());
     // 帧差时间计算
-    if (_combo_deque.empty())
-        RMVL_Error(RMVL_StsBadSize, "\"_combo_deque\" is empty");
-    _duration = (_combo_deque.size() >= 2)
-                    ? (_combo_deque.front()->getTick() - _combo_deque.back()->getTick()) / static_cast<double>(_combo_deque.size() - 1)
-                    : para::gyro_tracker_param.SAMPLE_INTERVAL / 1000.;
+    _duration = _history.duration(para::gyro_tracker_param.SAMPLE_INTERVAL / 1000.);
     if (std::isnan(_duration))
         RMVL_Error(RMVL_StsDivByZero, "\"t\" is nan");
     // 更新滤波器
@@ -72,9 +67,6 @@ void GyroTracker::update(combo::ptr p_armor)
     updatePoseFilter();
     // 计算旋转角速度
     _rotspeed = calcRotationSpeed();
-    // 容量上限 32
-    if (_combo_deque.size() > 32U)
-        _combo_deque.pop_back();
 }
 
 void GyroTracker::updateType(RMStatus stat)
@@ -111,8 +103,7 @@ float GyroTracker::calcRotationSpeed()
     if (pose_num < 2)
         return 0.f;
     // 逐差计算速度，pose 为 combo 指向 center，现需要取反
-    float rotspeed = calcAngleFrom2Vec(-Armor::cast(at(pose_num - 1))->getPose(),
-                                       -Armor::cast(at(0))->getPose()) /
+    float rotspeed = calcAngleFrom2Vec(-_history.pose(pose_num - 1), -_history.pose(0)) /
                      (static_cast<float>(pose_num - 1) * _duration);
     // 速度限幅
     float abs_rotspeed = abs(rotspeed);
@@ -18,7 +18,7 @@ namespace rm
 
 void PlanarTracker::initFilter()
 {
-    combo::ptr first_combo = _combo_deque.front();
+    combo::ptr first_combo = front();
     // 初始化距离滤波器
     _distance_filter.setR({para::planar_tracker_param.DIS_R});
     _distance_filter.setQ(para::planar_tracker_param.DIS_Q);
@@ -38,7 +38,7 @@ void PlanarTracker::updateDistanceFilter()
     // 设置状态转移矩阵
     _distance_filter.setA({1, 1,
                            0, 1});
-    float current_distance = _combo_deque.front()->getExtrinsics().distance();
+    float current_distance = front()->getExtrinsics().distance();
     // 预测
     _distance_filter.predict();
     // 更新
@@ -49,11 +49,7 @@ void PlanarTracker::updateDistanceFilter()
 void PlanarTracker::updateMotionFilter()
 {
     // 采样时间
-    float t = 0.f;
-    if (_combo_deque.size() >= 2)
-        t = (_combo_deque.front()->getTick() - _combo_deque.back()->getTick()) / static_cast<double>(_combo_deque.size() - 1);
-    else
-        t = para::planar_tracker_param.SAMPLE_INTERVAL / 1000.;
+    float t = _history.duration(para::planar_tracker_param.SAMPLE_INTERVAL / 1000.);
     // 设置状态转移矩阵
     _motion_filter.setA({1, 0, t, 0,
                          0, 1, 0, t,
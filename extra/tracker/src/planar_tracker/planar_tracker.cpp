@@ -26,11 +26,11 @@ void PlanarTracker::updateData(combo::ptr p_combo)
     _extrinsic = p_combo->getExtrinsics();
 }
 
-PlanarTracker::PlanarTracker(combo::ptr p_combo)
+PlanarTracker::PlanarTracker(combo::ptr p_combo) : tracker(11)
 {
     if (p_combo == nullptr)
         RMVL_Error(RMVL_StsBadArg, "Pointer of the input argument combo::ptr is null pointer");
-    _combo_deque.emplace_front(p_combo);
+    pushCombo(p_combo);
     _type = p_combo->getType(); // tracker 状态初始化
     _type_deque.emplace_front(_type);
     initFilter();
@@ -41,9 +41,8 @@ PlanarTracker::PlanarTracker(combo::ptr p_combo)
 tracker::ptr PlanarTracker::clone()
 {
     auto retval = std::make_shared<PlanarTracker>(*this);
-    // 更新内部所有组合体
-    for (auto &p_combo : retval->_combo_deque)
-        p_combo = p_combo->clone(p_combo->getTick());
+    // 观测历史为 POD 数据，仅需更新最新的组合体
+    retval->_combo = retval->_combo->clone(retval->_combo->getTick());
     return retval;
 }
 
@@ -53,7 +52,7 @@ void PlanarTracker::update(combo::ptr p_combo)
         RMVL_Error(RMVL_StsBadArg, "Pointer of the input argument combo::ptr is nullptr");
 
     updateData(p_combo);
-    _combo_deque.emplace_front(p_combo);
+    pushCombo(p_combo);
     // 更新状态
     updateType(p_combo->getType());
     // 重置丢失帧数
@@ -63,17 +62,15 @@ void PlanarTracker::update(combo::ptr p_combo)
     updateDistanceFilter();
     // 更新平面运动轨迹 KF
     updateMotionFilter();
-
-    if (_combo_deque.size() >= 12U)
-        _combo_deque.pop_back();
 }
 
 void PlanarTracker::update(double tick, [[maybe_unused]] const GyroData &gyro_data)
 {
-    if (_combo_deque.empty())
+    if (_history.empty())
         return;
     _vanish_num++;
-    _combo_deque.push_back(_combo_deque.front()->clone(tick));
+    // 仅以新的时间点重复最新一次观测，不再深拷贝组合体
+    _history.repeat(tick);
 }
 
 void PlanarTracker::updateType(RMStatus stat)
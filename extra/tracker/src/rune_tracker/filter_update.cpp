@@ -19,8 +19,6 @@ namespace rm
 
 void RuneTracker::initFilter(float init_angle, float init_speed)
 {
-    auto first_combo = _combo_deque.front();
-
     // 初始化旋转滤波器
     _filter.setR({para::rune_tracker_param.ROTATE_R});
     _filter.setQ(para::rune_tracker_param.ROTATE_Q);
@@ -26,11 +26,11 @@ void RuneTracker::updateFromRune(combo::ptr p_combo)
     _relative_angle = p_combo->getRelativeAngle();
 }
 
-RuneTracker::RuneTracker(combo::ptr p_rune)
+RuneTracker::RuneTracker(combo::ptr p_rune) : tracker(7)
 {
     if (p_rune == nullptr)
         RMVL_Error(RMVL_StsBadArg, "Pointer of the input argument combo::ptr is null pointer");
-    _combo_deque.emplace_front(p_rune);
+    pushCombo(p_rune);
     initFilter(p_rune->getAngle(), 0.f);
     _angle = p_rune->getAngle();
     _center = p_rune->getCenter();
@@ -40,9 +40,8 @@ RuneTracker::RuneTracker(combo::ptr p_rune)
 tracker::ptr RuneTracker::clone()
 {
     auto retval = std::make_shared<RuneTracker>(*this);
-    // 更新内部所有组合体
-    for (auto &p_combo : retval->_combo_deque)
-        p_combo = p_combo->clone(p_combo->getTick());
+    // 观测历史为 POD 数据，仅需更新最新的组合体
+    retval->_combo = retval->_combo->clone(retval->_combo->getTick());
     return retval;
 }
 
@@ -52,32 +51,26 @@ void RuneTracker::update(combo::ptr p_rune)
         RMVL_Error(RMVL_StsBadArg, "Pointer of the input argument combo::ptr is nullptr");
     else
     {
-        _combo_deque.push_front(p_rune);
+        pushCombo(p_rune);
         // 数据更新
         updateFromRune(p_rune);
         // 更新神符转动的圈数，并计算在考虑圈数时的完全值
         _angle = calculateTotalAngle();
         // 更新滤波器
-        float t = 0.f;
-        if (_combo_deque.size() >= 2)
-            t = (_combo_deque.front()->getTick() - _combo_deque.back()->getTick()) / static_cast<double>(_combo_deque.size() - 1);
-        else
-            t = para::rune_tracker_param.SAMPLE_INTERVAL / 1000.;
+        float t = _history.duration(para::rune_tracker_param.SAMPLE_INTERVAL / 1000.);
         updateRotateFilter(t);
         // 重置消失帧数
         _vanish_num = 0;
     }
-    if (_combo_deque.size() >= 8U)
-        _combo_deque.pop_back();
 }
 
 float RuneTracker::calculateTotalAngle()
 {
     // 若当前容器 size < 2 则圈数为默认0
-    if (_combo_deque.size() < 2)
-        return front()->getAngle();
-    float current_angle = _combo_deque.at(0)->getAngle();
-    float last_angle = _combo_deque.at(1)->getAngle();
+    if (_history.size() < 2)
+        return _history.angle(0);
+    float current_angle = _history.angle(0);
+    float last_angle = _history.angle(1);
     // 角度判断，计算圈数
     if (current_angle > 135.f && last_angle < -135.f) // 顺时针
         _round--;
@@ -88,7 +81,7 @@ float RuneTracker::calculateTotalAngle()
     while (fabs(current_angle) > 180.f)
         current_angle += (current_angle > 0.f) ? -360.f : 360.f;
     // 更新角度
-    auto p_rune = Rune::cast(_combo_deque.front());
+    auto p_rune = Rune::cast(front());
     RMVL_DbgAssert(p_rune != nullptr);
     return current_angle + 360.f * _round;
 }
@@ -59,21 +59,17 @@ static Rune::ptr runeConstructForced(Rune::ptr ref_rune, float delta_angle, doub
 void RuneTracker::update(double tick, const GyroData &gyro_data)
 {
     // 判空
-    if (_combo_deque.empty())
+    if (_history.empty())
         return;
     _vanish_num++;
     // 获取帧差时间
-    float t = 0.f;
-    if (_combo_deque.size() >= 2)
-        t = (_combo_deque.front()->getTick() - _combo_deque.back()->getTick()) / static_cast<double>(_combo_deque.size() - 1);
-    else
-        t = para::rune_tracker_param.SAMPLE_INTERVAL / 1000.;
+    float t = _history.duration(para::rune_tracker_param.SAMPLE_INTERVAL / 1000.);
     _filter.setA({1, t,
                   0, 1});
     // 旋转状态先验估计
     auto rotate_pre = _filter.predict();
 
-    auto p_rune = runeConstructForced(Rune::cast(_combo_deque.front()),
+    auto p_rune = runeConstructForced(Rune::cast(front()),
                                       rotate_pre(0) - _angle, tick, gyro_data);
     _angle = p_rune->getAngle();
 
@@ -85,7 +81,7 @@ void RuneTracker::update(double tick, const GyroData &gyro_data)
     _relative_angle = calculateRelativeAngle(para::camera_param.cameraMatrix, relative_center);
     // 直接更新后验估计
     _filter.correct({rotate_pre(0)});
-    _combo_deque.emplace_front(p_rune);
+    pushCombo(p_rune);
 }
 
 } // namespace rm
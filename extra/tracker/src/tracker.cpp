@@ -0,0 +1,60 @@
+/**
+ * @file tracker.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 追踪器时间序列访问
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include "rmvl/tracker/tracker.h"
+
+namespace rm
+{
+
+//! 由观测历史重建的组合体，仅用于 `tracker::at()` 访问历史观测
+class HistoryCombo final : public combo
+{
+public:
+    /**
+     * @brief 由最新的组合体与一次历史观测构造
+     *
+     * @param[in] latest 最新的组合体
+     * @param[in] history 观测历史
+     * @param[in] n 历史观测下标
+     */
+    HistoryCombo(const combo &latest, const TrackerHistory &history, std::size_t n) : combo(latest)
+    {
+        _features.clear();
+        _tick = history.tick(n);
+        _center = history.center(n);
+        _angle = history.angle(n);
+        _extrinsic.tvec(history.tvec(n));
+    }
+
+    combo::ptr clone(double tick) override
+    {
+        auto retval = std::make_shared<HistoryCombo>(*this);
+        retval->_tick = tick;
+        return retval;
+    }
+};
+
+combo::ptr tracker::at(size_t _n) const
+{
+    if (_combo == nullptr || _n >= _history.size())
+        RMVL_Error_(RMVL_StsOutOfRange, "index %zu is out of range of the tracker (size: %zu)", _n, _history.size());
+    return _n == 0 ? _combo : std::make_shared<HistoryCombo>(*_combo, _history, _n);
+}
+
+std::deque<combo::ptr> tracker::data() const
+{
+    std::deque<combo::ptr> retval;
+    for (std::size_t i = 0; i < _history.size(); ++i)
+        retval.push_back(at(i));
+    return retval;
+}
+
+} // namespace rm
@@ -0,0 +1,57 @@
+/**
+ * @file tracker_slot.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 追踪器槽位分配
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "rmvl/tracker/tracker.h"
+
+namespace rm
+{
+
+//! 槽位分配状态
+struct SlotPool
+{
+    std::mutex mtx;                //!< 槽位分配锁
+    std::vector<std::size_t> free; //!< 空闲下标，按照小顶堆排列
+    std::size_t next{};            //!< 从未分配过的最小下标
+};
+
+//! 槽位分配状态不析构，静态存储期的追踪器在程序退出时仍可安全回收下标
+static SlotPool &pool()
+{
+    static SlotPool *p = new SlotPool;
+    return *p;
+}
+
+std::size_t TrackerSlot::acquire()
+{
+    auto &sp = pool();
+    std::lock_guard lk(sp.mtx);
+    if (sp.free.empty())
+        return sp.next++;
+    std::pop_heap(sp.free.begin(), sp.free.end(), std::greater<>{});
+    std::size_t slot = sp.free.back();
+    sp.free.pop_back();
+    return slot;
+}
+
+void TrackerSlot::release(std::size_t slot)
+{
+    auto &sp = pool();
+    std::lock_guard lk(sp.mtx);
+    sp.free.push_back(slot);
+    std::push_heap(sp.free.begin(), sp.free.end(), std::greater<>{});
+}
+
+} // namespace rm
@@ -117,6 +117,40 @@ TEST_F(PlanarTrackerTest, tracker_update_with_none)
     EXPECT_EQ(p_tracker->getVanishNumber(), 1);
 }
 
+// 追踪器观测历史容量验证
+TEST_F(PlanarTrackerTest, tracker_history_capacity)
+{
+    rm::Armor::ptr armor = buildArmor(cv::Point(500, 300), 8);
+    rm::tracker::ptr p_tracker = rm::PlanarTracker::make_tracker(armor);
+    for (int i = 1; i <= 20; ++i)
+        p_tracker->update(armor->getTick() + 0.01 * i, gyro_data);
+    const auto &history = p_tracker->history();
+    EXPECT_EQ(history.size(), history.capacity());
+    EXPECT_DOUBLE_EQ(history.tick(0), armor->getTick() + 0.2);
+    EXPECT_NEAR(history.duration(0), 0.01, 1e-6);
+    EXPECT_EQ(history.center(history.size() - 1), armor->getCenter());
+    EXPECT_EQ(p_tracker->front(), armor);
+}
+
+// 由观测历史访问历史组合体
+TEST_F(PlanarTrackerTest, tracker_history_at)
+{
+    rm::Armor::ptr armor1 = buildArmor(cv::Point(500, 300), 8);
+    rm::Armor::ptr armor2 = buildArmor(cv::Point(520, 310), 8);
+    rm::tracker::ptr p_tracker = rm::PlanarTracker::make_tracker(armor1);
+    p_tracker->update(armor2);
+    ASSERT_EQ(p_tracker->size(), 2);
+    EXPECT_EQ(p_tracker->at(0), armor2);
+    auto oldest = p_tracker->at(1);
+    EXPECT_DOUBLE_EQ(oldest->getTick(), armor1->getTick());
+    EXPECT_EQ(oldest->getCenter(), armor1->getCenter());
+    EXPECT_EQ(p_tracker->back()->getCenter(), armor1->getCenter());
+    EXPECT_THROW(p_tracker->at(2), rm::Exception);
+    // 仅最新的组合体保留具体类型，重建的组合体不能向下转型
+    EXPECT_NE(rm::Armor::cast(p_tracker->at(0)), nullptr);
+    EXPECT_EQ(rm::Armor::cast(oldest), nullptr);
+}
+
 } // namespace rm_test
 
 #endif // HAVE_RMVL_PLANAR_TRACKER
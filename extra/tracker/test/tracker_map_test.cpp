@@ -0,0 +1,166 @@
+/**
+ * @file tracker_map_test.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 追踪器槽位与稠密映射表单元测试
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include "rmvl/rmvl_modules.hpp"
+
+#ifdef HAVE_RMVL_TRACKER
+
+#include <gtest/gtest.h>
+
+#include "rmvl/tracker/tracker.h"
+
+namespace rm_test
+{
+
+TEST(TrackerMapTest, slot_reuse)
+{
+    auto a = std::make_shared<rm::DefaultTracker>();
+    auto b = std::make_shared<rm::DefaultTracker>();
+    auto c = std::make_shared<rm::DefaultTracker>();
+    EXPECT_NE(a->slot(), b->slot());
+    EXPECT_NE(b->slot(), c->slot());
+    // 析构后下标被新的追踪器复用
+    std::size_t b_slot = b->slot();
+    b.reset();
+    auto d = std::make_shared<rm::DefaultTracker>();
+    EXPECT_EQ(d->slot(), b_slot);
+    // 拷贝得到的追踪器分配新的下标，赋值不改变下标
+    auto e = a->clone();
+    EXPECT_NE(e->slot(), a->slot());
+    rm::DefaultTracker f, g;
+    std::size_t f_slot = f.slot();
+    f = g;
+    EXPECT_EQ(f.slot(), f_slot);
+}
+
+TEST(TrackerMapTest, snapshot_shares_slot)
+{
+    auto a = std::make_shared<rm::DefaultTracker>();
+    std::size_t a_slot = a->slot();
+    auto snap = a->snapshot();
+    EXPECT_EQ(snap->slot(), a_slot);
+    // 拷贝得到的追踪器则分配新的下标
+    EXPECT_NE(a->clone()->slot(), a_slot);
+    // 原追踪器析构后，快照仍占用该下标
+    a.reset();
+    auto b = std::make_shared<rm::DefaultTracker>();
+    EXPECT_NE(b->slot(), a_slot);
+    snap.reset();
+    auto c = std::make_shared<rm::DefaultTracker>();
+    EXPECT_EQ(c->slot(), a_slot);
+}
+
+TEST(TrackerMapTest, map_like_access)
+{
+    rm::tracker::ptr a = std::make_shared<rm::DefaultTracker>();
+    rm::tracker::ptr b = std::make_shared<rm::DefaultTracker>();
+    rm::tracker::ptr c = std::make_shared<rm::DefaultTracker>();
+    rm::TrackerMap<rm::tracker::const_ptr, double> map;
+    map[c] = 3;
+    EXPECT_TRUE(map.emplace(a, 1.0).second);
+    EXPECT_FALSE(map.emplace(a, 5.0).second);
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.at(a), 1.0);
+    EXPECT_EQ(map.count(c), 1u);
+    EXPECT_TRUE(map.find(b) == map.end());
+    EXPECT_THROW(map.at(b), rm::Exception);
+    // 遍历仅访问已插入的元素
+    double sum{};
+    for (const auto &[p_tracker, val] : map)
+    {
+        EXPECT_EQ(map.at(p_tracker), val);
+        sum += val;
+    }
+    EXPECT_EQ(sum, 4.0);
+    // merge 仅移动本表中不存在的元素
+    rm::TrackerMap<rm::tracker::const_ptr, double> other;
+    other[a] = 7;
+    other[b] = 2;
+    map.merge(other);
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(map.at(b), 2.0);
+    EXPECT_EQ(other.size(), 1u);
+    EXPECT_EQ(other.at(a), 7.0);
+    EXPECT_EQ(map.erase(a), 1u);
+    EXPECT_EQ(map.erase(a), 0u);
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.begin() == map.end());
+    // 由 std::unordered_map 隐式转换
+    std::unordered_map<rm::tracker::ptr, double> tof{{a, 0.02}};
+    auto get = [](const rm::TrackerMap<rm::tracker::ptr, double> &m, rm::tracker::ptr p) { return m.at(p); };
+    EXPECT_EQ(get(tof, a), 0.02);
+}
+
+TEST(TrackerMapTest, compact_storage)
+{
+    // 先创建的追踪器占用较小的槽位下标，映射表中仅存放后创建的追踪器
+    std::vector<rm::tracker::ptr> others;
+    for (int i = 0; i < 8; ++i)
+        others.push_back(std::make_shared<rm::DefaultTracker>());
+    rm::tracker::ptr a = std::make_shared<rm::DefaultTracker>();
+    rm::tracker::ptr b = std::make_shared<rm::DefaultTracker>();
+    rm::TrackerMap<rm::tracker::ptr, double> map;
+    map[b] = 2;
+    map[a] = 1;
+    // 遍历顺序为插入顺序，且仅访问已插入的元素
+    std::vector<double> vals;
+    for (const auto &[p_tracker, val] : map)
+        vals.push_back(val);
+    EXPECT_EQ(vals, (std::vector<double>{2, 1}));
+    // 删除后可重新插入，其余元素不受影响
+    EXPECT_EQ(map.erase(b), 1u);
+    map[b] = 3;
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.at(a), 1.0);
+    EXPECT_EQ(map.at(b), 3.0);
+    map.clear();
+    map[a] = 4;
+    EXPECT_EQ(map.size(), 1u);
+    EXPECT_TRUE(map.find(b) == map.end());
+}
+
+TEST(TrackerMapTest, churn)
+{
+    std::vector<rm::tracker::ptr> trackers;
+    for (int i = 0; i < 16; ++i)
+        trackers.push_back(std::make_shared<rm::DefaultTracker>());
+    rm::TrackerMap<rm::tracker::ptr, int> map;
+    for (int i = 0; i < 8; ++i)
+        map[trackers[i]] = i;
+    std::size_t capacity = map.capacity();
+    // 反复删除、插入，元素数量与存储空间均保持不变
+    for (int round = 0; round < 1000; ++round)
+    {
+        int out = round % 8, in = 8 + round % 8;
+        auto &erased = round % 16 < 8 ? trackers[out] : trackers[in];
+        auto &inserted = round % 16 < 8 ? trackers[in] : trackers[out];
+        ASSERT_EQ(map.erase(erased), 1u);
+        map[inserted] = round;
+        ASSERT_EQ(map.size(), 8u);
+    }
+    EXPECT_EQ(map.capacity(), capacity);
+    // 被移动的元素仍能通过槽位索引访问
+    int visited{};
+    for (const auto &[p_tracker, val] : map)
+    {
+        EXPECT_EQ(map.at(p_tracker), val);
+        ++visited;
+    }
+    EXPECT_EQ(visited, 8);
+    // 最后一轮中前 8 个追踪器被替换为后 8 个
+    for (int i = 0; i < 16; ++i)
+        EXPECT_EQ(map.count(trackers[i]), i < 8 ? 0u : 1u);
+}
+
+} // namespace rm_test
+
+#endif // HAVE_RMVL_TRACKER
@@ -11,13 +11,17 @@
 
 #pragma once
 
-#include <deque>
 #include <complex>
+#include <deque>
+#include <memory>
+#include <vector>
 
 #ifdef HAVE_OPENCV
 #include <opencv2/core/mat.hpp>
 #endif // HAVE_OPENCV
 
+#include "rmvl/core/rmvldef.hpp"
+
 namespace rm
 {
 
@@ -46,21 +50,121 @@ enum class GxType
     LogPower, //!< 对数功率谱
 };
 
+/**
+ * @brief 快速傅里叶变换计划
+ * @brief
+ * - 创建时根据长度 `N` 选择算法，并预先计算旋转因子等数据，同一长度的信号反复变换时无需重复计算，也不进行堆内存分配
+ *   - `N` 为 2 的幂：原址迭代的基 2 算法，预先计算位逆序表与旋转因子
+ *   - `N` 的素因子均不超过 13：Stockham 自排序的混合基算法，无需位逆序重排
+ *   - 其余长度：Bluestein 算法，将变换转化为长度为 2 的幂的循环卷积
+ * - 实数信号可使用 `forwardReal`，偶数长度时仅需一次长度为 `N/2` 的复数变换
+ * @note 变换过程使用计划内部的工作区，同一计划不可在多个线程中同时使用
+ *
+ * @code{.cpp}
+ * rm::FFTPlan plan(1000);
+ * std::vector<std::complex<double>> X(plan.size());
+ * plan.forward(x.data(), X.data());
+ * @endcode
+ */
+class RMVL_EXPORTS FFTPlan
+{
+public:
+    /**
+     * @brief 创建快速傅里叶变换计划
+     *
+     * @param[in] n 信号长度 `N`，需大于 `0`
+     */
+    explicit FFTPlan(std::size_t n);
+
+    //! 信号长度
+    inline std::size_t size() const { return _n; }
+
+    /**
+     * @brief 离散傅里叶变换 \f$X_k=\sum_{t=0}^{N-1}x_te^{-j2\pi kt/N}\f$
+     *
+     * @param[in] xt 长度为 `N` 的时域复信号
+     * @param[out] Xf 长度为 `N` 的频域复信号，可与 `xt` 相同以进行原址变换
+     */
+    void forward(const std::complex<double> *xt, std::complex<double> *Xf);
+
+    /**
+     * @brief 离散傅里叶逆变换，结果已除以 `N`
+     *
+     * @param[in] Xf 长度为 `N` 的频域复信号
+     * @param[out] xt 长度为 `N` 的时域复信号，可与 `Xf` 相同以进行原址变换
+     */
+    void inverse(const std::complex<double> *Xf, std::complex<double> *xt);
+
+    /**
+     * @brief 实数信号的离散傅里叶变换
+     * @note 实数信号的频谱共轭对称 \f$X_{N-k}=X_k^*\f$，因此仅输出前 `N/2 + 1` 个频点
+     *
+     * @param[in] xt 长度为 `N` 的时域实信号
+     * @param[out] Xf 长度为 `N/2 + 1` 的频域复信号
+     */
+    void forwardReal(const double *xt, std::complex<double> *Xf);
+
+private:
+    //! 对长度为 `N` 的数据进行原址正变换
+    void transform(std::complex<double> *data);
+
+    //! 基 2 算法
+    void radix2(std::complex<double> *data) const;
+
+    //! Stockham 混合基算法
+    void stockham(std::complex<double> *data);
+
+    //! Bluestein 算法
+    void bluestein(std::complex<double> *data);
+
+    std::size_t _n;                              //!< 信号长度
+    std::vector<std::size_t> _rev;               //!< 基 2 算法的位逆序表
+    std::vector<std::size_t> _factors;           //!< 混合基算法各级的基
+    std::vector<std::complex<double>> _twiddles; //!< 旋转因子
+    std::vector<std::complex<double>> _work;     //!< 工作区
+    std::vector<std::complex<double>> _chirp;    //!< Bluestein 算法的线性调频序列 \f$e^{-j\pi t^2/N}\f$
+    std::vector<std::complex<double>> _kernel;   //!< Bluestein 算法的卷积核频谱
+    std::unique_ptr<FFTPlan> _sub;               //!< Bluestein 算法中计算卷积的计划
+    std::unique_ptr<FFTPlan> _half;              //!< 实数信号变换使用的长度为 `N/2` 的计划，首次使用时创建
+    std::vector<std::complex<double>> _real_tw;  //!< 实数信号变换的旋转因子 \f$e^{-j2\pi k/N}\f$
+    std::vector<std::complex<double>> _buf;      //!< 奇数长度实数信号变换的缓冲区
+};
+
 /**
  * @brief 计算离散傅里叶变换
- * 
+ * @note 支持任意长度，内部使用当前线程缓存的 FFTPlan，连续变换相同长度的信号时无需重新创建计划
+ *
  * @param[in] xt 时域复信号
  * @return 频域复信号
  */
-ComplexSignal dft(const ComplexSignal &xt);
+RMVL_EXPORTS ComplexSignal dft(const ComplexSignal &xt);
+
+/**
+ * @brief 计算离散傅里叶变换，结果写入预先分配的输出
+ *
+ * @param[in] xt 时域复信号的首地址
+ * @param[in] n 信号长度
+ * @param[out] Xf 频域复信号的首地址，长度为 `n`，可与 `xt` 相同
+ */
+RMVL_EXPORTS void dft(const std::complex<double> *xt, std::size_t n, std::complex<double> *Xf);
 
 /**
  * @brief 计算离散傅里叶逆变换
- * 
+ * @note 支持任意长度，内部使用当前线程缓存的 FFTPlan
+ *
  * @param[in] Xf 频域复信号
  * @return 时域复信号
  */
-ComplexSignal idft(const ComplexSignal &Xf);
+RMVL_EXPORTS ComplexSignal idft(const ComplexSignal &Xf);
+
+/**
+ * @brief 计算离散傅里叶逆变换，结果写入预先分配的输出
+ *
+ * @param[in] Xf 频域复信号的首地址
+ * @param[in] n 信号长度
+ * @param[out] xt 时域复信号的首地址，长度为 `n`，可与 `Xf` 相同
+ */
+RMVL_EXPORTS void idft(const std::complex<double> *Xf, std::size_t n, std::complex<double> *xt);
 
 /**
  * @brief 计算信号谱
@@ -71,6 +175,405 @@ ComplexSignal idft(const ComplexSignal &Xf);
  */
 RealSignal Gx(const ComplexSignal &x, GxType type);
 
+/**
+ * @brief 使用 Jacobsen 估计器，由幅值最大的频点及其相邻频点的 DFT 值估计真实频率相对于该频点的偏移量
+ * @note 适用于未加窗（矩形窗）的 DFT，偏移量的取值范围为 \f$[-0.5, 0.5]\f$
+ *
+ * @param[in] prev 第 `k - 1` 个频点的 DFT 值
+ * @param[in] peak 第 `k` 个频点（幅值最大）的 DFT 值
+ * @param[in] next 第 `k + 1` 个频点的 DFT 值
+ * @return 以频点间隔为单位的偏移量 \f$\delta\f$，真实频率为 \f$(k+\delta)/N\f$
+ */
+double jacobsen(std::complex<double> prev, std::complex<double> peak, std::complex<double> next);
+
+/**
+ * @brief 滑动离散傅里叶变换
+ * @brief
+ * - 维护最近 `N` 个采样点的 DFT 中连续若干个频点的值，每个新的采样点按照
+ *   \f[X_k\leftarrow\left(X_k+x_n-x_{n-N}\right)e^{j2\pi k/N}\f]
+ *   更新，单个采样点的代价为 \f$O(K)\f$（\f$K\f$ 为频点数），而 `dft` 每次需要重新计算完整的变换
+ * - 递推会累积舍入误差，每经过 `N` 个采样点由窗口内的采样点重新计算一次，均摊代价不变
+ * - 适用于在滑动窗口中估计能量机关转速、陀螺旋转等周期运动的主频率
+ */
+class RMVL_EXPORTS SlidingDFT
+{
+public:
+    /**
+     * @brief 创建滑动离散傅里叶变换对象
+     *
+     * @param[in] n 窗口长度 `N`
+     * @param[in] first 跟踪的第一个频点，取值范围为 `[0, N)`
+     * @param[in] last 跟踪的最后一个频点（包含），取值范围为 `[first, N)`
+     */
+    SlidingDFT(std::size_t n, std::size_t first, std::size_t last);
+
+    /**
+     * @brief 添加新的采样点，窗口已满时移除最早的采样点
+     *
+     * @param[in] x 新的采样点
+     */
+    void update(double x);
+
+    //! 窗口内的采样点数
+    inline std::size_t size() const { return _count; }
+
+    //! 窗口是否已满，未满时窗口内缺少的采样点视为 `0`
+    inline bool full() const { return _count == _buf.size(); }
+
+    //! 窗口长度
+    inline std::size_t length() const { return _buf.size(); }
+
+    /**
+     * @brief 获取频点的 DFT 值
+     *
+     * @param[in] k 频点，取值范围为 `[first, last]`
+     * @return 第 `k` 个频点的 DFT 值，相位以窗口内最早的采样点为参考
+     */
+    inline std::complex<double> bin(std::size_t k) const { return _bins[k - _first]; }
+
+    //! 跟踪的频点中幅值最大的频点
+    std::size_t peak() const;
+
+    /**
+     * @brief 估计主频率
+     * @note 使用 jacobsen 对幅值最大的频点进行插值，该频点位于跟踪范围的边界时不进行插值
+     *
+     * @param[in] fs 采样频率
+     * @return 主频率，单位与 `fs` 一致，`fs = 1` 时为每采样点的周期数
+     */
+    double frequency(double fs = 1) const;
+
+private:
+    //! 由窗口内的采样点重新计算各频点的 DFT 值
+    void resync();
+
+    std::size_t _first;                         //!< 跟踪的第一个频点
+    std::vector<double> _buf;                   //!< 采样点环形缓冲区
+    std::size_t _head{};                        //!< 最早的采样点在缓冲区中的下标
+    std::size_t _count{};                       //!< 窗口内的采样点数
+    std::size_t _updates{};                     //!< 上次重新计算以来的递推次数
+    std::vector<std::complex<double>> _roots;   //!< 单位根 \f$e^{j2\pi i/N},\ i=0,1,\cdots,N-1\f$
+    std::vector<std::complex<double>> _bins;    //!< 各频点的 DFT 值
+};
+
+/**
+ * @brief Goertzel 滤波器组
+ * @brief
+ * - 以 `N` 个采样点为一组，计算任意（不必为 \f$1/N\f$ 整数倍的）频率处的 DFT 值，每个采样点对每个频率仅需一次实数乘法
+ * - 与 SlidingDFT 不同，计算结果在每组采样点结束时更新，适用于只关心少量候选频率、且允许按块更新的场合
+ */
+class RMVL_EXPORTS GoertzelBank
+{
+public:
+    /**
+     * @brief 创建 Goertzel 滤波器组
+     *
+     * @param[in] freqs 各滤波器的频率，单位为每采样点的周期数，取值范围为 `[0, 0.5]`
+     * @param[in] n 每组的采样点数 `N`
+     */
+    GoertzelBank(const std::vector<double> &freqs, std::size_t n);
+
+    /**
+     * @brief 添加新的采样点
+     *
+     * @param[in] x 新的采样点
+     * @return 当前组是否结束，结束时各频率的 DFT 值被更新
+     */
+    bool update(double x);
+
+    //! 滤波器数量
+    inline std::size_t size() const { return _coeff.size(); }
+
+    /**
+     * @brief 获取最近一组采样点在指定频率处的 DFT 值
+     *
+     * @param[in] i 滤波器下标
+     * @return DFT 值，相位以该组的第一个采样点为参考
+     */
+    inline std::complex<double> value(std::size_t i) const { return _values[i]; }
+
+    /**
+     * @brief 获取最近一组采样点在指定频率处的功率
+     *
+     * @param[in] i 滤波器下标
+     * @return \f$|X|^2\f$
+     */
+    inline double power(std::size_t i) const { return std::norm(_values[i]); }
+
+    //! 最近一组采样点中功率最大的滤波器下标
+    std::size_t peak() const;
+
+private:
+    std::size_t _n;                             //!< 每组的采样点数
+    std::size_t _count{};                       //!< 当前组已添加的采样点数
+    std::vector<double> _coeff;                 //!< 各滤波器的递推系数 \f$2\cos\omega\f$
+    std::vector<std::complex<double>> _rotate;  //!< 输出时的旋转因子 \f$e^{-j\omega}\f$
+    std::vector<std::complex<double>> _correct; //!< 相位参考修正 \f$e^{-j\omega(N-1)}\f$
+    std::vector<double> _s1;                    //!< 递推状态 \f$s[n-1]\f$
+    std::vector<double> _s2;                    //!< 递推状态 \f$s[n-2]\f$
+    std::vector<std::complex<double>> _values;  //!< 最近一组采样点的 DFT 值
+};
+
+/**
+ * @brief 二阶节（biquad）IIR 滤波器系数，传递函数为
+ *        \f[H(z)=\frac{b_0+b_1z^{-1}+b_2z^{-2}}{1+a_1z^{-1}+a_2z^{-2}}\f]
+ * @note 频率参数均为归一化频率，单位为每采样点的周期数，取值范围为 `(0, 0.5)`，例如采样频率为 `fs`、截止频率为
+ *       `f` 时传入 `f / fs`
+ */
+struct RMVL_EXPORTS Biquad
+{
+    double b0{1}; //!< 分子系数 \f$b_0\f$
+    double b1{};  //!< 分子系数 \f$b_1\f$
+    double b2{};  //!< 分子系数 \f$b_2\f$
+    double a1{};  //!< 分母系数 \f$a_1\f$
+    double a2{};  //!< 分母系数 \f$a_2\f$
+
+    /**
+     * @brief 设计二阶低通滤波器（双线性变换，截止频率已预畸变）
+     *
+     * @param[in] fc 截止频率
+     * @param[in] q 品质因数，\f$1/\sqrt2\f$ 时为二阶 Butterworth 滤波器
+     * @return 低通滤波器系数
+     */
+    static Biquad lowpass(double fc, double q = 0.7071067811865476);
+
+    /**
+     * @brief 设计陷波滤波器，用于滤除固定频率的干扰，例如电机、云台振动
+     *
+     * @param[in] f0 陷波频率
+     * @param[in] q 品质因数，越大陷波带宽越窄，带宽约为 `f0 / q`
+     * @return 陷波滤波器系数
+     */
+    static Biquad notch(double f0, double q);
+
+    /**
+     * @brief 计算频率响应
+     *
+     * @param[in] f 归一化频率
+     * @return \f$H(e^{j2\pi f})\f$
+     */
+    std::complex<double> response(double f) const;
+};
+
+/**
+ * @brief 级联二阶节 IIR 滤波器
+ * @brief
+ * - 每个二阶节使用转置直接 II 型结构，状态仅为 2 个变量，单个采样点的代价为每节 5 次乘法，处理过程中不进行堆内存分配
+ * - 高阶滤波器拆分为二阶节级联，相比于直接型结构对系数的量化误差不敏感
+ *
+ * @code{.cpp}
+ * // 采样频率 1000 Hz，截止频率 30 Hz 的 4 阶 Butterworth 低通滤波器
+ * auto lpf = rm::BiquadCascade::butterworth(4, 30.0 / 1000);
+ * double y = lpf.update(x);
+ * @endcode
+ */
+class RMVL_EXPORTS BiquadCascade
+{
+public:
+    BiquadCascade() = default;
+
+    /**
+     * @brief 创建级联二阶节 IIR 滤波器
+     *
+     * @param[in] sections 各二阶节的系数，按照信号经过的顺序排列
+     */
+    explicit BiquadCascade(std::vector<Biquad> sections);
+
+    /**
+     * @brief 设计 Butterworth 低通滤波器
+     *
+     * @param[in] order 阶数，奇数阶时包含一个一阶节
+     * @param[in] fc 截止频率（-3 dB），归一化频率
+     * @return Butterworth 低通滤波器
+     */
+    static BiquadCascade butterworth(std::size_t order, double fc);
+
+    /**
+     * @brief 处理单个采样点
+     *
+     * @param[in] x 输入采样点
+     * @return 输出采样点
+     */
+    double update(double x);
+
+    /**
+     * @brief 处理一段连续的采样点，与依次调用 `update` 的结果一致
+     *
+     * @param[in] in 输入信号的首地址
+     * @param[out] out 输出信号的首地址，可与 `in` 相同
+     * @param[in] n 采样点数
+     */
+    void process(const double *in, double *out, std::size_t n);
+
+    /**
+     * @brief 将内部状态设置为输入恒为 `x` 时的稳态，用于避免首个采样点引起的阶跃响应
+     *
+     * @param[in] x 稳态输入，默认为 `0`
+     */
+    void reset(double x = 0);
+
+    /**
+     * @brief 计算频率响应
+     *
+     * @param[in] f 归一化频率
+     * @return \f$H(e^{j2\pi f})\f$
+     */
+    std::complex<double> response(double f) const;
+
+    //! 各二阶节的系数
+    inline const std::vector<Biquad> &sections() const { return _sections; }
+
+private:
+    std::vector<Biquad> _sections; //!< 各二阶节的系数
+    std::vector<double> _z1;       //!< 各二阶节的状态 \f$z_1\f$
+    std::vector<double> _z2;       //!< 各二阶节的状态 \f$z_2\f$
+};
+
+/**
+ * @brief 流式 FIR 滤波器
+ * @brief
+ * - 采样点写入长度为 `2N` 的双倍环形缓冲区（每个采样点同时写入两个位置），窗口内的采样点始终连续存放，卷积以 8 个累加器
+ *   展开，便于编译器生成 SIMD 指令；卷积在写入新的采样点之前完成，避免刚写入的数据被立即读取造成的存储转发停顿
+ * - 处理过程中不进行堆内存分配
+ * - 适用于滑动平均、窗函数低通以及 Savitzky-Golay 平滑与求导
+ */
+class RMVL_EXPORTS FIRFilter
+{
+public:
+    FIRFilter() = default;
+
+    /**
+     * @brief 创建 FIR 滤波器 \f$y_n=\sum_{i=0}^{N-1}h_ix_{n-i}\f$
+     *
+     * @param[in] taps 滤波器系数 \f$h_0,h_1,\cdots,h_{N-1}\f$，不能为空
+     */
+    explicit FIRFilter(std::vector<double> taps);
+
+    /**
+     * @brief 设计滑动平均滤波器
+     *
+     * @param[in] n 窗口长度
+     * @return 滑动平均滤波器
+     */
+    static FIRFilter movingAverage(std::size_t n);
+
+    /**
+     * @brief 使用 Hamming 窗设计线性相位低通滤波器
+     *
+     * @param[in] n 系数个数，群延迟为 `(n - 1) / 2` 个采样点
+     * @param[in] fc 截止频率（-6 dB），归一化频率
+     * @return 低通滤波器，直流增益为 `1`
+     */
+    static FIRFilter lowpass(std::size_t n, double fc);
+
+    /**
+     * @brief 设计 Savitzky-Golay 滤波器，以窗口内采样点的最小二乘多项式拟合值或其导数作为输出
+     *
+     * @param[in] window 窗口长度，需大于 `order`
+     * @param[in] order 拟合多项式的阶数
+     * @param[in] deriv 导数阶数，`0` 表示平滑，需不超过 `order`
+     * @param[in] dt 采样间隔，导数的单位为 `1 / dt^deriv`
+     * @param[in] lag 求值点相对于最新采样点的延迟（采样点数），默认为 `0`，即在最新的采样点处求值，输出无延迟；
+     *                为 `(window - 1) / 2` 时为经典的对称 Savitzky-Golay 滤波器，噪声最小
+     * @return Savitzky-Golay 滤波器
+     */
+    static FIRFilter savitzkyGolay(std::size_t window, std::size_t order, std::size_t deriv = 0, double dt = 1, std::size_t lag = 0);
+
+    /**
+     * @brief 处理单个采样点
+     *
+     * @param[in] x 输入采样点
+     * @return 输出采样点，窗口未满时缺少的采样点视为首个采样点
+     */
+    double update(double x);
+
+    /**
+     * @brief 处理一段连续的采样点，与依次调用 `update` 的结果一致
+     *
+     * @param[in] in 输入信号的首地址
+     * @param[out] out 输出信号的首地址，可与 `in` 相同
+     * @param[in] n 采样点数
+     */
+    void process(const double *in, double *out, std::size_t n);
+
+    //! 清空窗口内的采样点
+    inline void reset() { _count = 0; }
+
+    /**
+     * @brief 计算频率响应
+     *
+     * @param[in] f 归一化频率
+     * @return \f$H(e^{j2\pi f})\f$
+     */
+    std::complex<double> response(double f) const;
+
+    //! 滤波器系数
+    inline const std::vector<double> &taps() const { return _taps; }
+
+private:
+    std::vector<double> _taps;  //!< 滤波器系数
+    std::vector<double> _rtaps; //!< 逆序存放的滤波器系数，与窗口内按时间顺序排列的采样点对应
+    std::vector<double> _buf;   //!< 双倍环形缓冲区
+    std::size_t _head{};        //!< 下一个采样点在缓冲区前半部分中的下标
+    std::size_t _count{};       //!< 已处理的采样点数
+};
+
+/**
+ * @brief One Euro 滤波器
+ * @brief
+ * - 截止频率随信号变化率自适应调整的一阶低通滤波器：\f$f_c=f_{c,\min}+\beta|\dot x|\f$，信号静止时截止频率低、抑制抖动，
+ *   快速变化时截止频率高、减小滞后
+ * - 按照时间戳计算平滑系数，适用于采样间隔不均匀的信号，例如随帧率波动的目标角度、速度
+ */
+class RMVL_EXPORTS OneEuroFilter
+{
+public:
+    /**
+     * @brief 创建 One Euro 滤波器
+     *
+     * @param[in] min_cutoff 最小截止频率（单位：Hz）
+     * @param[in] beta 截止频率随变化率增大的系数
+     * @param[in] d_cutoff 变化率估计的截止频率（单位：Hz）
+     */
+    explicit OneEuroFilter(double min_cutoff = 1, double beta = 0, double d_cutoff = 1)
+        : _min_cutoff(min_cutoff), _beta(beta), _d_cutoff(d_cutoff) {}
+
+    /**
+     * @brief 处理单个采样点
+     *
+     * @param[in] x 输入采样点
+     * @param[in] t 采样时间点（单位：s），需严格递增
+     * @return 输出采样点
+     */
+    double update(double x, double t);
+
+    /**
+     * @brief 处理一段连续的采样点，与依次调用 `update` 的结果一致
+     *
+     * @param[in] in 输入信号的首地址
+     * @param[in] ts 各采样点的时间点的首地址
+     * @param[out] out 输出信号的首地址，可与 `in` 相同
+     * @param[in] n 采样点数
+     */
+    void process(const double *in, const double *ts, double *out, std::size_t n);
+
+    //! 清空滤波器状态，下一个采样点将直接作为输出
+    inline void reset() { _initialized = false; }
+
+    //! 最近一次估计的变化率（单位：1/s）
+    inline double derivative() const { return _dx; }
+
+private:
+    double _min_cutoff;  //!< 最小截止频率
+    double _beta;        //!< 截止频率随变化率增大的系数
+    double _d_cutoff;    //!< 变化率估计的截止频率
+    bool _initialized{}; //!< 是否已处理过采样点
+    double _x{};         //!< 上一次的输出
+    double _raw{};       //!< 上一次的输入
+    double _dx{};        //!< 上一次的变化率估计
+    double _t{};         //!< 上一次的采样时间点
+};
+
 #ifdef HAVE_OPENCV
 
 /**
@@ -13,10 +13,16 @@
 
 #ifdef HAVE_OPENCV
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <functional>
+#include <vector>
 
 #include <opencv2/core.hpp>
 
+#include "math.hpp"
+
 //! @addtogroup algorithm
 //! @{
 //! @defgroup algorithm_kalman 卡尔曼滤波模块
@@ -108,25 +114,103 @@ protected:
     cv::Matx<Tp, StateDim, MeasureDim> K;   //!< 卡尔曼增益 \f$K\f$
 };
 
+//! 卡尔曼滤波器结构标签：稠密的状态转移矩阵 \f$A\f$ 和观测矩阵 \f$H\f$，按照完整的矩阵乘法进行计算
+struct KFDense
+{
+};
+
+//! 卡尔曼滤波器结构标签：观测矩阵为选择矩阵 \f$H=\begin{bmatrix}I&0\end{bmatrix}\f$，即直接观测前 `MeasureDim` 个状态量
+struct KFSelectH
+{
+};
+
+/**
+ * @brief 卡尔曼滤波器结构标签：匀速运动模型
+ * @brief
+ * 状态量为 \f$[\pmb p^T,\pmb v^T]^T\f$（`StateDim == 2 * MeasureDim`），状态转移矩阵和观测矩阵分别为
+ * \f[A=\begin{bmatrix}I&tI\\0&I\end{bmatrix},\quad H=\begin{bmatrix}I&0\end{bmatrix}\f]
+ */
+struct KFConstVelocity
+{
+};
+
 /**
  * @brief 卡尔曼滤波器
+ * @note
+ * - 结构标签为 `KFDense` 时，预测与校正使用完整的矩阵乘法以及通用的矩阵求逆
+ * - 结构标签为 `KFSelectH` 或 `KFConstVelocity` 时，编译期仅展开非零项的乘加运算，观测矩阵固定，
+ *   `setH` 设置的矩阵不参与计算；`KFConstVelocity` 下 `setA` 仅读取帧差时间 \f$t=A_{0,m}\f$，也可使用 `setDt` 直接设置
+ * - 结构化的滤波器在观测量个数不超过 `3` 时使用闭式解求新息协方差的逆，否则使用 Cholesky 分解
+ * - 可通过 `enableSteadyState` 在线检测增益收敛，或通过 `solveSteadyState` 离线迭代 Riccati 方程（DARE），
+ *   进入稳态后使用固定增益，预测与校正仅更新状态量；`dt` 的变化超出相对容差或 \f$A\f$、\f$H\f$、\f$Q\f$、\f$R\f$、\f$P\f$
+ *   发生变化或重新初始化时自动退出稳态，恢复完整的协方差递推
  *
  * @tparam Tp 数据类型
  * @tparam StateDim 状态量个数
  * @tparam MeasureDim 观测量个数
+ * @tparam Structure 结构标签，可选 `KFDense`、`KFSelectH`、`KFConstVelocity`
  */
-template <typename Tp, unsigned StateDim, unsigned MeasureDim>
+template <typename Tp, unsigned StateDim, unsigned MeasureDim, typename Structure = KFDense>
 class KalmanFilter : public KalmanFilterStaticDatas<Tp, StateDim, MeasureDim>
 {
     static_assert(std::is_floating_point_v<Tp>, "\"Tp\" must be floating point value.");
     static_assert(StateDim > 0, "StateDim of \"rm::KalmanFilter\" must greater than 0.");
     static_assert(MeasureDim > 0, "MeasureDim of \"rm::KalmanFilter\" must greater than 0.");
+    static_assert(!std::is_same_v<Structure, KFSelectH> || MeasureDim <= StateDim,
+                  "MeasureDim of \"rm::KalmanFilter\" with \"KFSelectH\" must not greater than StateDim.");
+    static_assert(!std::is_same_v<Structure, KFConstVelocity> || StateDim == 2 * MeasureDim,
+                  "StateDim of \"rm::KalmanFilter\" with \"KFConstVelocity\" must be 2 * MeasureDim.");
 
 public:
     //! 构造新的 KalmanFilter 对象
     KalmanFilter() : KalmanFilterStaticDatas<Tp, StateDim, MeasureDim>(),
                      A(A.eye()), At(At.eye()), H(H.eye()), Ht(Ht.eye()) {}
 
+    /**
+     * @brief 初始化状态以及对应的误差协方差矩阵（常数对角矩阵），并退出稳态
+     *
+     * @param[in] x0 初始化的状态向量
+     * @param[in] error 状态误差系数
+     */
+    void init(const cv::Matx<Tp, StateDim, 1> &x0, Tp error) { Base::init(x0, error), resetSteady(); }
+
+    /**
+     * @brief 初始化状态以及对应的误差协方差矩阵（对角矩阵），并退出稳态
+     *
+     * @param[in] x0 初始化的状态向量
+     * @param[in] error 状态误差矩阵的对角线元素
+     */
+    void init(const cv::Matx<Tp, StateDim, 1> &x0, const cv::Matx<Tp, StateDim, 1> &error) { Base::init(x0, error), resetSteady(); }
+
+    /**
+     * @brief 设置测量噪声协方差矩阵 \f$R\f$，矩阵发生变化时退出稳态
+     *
+     * @param[in] measure_err 测量噪声协方差矩阵 \f$R\f$
+     */
+    inline void setR(const cv::Matx<Tp, MeasureDim, MeasureDim> &measure_err)
+    {
+        if (!same(measure_err, this->R))
+            Base::setR(measure_err), resetSteady();
+    }
+
+    /**
+     * @brief 设置过程噪声协方差矩阵 \f$Q\f$，矩阵发生变化时退出稳态
+     *
+     * @param[in] process_err 过程噪声协方差矩阵 \f$Q\f$
+     */
+    inline void setQ(const cv::Matx<Tp, StateDim, StateDim> &process_err)
+    {
+        if (!same(process_err, this->Q))
+            Base::setQ(process_err), resetSteady();
+    }
+
+    /**
+     * @brief 设置误差协方差矩阵 \f$P\f$，并退出稳态
+     *
+     * @param[in] state_err 误差协方差矩阵 \f$P\f$
+     */
+    inline void setP(const cv::Matx<Tp, StateDim, StateDim> &state_err) { Base::setP(state_err), resetSteady(); }
+
     /**
      * @brief 设置状态转移矩阵 \f$A\f$
      * @brief
@@ -147,7 +231,32 @@ public:
      *
      * @param[in] state_tf 状态转移矩阵
      */
-    inline void setA(const cv::Matx<Tp, StateDim, StateDim> &state_tf) { this->A = state_tf, this->At = state_tf.t(); }
+    inline void setA(const cv::Matx<Tp, StateDim, StateDim> &state_tf)
+    {
+        if constexpr (std::is_same_v<Structure, KFConstVelocity>)
+            setDt(state_tf(0, MeasureDim));
+        else if (!same(state_tf, A))
+            resetSteady();
+        this->A = state_tf, this->At = state_tf.t();
+    }
+
+    /**
+     * @brief 设置匀速运动模型的帧差时间 \f$t\f$，仅在结构标签为 `KFConstVelocity` 时可用
+     * @brief
+     * 状态量的先验估计始终使用最新的帧差时间；误差协方差的递推使用参考帧差时间 \f$t_r\f$。启用稳态检测或处于稳态时，
+     * 仅当 \f$|t-t_r|>\epsilon|t_r|\f$ 才更新 \f$t_r\f$ 并退出稳态，从而在帧差时间存在抖动时增益仍能收敛，
+     * 其中相对容差 \f$\epsilon\f$ 可由 `enableSteadyState` 设置；否则 \f$t_r\f$ 始终与 \f$t\f$ 相同
+     *
+     * @param[in] dt 帧差时间
+     */
+    inline void setDt(Tp dt)
+    {
+        static_assert(std::is_same_v<Structure, KFConstVelocity>, "\"setDt\" requires the \"KFConstVelocity\" structure.");
+        _dt = dt;
+        Tp tol = _steady_enabled || _steady ? _dt_tol : Tp(0);
+        if (std::abs(dt - _cov_dt) > tol * std::abs(_cov_dt))
+            _cov_dt = dt, resetSteady();
+    }
 
     /**
      * @brief 设置观测矩阵 \f$H\f$
@@ -158,7 +267,56 @@ public:
      * \begin{bmatrix}p\\v\\a\end{bmatrix}\f]
      * @param[in] observe_tf 观测矩阵
      */
-    inline void setH(const cv::Matx<Tp, MeasureDim, StateDim> &observe_tf) { this->H = observe_tf, this->Ht = observe_tf.t(); }
+    inline void setH(const cv::Matx<Tp, MeasureDim, StateDim> &observe_tf)
+    {
+        if (!same(observe_tf, H))
+            resetSteady();
+        this->H = observe_tf, this->Ht = observe_tf.t();
+    }
+
+    /**
+     * @brief 启用或关闭稳态（常增益）模式的在线检测
+     * @brief
+     * 启用后，每次校正时比较新旧卡尔曼增益，若逐元素的变化量连续 `frames` 帧均不超过 `tol`，则认为增益已收敛，
+     * 此后固定使用该增益，跳过误差协方差的预测与校正
+     *
+     * @param[in] enable 是否启用
+     * @param[in] tol 增益收敛阈值
+     * @param[in] frames 判定收敛所需的连续帧数
+     * @param[in] dt_tol 帧差时间的相对容差，仅在结构标签为 `KFConstVelocity` 时有效，参考 `setDt`
+     */
+    inline void enableSteadyState(bool enable = true, Tp tol = Tp(1e-6), unsigned frames = 3, Tp dt_tol = Tp(0.1))
+    {
+        _steady_enabled = enable, _steady_tol = tol, _steady_frames = frames, _dt_tol = dt_tol;
+        resetSteady();
+    }
+
+    /**
+     * @brief 离线求解稳态卡尔曼增益，即迭代 Riccati 方程直至收敛，得到离散代数 Riccati 方程（DARE）的解
+     * @brief
+     * 以当前的误差协方差 \f$P\f$ 为初值，交替执行协方差的预测与校正，收敛后误差协方差 \f$P\f$、\f$P^-\f$
+     * 以及增益 \f$K\f$ 均被置为稳态解，并立即切换至稳态模式；未收敛时恢复原有的误差协方差
+     *
+     * @param[in] max_iter 最大迭代次数
+     * @param[in] tol 增益收敛阈值
+     * @return 是否收敛
+     */
+    bool solveSteadyState(unsigned max_iter = 1000, Tp tol = Tp(1e-6))
+    {
+        auto P0 = this->P, P0_ = this->P_;
+        auto K0 = this->K;
+        for (unsigned i = 0; i < max_iter; ++i)
+        {
+            covPredict();
+            if (covCorrect() <= tol && i > 0)
+                return _steady = true;
+        }
+        this->P = P0, this->P_ = P0_, this->K = K0;
+        return false;
+    }
+
+    //! 当前是否处于稳态（常增益）模式
+    inline bool isSteady() const { return _steady; }
 
     /**
      * @brief 卡尔曼滤波的预测部分，包括状态量的先验估计和误差协方差的先验估计
@@ -169,9 +327,17 @@ public:
     inline auto predict()
     {
         // 先验状态估计
-        this->x_ = A * this->x;
-        // 先验误差协方差
-        this->P_ = A * this->P * At + this->Q;
+        if constexpr (std::is_same_v<Structure, KFConstVelocity>)
+        {
+            // p = p + tv
+            for (unsigned i = 0; i < MeasureDim; ++i)
+                this->x_(i) = this->x(i) + _dt * this->x(MeasureDim + i), this->x_(MeasureDim + i) = this->x(MeasureDim + i);
+        }
+        else
+            this->x_ = A * this->x;
+        // 先验误差协方差，稳态下保持不变
+        if (!_steady)
+            covPredict();
         return this->x_;
     }
 
@@ -179,6 +345,7 @@ public:
      * @brief 卡尔曼滤波器校正部分，包含卡尔曼增益的计算、状态量的后验估计和误差协方差的后验估计
      * @brief 公式如下 \f[\begin{align}K_k&=P_k^-H^T\left(HP_k^-H^T+R\right)^{-1}\\\hat{\pmb x}_k&=\hat{\pmb
      *         x}_k^-+K\left(\pmb z_k-H\hat{\pmb x}_k^-\right)\\P_k&=\left(I-K_kH\right)P_k^-\end{align}\f]
+     * @note 稳态下直接使用固定增益 \f$K\f$，仅计算后验状态估计
      *
      * @param[in] zk 观测量
      * @return 后验状态估计
@@ -186,16 +353,156 @@ public:
     inline auto correct(const cv::Matx<Tp, MeasureDim, 1> &zk)
     {
         this->z = zk;
-        // 计算卡尔曼增益
-        this->K = this->P_ * Ht * (H * this->P_ * Ht + this->R).inv();
+        if (!_steady)
+        {
+            Tp dk = covCorrect();
+            if (_steady_enabled)
+            {
+                _steady_count = dk <= _steady_tol ? _steady_count + 1 : 0;
+                _steady = _steady_count >= _steady_frames;
+            }
+        }
         // 后验状态估计
-        this->x = this->x_ + this->K * (this->z - this->H * this->x_);
-        // 后验误差协方差
-        this->P = (this->I - this->K * H) * this->P_;
+        if constexpr (std::is_same_v<Structure, KFDense>)
+            this->x = this->x_ + this->K * (this->z - this->H * this->x_);
+        else
+        {
+            cv::Matx<Tp, MeasureDim, 1> y;
+            for (unsigned j = 0; j < MeasureDim; ++j)
+                y(j) = this->z(j) - this->x_(j);
+            this->x = this->x_ + this->K * y;
+        }
         return this->x;
     }
 
 private:
+    using Base = KalmanFilterStaticDatas<Tp, StateDim, MeasureDim>;
+
+    //! 退出稳态，恢复完整的协方差递推
+    inline void resetSteady() { _steady = false, _steady_count = 0; }
+
+    //! 判断两个矩阵是否逐元素相等
+    template <int R, int C>
+    static inline bool same(const cv::Matx<Tp, R, C> &a, const cv::Matx<Tp, R, C> &b) { return std::equal(a.val, a.val + R * C, b.val); }
+
+    //! 误差协方差的先验估计 \f$P_k^-=AP_{k-1}A^T+Q\f$
+    inline void covPredict()
+    {
+        if constexpr (std::is_same_v<Structure, KFConstVelocity>)
+        {
+            constexpr unsigned M = MeasureDim;
+            const Tp t = _cov_dt;
+            auto &P = this->P;
+            auto &P_ = this->P_;
+            // 按 2 × 2 分块展开 A·P·At
+            for (unsigned i = 0; i < M; ++i)
+                for (unsigned j = 0; j < M; ++j)
+                {
+                    Tp pv = P(i, M + j) + t * P(M + i, M + j);
+                    P_(i, j) = P(i, j) + t * (P(M + i, j) + P(i, M + j)) + t * t * P(M + i, M + j);
+                    P_(i, M + j) = pv;
+                    P_(M + i, j) = P(M + i, j) + t * P(M + i, M + j);
+                    P_(M + i, M + j) = P(M + i, M + j);
+                }
+            P_ += this->Q;
+        }
+        else
+            this->P_ = A * this->P * At + this->Q;
+    }
+
+    /**
+     * @brief 计算卡尔曼增益 \f$K_k\f$ 以及误差协方差的后验估计 \f$P_k\f$
+     *
+     * @return 卡尔曼增益逐元素变化量的最大值
+     */
+    inline Tp covCorrect()
+    {
+        const auto K0 = this->K;
+        if constexpr (std::is_same_v<Structure, KFDense>)
+        {
+            // 计算卡尔曼增益
+            this->K = this->P_ * Ht * (H * this->P_ * Ht + this->R).inv();
+            // 后验误差协方差
+            this->P = (this->I - this->K * H) * this->P_;
+        }
+        else
+        {
+            constexpr unsigned N = StateDim, M = MeasureDim;
+            const auto &P_ = this->P_;
+            // H 为选择矩阵：HP_ 为 P_ 的前 M 行，P_Ht 为 P_ 的前 M 列，HP_Ht 为 P_ 的左上角
+            cv::Matx<Tp, M, M> S;
+            for (unsigned i = 0; i < M; ++i)
+                for (unsigned j = 0; j < M; ++j)
+                    S(i, j) = P_(i, j) + this->R(i, j);
+            cv::Matx<Tp, M, M> S_inv = invSymmetric(S);
+            // 计算卡尔曼增益 K = P_Ht·S⁻¹
+            for (unsigned i = 0; i < N; ++i)
+                for (unsigned j = 0; j < M; ++j)
+                {
+                    Tp k{};
+                    for (unsigned l = 0; l < M; ++l)
+                        k += P_(i, l) * S_inv(l, j);
+                    this->K(i, j) = k;
+                }
+            // 后验误差协方差 P = P_ - K·HP_
+            for (unsigned i = 0; i < N; ++i)
+                for (unsigned j = 0; j < N; ++j)
+                {
+                    Tp p = P_(i, j);
+                    for (unsigned l = 0; l < M; ++l)
+                        p -= this->K(i, l) * P_(l, j);
+                    this->P(i, j) = p;
+                }
+        }
+        Tp dk{};
+        for (unsigned i = 0; i < StateDim * MeasureDim; ++i)
+            dk = std::max(dk, std::abs(this->K.val[i] - K0.val[i]));
+        return dk;
+    }
+
+    /**
+     * @brief 求对称正定矩阵的逆，不超过 `3` 阶时使用闭式解，否则使用 Cholesky 分解
+     *
+     * @param[in] S 对称正定矩阵
+     * @return 逆矩阵
+     */
+    static inline cv::Matx<Tp, MeasureDim, MeasureDim> invSymmetric(const cv::Matx<Tp, MeasureDim, MeasureDim> &S)
+    {
+        if constexpr (MeasureDim == 1)
+            return {1 / S(0, 0)};
+        else if constexpr (MeasureDim == 2)
+        {
+            Tp inv_det = 1 / (S(0, 0) * S(1, 1) - S(0, 1) * S(1, 0));
+            return {S(1, 1) * inv_det, -S(0, 1) * inv_det,
+                    -S(1, 0) * inv_det, S(0, 0) * inv_det};
+        }
+        else if constexpr (MeasureDim == 3)
+        {
+            Tp c00 = S(1, 1) * S(2, 2) - S(1, 2) * S(2, 1);
+            Tp c01 = S(1, 2) * S(2, 0) - S(1, 0) * S(2, 2);
+            Tp c02 = S(1, 0) * S(2, 1) - S(1, 1) * S(2, 0);
+            Tp inv_det = 1 / (S(0, 0) * c00 + S(0, 1) * c01 + S(0, 2) * c02);
+            Tp c11 = S(0, 0) * S(2, 2) - S(0, 2) * S(2, 0);
+            Tp c12 = S(0, 1) * S(2, 0) - S(0, 0) * S(2, 1);
+            Tp c22 = S(0, 0) * S(1, 1) - S(0, 1) * S(1, 0);
+            return {c00 * inv_det, c01 * inv_det, c02 * inv_det,
+                    c01 * inv_det, c11 * inv_det, c12 * inv_det,
+                    c02 * inv_det, c12 * inv_det, c22 * inv_det};
+        }
+        else
+            return S.inv(cv::DECOMP_CHOLESKY);
+    }
+
+    Tp _dt{};            //!< 匀速运动模型的帧差时间 \f$t\f$
+    Tp _cov_dt{};        //!< 误差协方差递推使用的参考帧差时间 \f$t_r\f$
+    Tp _dt_tol{Tp(0.1)}; //!< 帧差时间的相对容差
+
+    bool _steady_enabled{};    //!< 是否启用稳态模式的在线检测
+    bool _steady{};            //!< 是否处于稳态（常增益）模式
+    Tp _steady_tol{};          //!< 增益收敛阈值
+    unsigned _steady_frames{}; //!< 判定收敛所需的连续帧数
+    unsigned _steady_count{};  //!< 增益变化量不超过阈值的连续帧数
+
     cv::Matx<Tp, StateDim, StateDim> A;    //!< 状态转移矩阵 \f$A\f$
     cv::Matx<Tp, StateDim, StateDim> At;   //!< 状态转移矩阵的转置 \f$A^T\f$
     cv::Matx<Tp, MeasureDim, StateDim> H;  //!< 观测矩阵 \f$H\f$
@@ -217,6 +524,379 @@ using KF64d = KalmanFilter<double, 6U, 4U>; //!< 6 × 4 卡尔曼滤波器
 using KF73f = KalmanFilter<float, 7U, 3U>;  //!< 7 × 3 卡尔曼滤波器
 using KF73d = KalmanFilter<double, 7U, 3U>; //!< 7 × 3 卡尔曼滤波器
 
+using KF21fCV = KalmanFilter<float, 2U, 1U, KFConstVelocity>;  //!< 2 × 1 匀速运动模型卡尔曼滤波器
+using KF21dCV = KalmanFilter<double, 2U, 1U, KFConstVelocity>; //!< 2 × 1 匀速运动模型卡尔曼滤波器
+using KF42fCV = KalmanFilter<float, 4U, 2U, KFConstVelocity>;  //!< 4 × 2 匀速运动模型卡尔曼滤波器
+using KF42dCV = KalmanFilter<double, 4U, 2U, KFConstVelocity>; //!< 4 × 2 匀速运动模型卡尔曼滤波器
+using KF63fCV = KalmanFilter<float, 6U, 3U, KFConstVelocity>;  //!< 6 × 3 匀速运动模型卡尔曼滤波器
+using KF63dCV = KalmanFilter<double, 6U, 3U, KFConstVelocity>; //!< 6 × 3 匀速运动模型卡尔曼滤波器
+
+/**
+ * @brief 卡尔曼滤波器组
+ * @brief
+ * - 以结构体数组（SoA）的方式存储 \f$K\f$ 个相同维度的卡尔曼滤波器，每 `LANES` 个滤波器组成一个数据块，块内同一矩阵元素在内存中连续存放，
+ *   `predict()` 和 `correct()` 的最内层循环为定长的块内循环，便于编译器将同一块中的多个滤波器映射至 SIMD 通道中并行计算。
+ * @brief
+ * - 每个滤波器拥有独立的 \f$A\f$、\f$H\f$、\f$Q\f$、\f$R\f$，追踪器等对象可通过 `add()` 注册至共享的滤波器组并获得稳定的下标，
+ *   通过 `remove()` 注销后，该下标会被后续注册的滤波器复用。
+ * @brief
+ * - 校正部分使用 Cholesky 分解求解新息协方差，而非显式求逆。
+ * @brief
+ * - 仅通过 `setZ()` 设置了观测量的已注册滤波器参与校正，其余滤波器仅执行预测，即后验估计取为先验估计；
+ *   全部滤波器均未注册或均无观测的数据块会被整体跳过。
+ *
+ * @tparam Tp 数据类型
+ * @tparam StateDim 状态量个数
+ * @tparam MeasureDim 观测量个数
+ */
+template <typename Tp, unsigned StateDim, unsigned MeasureDim>
+class KalmanFilterBank
+{
+    static_assert(std::is_floating_point_v<Tp>, "\"Tp\" must be floating point value.");
+    static_assert(StateDim > 0, "StateDim of \"rm::KalmanFilterBank\" must greater than 0.");
+    static_assert(MeasureDim > 0, "MeasureDim of \"rm::KalmanFilterBank\" must greater than 0.");
+
+public:
+    static constexpr std::size_t LANES = 8; //!< 每个数据块包含的滤波器个数
+
+private:
+    static constexpr unsigned N = StateDim;
+    static constexpr unsigned M = MeasureDim;
+    using Block = std::array<Tp, LANES>;
+
+    //! 按数据块存储的矩阵组，`block(b)[i * Cols + j]` 为第 `b` 块中所有滤波器第 `i` 行第 `j` 列的元素
+    template <unsigned Rows, unsigned Cols>
+    class Lanes
+    {
+        std::vector<Block> _data;
+
+    public:
+        inline Block *block(std::size_t b) { return _data.data() + b * Rows * Cols; }
+        inline const Block *block(std::size_t b) const { return _data.data() + b * Rows * Cols; }
+
+        //! 修改数据块个数，保留已有数据
+        inline void resize(std::size_t blocks) { _data.resize(blocks * Rows * Cols); }
+
+        inline void set(std::size_t k, const cv::Matx<Tp, Rows, Cols> &m)
+        {
+            Block *p = block(k / LANES);
+            for (unsigned e = 0; e < Rows * Cols; ++e)
+                p[e][k % LANES] = m.val[e];
+        }
+
+        inline cv::Matx<Tp, Rows, Cols> get(std::size_t k) const
+        {
+            cv::Matx<Tp, Rows, Cols> m;
+            const Block *p = block(k / LANES);
+            for (unsigned e = 0; e < Rows * Cols; ++e)
+                m.val[e] = p[e][k % LANES];
+            return m;
+        }
+    };
+
+public:
+    /**
+     * @brief 构造新的卡尔曼滤波器组
+     *
+     * @param[in] capacity 预分配的滤波器个数
+     */
+    explicit KalmanFilterBank(std::size_t capacity = LANES) { reserve(capacity); }
+
+    /**
+     * @brief 注册新的滤波器，初始时 \f$A\f$、\f$H\f$、\f$Q\f$、\f$R\f$、\f$P\f$ 均为单位矩阵，状态为零向量
+     *
+     * @return 滤波器下标，在注销前保持不变
+     */
+    std::size_t add()
+    {
+        std::size_t k{};
+        if (!_free.empty())
+        {
+            k = _free.back();
+            _free.pop_back();
+            reset(k);
+        }
+        else
+        {
+            if (_size == _capacity)
+                reserve(_capacity * 2);
+            k = _size++;
+        }
+        _active[k] = true;
+        return k;
+    }
+
+    /**
+     * @brief 注销滤波器，注销后该下标可被后续注册的滤波器复用
+     *
+     * @param[in] k 滤波器下标
+     */
+    void remove(std::size_t k)
+    {
+        if (k < _size && _active[k])
+            _active[k] = false, measured(k) = Tp(0), _free.push_back(k);
+    }
+
+    //! 已注册的滤波器个数
+    inline std::size_t size() const { return _size - _free.size(); }
+    //! 滤波器下标是否有效
+    inline bool active(std::size_t k) const { return k < _size && _active[k]; }
+
+    /**
+     * @brief 初始化状态以及对应的误差协方差矩阵（常数对角矩阵）
+     *
+     * @param[in] k 滤波器下标
+     * @param[in] x0 初始化的状态向量
+     * @param[in] error 状态误差系数
+     */
+    void init(std::size_t k, const cv::Matx<Tp, StateDim, 1> &x0, Tp error)
+    {
+        _x.set(k, x0), _x_.set(k, x0);
+        cv::Matx<Tp, StateDim, StateDim> P0 = cv::Matx<Tp, StateDim, StateDim>::eye() * error;
+        _P.set(k, P0), _P_.set(k, P0);
+    }
+
+    //! 设置第 `k` 个滤波器的状态转移矩阵 \f$A\f$
+    inline void setA(std::size_t k, const cv::Matx<Tp, StateDim, StateDim> &state_tf) { _A.set(k, state_tf); }
+    //! 设置第 `k` 个滤波器的观测矩阵 \f$H\f$
+    inline void setH(std::size_t k, const cv::Matx<Tp, MeasureDim, StateDim> &observe_tf) { _H.set(k, observe_tf); }
+    //! 设置第 `k` 个滤波器的过程噪声协方差矩阵 \f$Q\f$
+    inline void setQ(std::size_t k, const cv::Matx<Tp, StateDim, StateDim> &process_err) { _Q.set(k, process_err); }
+    //! 设置第 `k` 个滤波器的测量噪声协方差矩阵 \f$R\f$
+    inline void setR(std::size_t k, const cv::Matx<Tp, MeasureDim, MeasureDim> &measure_err) { _R.set(k, measure_err); }
+    //! 设置第 `k` 个滤波器的误差协方差矩阵 \f$P\f$
+    inline void setP(std::size_t k, const cv::Matx<Tp, StateDim, StateDim> &state_err) { _P.set(k, state_err), _P_.set(k, state_err); }
+    //! 设置第 `k` 个滤波器下一次校正使用的观测量 \f$\pmb z\f$，未设置观测量的滤波器在下一次校正时仅执行预测
+    inline void setZ(std::size_t k, const cv::Matx<Tp, MeasureDim, 1> &zk) { _z.set(k, zk), measured(k) = Tp(1); }
+    //! 第 `k` 个滤波器是否已设置下一次校正使用的观测量
+    inline bool hasZ(std::size_t k) const { return active(k) && _measured[k / LANES][k % LANES] != Tp(0); }
+
+    //! 获取第 `k` 个滤波器的后验状态估计
+    inline cv::Matx<Tp, StateDim, 1> state(std::size_t k) const { return _x.get(k); }
+    //! 获取第 `k` 个滤波器的先验状态估计
+    inline cv::Matx<Tp, StateDim, 1> priorState(std::size_t k) const { return _x_.get(k); }
+    //! 获取第 `k` 个滤波器的后验误差协方差矩阵
+    inline cv::Matx<Tp, StateDim, StateDim> covariance(std::size_t k) const { return _P.get(k); }
+
+    /**
+     * @brief 对所有已注册的滤波器执行预测部分
+     * @brief 公式如下 \f[\begin{align}\hat{\pmb x}_k^-&=A\hat{\pmb x}_{k-1}\\P_k^-&=AP_{k-1}A^T+Q\end{align}\f]
+     */
+    void predict()
+    {
+        for (std::size_t b = 0; b < blocks(); ++b)
+        {
+            if (!anyActive(b))
+                continue;
+            const Block *A = _A.block(b), *P = _P.block(b), *Q = _Q.block(b), *x = _x.block(b);
+            Block *x_ = _x_.block(b), *P_ = _P_.block(b);
+            // 先验状态估计
+            for (unsigned i = 0; i < N; ++i)
+            {
+                Block s{};
+                for (unsigned j = 0; j < N; ++j)
+                    for (std::size_t k = 0; k < LANES; ++k)
+                        s[k] += A[i * N + j][k] * x[j][k];
+                x_[i] = s;
+            }
+            // 先验误差协方差 AP·At + Q
+            Block AP[N * N];
+            for (unsigned i = 0; i < N; ++i)
+                for (unsigned j = 0; j < N; ++j)
+                {
+                    Block s{};
+                    for (unsigned l = 0; l < N; ++l)
+                        for (std::size_t k = 0; k < LANES; ++k)
+                            s[k] += A[i * N + l][k] * P[l * N + j][k];
+                    AP[i * N + j] = s;
+                }
+            for (unsigned i = 0; i < N; ++i)
+                for (unsigned j = 0; j < N; ++j)
+                {
+                    Block s = Q[i * N + j];
+                    for (unsigned l = 0; l < N; ++l)
+                        for (std::size_t k = 0; k < LANES; ++k)
+                            s[k] += AP[i * N + l][k] * A[j * N + l][k];
+                    P_[i * N + j] = s;
+                }
+        }
+    }
+
+    /**
+     * @brief 使用 `setZ()` 设置的观测量对已注册的滤波器执行校正部分，并清除所有观测量的设置状态
+     * @brief 公式如下 \f[\begin{align}K_k&=P_k^-H^T\left(HP_k^-H^T+R\right)^{-1}\\\hat{\pmb x}_k&=\hat{\pmb
+     *         x}_k^-+K\left(\pmb z_k-H\hat{\pmb x}_k^-\right)\\P_k&=\left(I-K_kH\right)P_k^-\end{align}\f]
+     * @note 本次未设置观测量的滤波器仅执行预测，即 \f$\hat{\pmb x}_k=\hat{\pmb x}_k^-,\ P_k=P_k^-\f$
+     */
+    void correct()
+    {
+        for (std::size_t b = 0; b < blocks(); ++b)
+        {
+            Block &w = _measured[b];
+            if (std::all_of(w.begin(), w.end(), [](Tp v) { return v == Tp(0); }))
+            {
+                // 整块无观测，仅执行预测
+                if (anyActive(b))
+                    std::copy_n(_x_.block(b), N, _x.block(b)), std::copy_n(_P_.block(b), N * N, _P.block(b));
+                continue;
+            }
+            const Block *H = _H.block(b), *R = _R.block(b), *z = _z.block(b), *x_ = _x_.block(b), *P_ = _P_.block(b);
+            Block *x = _x.block(b), *P = _P.block(b);
+            // 新息 y = z - Hx_，以及 HP_
+            Block y[M], HP[M * N];
+            for (unsigned m = 0; m < M; ++m)
+            {
+                Block s = z[m];
+                for (unsigned j = 0; j < N; ++j)
+                    for (std::size_t k = 0; k < LANES; ++k)
+                        s[k] -= H[m * N + j][k] * x_[j][k];
+                y[m] = s;
+                for (unsigned j = 0; j < N; ++j)
+                {
+                    Block t{};
+                    for (unsigned l = 0; l < N; ++l)
+                        for (std::size_t k = 0; k < LANES; ++k)
+                            t[k] += H[m * N + l][k] * P_[l * N + j][k];
+                    HP[m * N + j] = t;
+                }
+            }
+            // 新息协方差 S = HP_·Ht + R 的 Cholesky 分解 S = LLt（仅计算下三角）
+            Block L[M * M];
+            for (unsigned r = 0; r < M; ++r)
+                for (unsigned c = 0; c <= r; ++c)
+                {
+                    Block s = R[r * M + c];
+                    for (unsigned j = 0; j < N; ++j)
+                        for (std::size_t k = 0; k < LANES; ++k)
+                            s[k] += HP[r * N + j][k] * H[c * N + j][k];
+                    for (unsigned q = 0; q < c; ++q)
+                        for (std::size_t k = 0; k < LANES; ++k)
+                            s[k] -= L[r * M + q][k] * L[c * M + q][k];
+                    if (r == c)
+                        for (std::size_t k = 0; k < LANES; ++k)
+                            s[k] = std::sqrt(s[k]);
+                    else
+                        for (std::size_t k = 0; k < LANES; ++k)
+                            s[k] /= L[c * M + c][k];
+                    L[r * M + c] = s;
+                }
+            // 求解 LLt·G = HP_，则卡尔曼增益 K = Gt
+            Block G[M * N];
+            for (unsigned j = 0; j < N; ++j)
+            {
+                for (unsigned r = 0; r < M; ++r)
+                {
+                    Block s = HP[r * N + j];
+                    for (unsigned q = 0; q < r; ++q)
+                        for (std::size_t k = 0; k < LANES; ++k)
+                            s[k] -= L[r * M + q][k] * G[q * N + j][k];
+                    for (std::size_t k = 0; k < LANES; ++k)
+                        s[k] /= L[r * M + r][k];
+                    G[r * N + j] = s;
+                }
+                for (unsigned r = M; r-- > 0;)
+                {
+                    Block s = G[r * N + j];
+                    for (unsigned q = r + 1; q < M; ++q)
+                        for (std::size_t k = 0; k < LANES; ++k)
+                            s[k] -= L[q * M + r][k] * G[q * N + j][k];
+                    for (std::size_t k = 0; k < LANES; ++k)
+                        s[k] /= L[r * M + r][k];
+                    G[r * N + j] = s;
+                }
+            }
+            // 无观测的滤波器增益置零，退化为仅预测，同时避免其新息协方差的分解结果污染后验估计
+            for (unsigned e = 0; e < M * N; ++e)
+                for (std::size_t k = 0; k < LANES; ++k)
+                    G[e][k] = w[k] != Tp(0) ? G[e][k] : Tp(0);
+            // 后验状态估计 x = x_ + Ky，后验误差协方差 P = P_ - K·HP_
+            for (unsigned i = 0; i < N; ++i)
+            {
+                Block s = x_[i];
+                for (unsigned m = 0; m < M; ++m)
+                    for (std::size_t k = 0; k < LANES; ++k)
+                        s[k] += G[m * N + i][k] * y[m][k];
+                x[i] = s;
+                for (unsigned j = 0; j < N; ++j)
+                {
+                    Block t = P_[i * N + j];
+                    for (unsigned m = 0; m < M; ++m)
+                        for (std::size_t k = 0; k < LANES; ++k)
+                            t[k] -= G[m * N + i][k] * HP[m * N + j][k];
+                    P[i * N + j] = t;
+                }
+            }
+            w.fill(Tp(0));
+        }
+    }
+
+private:
+    //! 已使用的数据块个数
+    inline std::size_t blocks() const { return (_size + LANES - 1) / LANES; }
+
+    //! 第 `b` 个数据块中是否存在已注册的滤波器
+    inline bool anyActive(std::size_t b) const
+    {
+        for (std::size_t k = b * LANES; k < std::min(_size, (b + 1) * LANES); ++k)
+            if (_active[k])
+                return true;
+        return false;
+    }
+
+    //! 第 `k` 个滤波器的观测标志
+    inline Tp &measured(std::size_t k) { return _measured[k / LANES][k % LANES]; }
+
+    //! 预分配数据块，新增的滤波器均被重置
+    void reserve(std::size_t capacity)
+    {
+        std::size_t old_capacity = _capacity;
+        std::size_t blocks = std::max<std::size_t>((capacity + LANES - 1) / LANES, 1);
+        _capacity = blocks * LANES;
+        _active.resize(_capacity);
+        _measured.resize(blocks);
+        _x.resize(blocks), _x_.resize(blocks), _z.resize(blocks);
+        _A.resize(blocks), _H.resize(blocks), _Q.resize(blocks), _R.resize(blocks);
+        _P.resize(blocks), _P_.resize(blocks);
+        for (std::size_t k = old_capacity; k < _capacity; ++k)
+            reset(k);
+    }
+
+    //! 重置第 `k` 个滤波器
+    void reset(std::size_t k)
+    {
+        _x.set(k, {}), _x_.set(k, {}), _z.set(k, {});
+        _A.set(k, cv::Matx<Tp, StateDim, StateDim>::eye());
+        _H.set(k, cv::Matx<Tp, MeasureDim, StateDim>::eye());
+        _Q.set(k, cv::Matx<Tp, StateDim, StateDim>::eye());
+        _R.set(k, cv::Matx<Tp, MeasureDim, MeasureDim>::eye());
+        _P.set(k, cv::Matx<Tp, StateDim, StateDim>::eye());
+        _P_.set(k, cv::Matx<Tp, StateDim, StateDim>::eye());
+    }
+
+    std::size_t _size{};            //!< 已使用的滤波器个数
+    std::size_t _capacity{};        //!< 已分配的滤波器个数
+    std::vector<bool> _active;      //!< 滤波器是否已注册
+    std::vector<Block> _measured;   //!< 滤波器是否已设置观测量，按数据块存储，`1` 表示已设置、`0` 表示未设置
+    std::vector<std::size_t> _free; //!< 已注销、可复用的滤波器下标
+
+    Lanes<StateDim, 1> _x;            //!< 状态的后验估计
+    Lanes<StateDim, 1> _x_;           //!< 状态的先验估计
+    Lanes<MeasureDim, 1> _z;          //!< 观测向量
+    Lanes<StateDim, StateDim> _A;     //!< 状态转移矩阵
+    Lanes<MeasureDim, StateDim> _H;   //!< 观测矩阵
+    Lanes<StateDim, StateDim> _Q;     //!< 过程噪声协方差矩阵
+    Lanes<MeasureDim, MeasureDim> _R; //!< 测量噪声协方差矩阵
+    Lanes<StateDim, StateDim> _P;     //!< 后验误差协方差矩阵
+    Lanes<StateDim, StateDim> _P_;    //!< 先验误差协方差矩阵
+};
+
+using KFBank21f = KalmanFilterBank<float, 2U, 1U>;  //!< 2 × 1 卡尔曼滤波器组
+using KFBank21d = KalmanFilterBank<double, 2U, 1U>; //!< 2 × 1 卡尔曼滤波器组
+using KFBank42f = KalmanFilterBank<float, 4U, 2U>;  //!< 4 × 2 卡尔曼滤波器组
+using KFBank42d = KalmanFilterBank<double, 4U, 2U>; //!< 4 × 2 卡尔曼滤波器组
+using KFBank63f = KalmanFilterBank<float, 6U, 3U>;  //!< 6 × 3 卡尔曼滤波器组
+using KFBank63d = KalmanFilterBank<double, 6U, 3U>; //!< 6 × 3 卡尔曼滤波器组
+
 /**
  * @brief 扩展卡尔曼滤波器
  *
@@ -356,6 +1036,148 @@ using EKF84d = ExtendedKalmanFilter<double, 8U, 4U>; //!< 8 × 4 扩展卡尔曼
 using EKF94f = ExtendedKalmanFilter<float, 9U, 4U>;  //!< 9 × 4 扩展卡尔曼滤波器
 using EKF94d = ExtendedKalmanFilter<double, 9U, 4U>; //!< 9 × 4 扩展卡尔曼滤波器
 
+/**
+ * @brief 使用前向模式自动微分计算雅可比矩阵的扩展卡尔曼滤波器
+ * @brief
+ * - 状态方程与观测方程以模板参数的形式传入，不经过 `std::function` 的类型擦除，调用形式分别为
+ *   `cv::Matx<Dual<Tp, StateDim>, StateDim, 1>(const cv::Matx<Dual<Tp, StateDim>, StateDim, 1> &)` 以及
+ *   `cv::Matx<Dual<Tp, StateDim>, MeasureDim, 1>(const cv::Matx<Dual<Tp, StateDim>, StateDim, 1> &)`
+ * @brief
+ * - 预测与校正时，以对偶数作为自变量对方程进行一次计算，即可同时得到方程的值以及雅可比矩阵 \f$J_A\f$、\f$J_H\f$，
+ *   因此无需调用 `setJa`、`setJh`
+ * @note 方程中的数学函数请使用不带 `std::` 前缀的形式调用，例如 `cos(x(2))`，参考 rm::Dual
+ *
+ * @tparam Tp 数据类型
+ * @tparam StateDim 状态量个数
+ * @tparam MeasureDim 观测量个数
+ * @tparam StateFunc 状态方程类型
+ * @tparam ObserveFunc 观测方程类型
+ */
+template <typename Tp, unsigned StateDim, unsigned MeasureDim, typename StateFunc, typename ObserveFunc>
+class AutoDiffEKF : public KalmanFilterStaticDatas<Tp, StateDim, MeasureDim>
+{
+    static_assert(std::is_floating_point_v<Tp>, "\"Tp\" must be floating point value.");
+
+public:
+    using dual_type = Dual<Tp, StateDim>; //!< 自动微分使用的对偶数类型
+
+    /**
+     * @brief 构造新的 AutoDiffEKF 对象
+     *
+     * @param[in] state_func 非线性的离散状态方程 \f$\pmb f_A(\pmb x)\f$
+     * @param[in] observe_func 非线性的离散观测方程 \f$\pmb f_H(\pmb x)\f$
+     */
+    AutoDiffEKF(StateFunc state_func, ObserveFunc observe_func)
+        : KalmanFilterStaticDatas<Tp, StateDim, MeasureDim>(), W(W.eye()), Wt(Wt.eye()), V(V.eye()), Vt(Vt.eye()),
+          Fa(std::move(state_func)), Fh(std::move(observe_func)) {}
+
+    /**
+     * @brief 设置过程噪声协方差雅可比矩阵 \f$W\f$
+     *
+     * @param[in] process_jac 过程噪声协方差雅可比矩阵
+     */
+    inline void setW(const cv::Matx<Tp, StateDim, StateDim> &process_jac) { W = process_jac, Wt = process_jac.t(); }
+
+    /**
+     * @brief 设置测量噪声协方差雅可比矩阵 \f$V\f$
+     *
+     * @param[in] measure_jac 测量噪声协方差雅可比矩阵
+     */
+    inline void setV(const cv::Matx<Tp, MeasureDim, MeasureDim> &measure_jac) { V = measure_jac, Vt = measure_jac.t(); }
+
+    //! 获取最近一次预测使用的状态方程雅可比矩阵 \f$J_A\f$
+    inline const cv::Matx<Tp, StateDim, StateDim> &getJa() const { return Ja; }
+    //! 获取最近一次校正使用的观测方程雅可比矩阵 \f$J_H\f$
+    inline const cv::Matx<Tp, MeasureDim, StateDim> &getJh() const { return Jh; }
+
+    /**
+     * @brief 扩展卡尔曼滤波的预测部分，在计算状态方程的同时得到雅可比矩阵 \f$J_A\f$
+     * @brief 公式如下 \f[\begin{align}\hat{\pmb x_k}^-&=\pmb f(\hat{\pmb x}_{k-1})\\
+     *        P_k^-&=J_AP_{k-1}J_A^T+WQW^T\end{align}\f]
+     *
+     * @return 先验状态估计
+     */
+    inline auto predict()
+    {
+        cv::Matx<dual_type, StateDim, 1> fx = Fa(seed(this->x));
+        for (unsigned i = 0; i < StateDim; ++i)
+        {
+            this->x_(i) = fx(i).val;
+            for (unsigned j = 0; j < StateDim; ++j)
+                Ja(i, j) = fx(i).der[j];
+        }
+        this->P_ = Ja * this->P * Ja.t() + W * this->Q * Wt;
+        return this->x_;
+    }
+
+    /**
+     * @brief 扩展卡尔曼滤波的校正部分，在计算观测方程的同时得到雅可比矩阵 \f$J_H\f$
+     * @brief 公式如下 \f[\begin{align}K_k&=P_k^-J_H^T\left(J_HP_k^-J_H^T+VRV^T\right)^{-1}\\\hat{\pmb x}
+     *        &=\hat{\pmb x}_k^-+K_k\left[\pmb z_k-\pmb f_H(\hat{\pmb x}_k^-)\right]\\P_k&=\left(I-K_kJ_H
+     *        \right)P_k^-\end{align}\f]
+     *
+     * @param[in] zk 观测量
+     * @return 后验状态估计
+     */
+    inline auto correct(const cv::Matx<Tp, MeasureDim, 1> &zk)
+    {
+        this->z = zk;
+        cv::Matx<dual_type, MeasureDim, 1> hx = Fh(seed(this->x_));
+        cv::Matx<Tp, MeasureDim, 1> h;
+        for (unsigned i = 0; i < MeasureDim; ++i)
+        {
+            h(i) = hx(i).val;
+            for (unsigned j = 0; j < StateDim; ++j)
+                Jh(i, j) = hx(i).der[j];
+        }
+        auto Jht = Jh.t();
+        // 计算卡尔曼增益
+        this->K = this->P_ * Jht * (Jh * this->P_ * Jht + V * this->R * Vt).inv();
+        // 后验状态估计
+        this->x = this->x_ + this->K * (this->z - h);
+        // 后验误差协方差
+        this->P = (this->I - this->K * Jh) * this->P_;
+        return this->x;
+    }
+
+private:
+    //! 将状态向量转换为对偶数形式的自变量
+    static inline cv::Matx<dual_type, StateDim, 1> seed(const cv::Matx<Tp, StateDim, 1> &x)
+    {
+        cv::Matx<dual_type, StateDim, 1> xd;
+        for (unsigned i = 0; i < StateDim; ++i)
+            xd(i) = dual_type(x(i), i);
+        return xd;
+    }
+
+    cv::Matx<Tp, StateDim, StateDim> Ja;     //!< 状态方程雅可比矩阵 \f$J_A\f$
+    cv::Matx<Tp, MeasureDim, StateDim> Jh;   //!< 观测方程雅可比矩阵 \f$J_H\f$
+    cv::Matx<Tp, StateDim, StateDim> W;      //!< 过程噪声协方差雅可比矩阵 \f$W\f$
+    cv::Matx<Tp, StateDim, StateDim> Wt;     //!< 过程噪声协方差雅可比矩阵的转置 \f$W^T\f$
+    cv::Matx<Tp, MeasureDim, MeasureDim> V;  //!< 测量噪声协方差雅可比矩阵 \f$V\f$
+    cv::Matx<Tp, MeasureDim, MeasureDim> Vt; //!< 测量噪声协方差雅可比矩阵的转置 \f$V^T\f$
+
+    StateFunc Fa;   //!< 非线性的离散状态方程
+    ObserveFunc Fh; //!< 非线性的离散观测方程
+};
+
+/**
+ * @brief 构建使用自动微分的扩展卡尔曼滤波器
+ *
+ * @tparam Tp 数据类型
+ * @tparam StateDim 状态量个数
+ * @tparam MeasureDim 观测量个数
+ * @param[in] state_func 非线性的离散状态方程，参考 rm::AutoDiffEKF
+ * @param[in] observe_func 非线性的离散观测方程，参考 rm::AutoDiffEKF
+ * @return AutoDiffEKF 对象
+ */
+template <typename Tp, unsigned StateDim, unsigned MeasureDim, typename StateFunc, typename ObserveFunc>
+inline auto make_autodiff_ekf(StateFunc &&state_func, ObserveFunc &&observe_func)
+{
+    return AutoDiffEKF<Tp, StateDim, MeasureDim, std::decay_t<StateFunc>, std::decay_t<ObserveFunc>>(
+        std::forward<StateFunc>(state_func), std::forward<ObserveFunc>(observe_func));
+}
+
 //! @} algorithm_kalman
 
 } // namespace rm
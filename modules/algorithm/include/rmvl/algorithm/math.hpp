@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <array>
 #include <cmath>
 #include <numeric>
 #include <unordered_map>
@@ -552,6 +553,149 @@ inline std::vector<T> &operator/=(std::vector<T> &vec, T val)
     return vec;
 }
 
+// ------------------------【自动微分】------------------------
+
+/**
+ * @brief 前向模式自动微分使用的对偶数，同时携带函数值及其对 `N` 个自变量的偏导数
+ * @brief
+ * - 使用对偶数作为自变量执行一次函数计算，即可同时得到函数值与完整的梯度（雅可比矩阵的一行），无需有限差分
+ * @brief
+ * - 数学函数以友元函数的形式提供，在泛型代码中请使用不带 `std::` 前缀的 `sin(x)`、`sqrt(x)` 等形式调用，
+ *   并在需要时 `using std::sin;`，以便通过实参依赖查找同时支持对偶数与普通浮点数
+ *
+ * @tparam Tp 数据类型
+ * @tparam N 自变量个数
+ */
+template <typename Tp, unsigned N>
+struct Dual
+{
+    static_assert(std::is_floating_point_v<Tp>, "\"Tp\" must be floating point value.");
+
+    Tp val{};                //!< 函数值
+    std::array<Tp, N> der{}; //!< 对各个自变量的偏导数
+
+    //! 构造值为 `0` 的常量
+    constexpr Dual() = default;
+
+    /**
+     * @brief 构造常量（偏导数均为 `0`）
+     *
+     * @param[in] v 函数值
+     */
+    constexpr Dual(Tp v) : val(v) {}
+
+    /**
+     * @brief 构造第 `i` 个自变量（对自身的偏导数为 `1`）
+     *
+     * @param[in] v 自变量的值
+     * @param[in] i 自变量的下标
+     */
+    constexpr Dual(Tp v, unsigned i) : val(v) { der[i] = 1; }
+
+    constexpr Dual &operator+=(const Dual &b)
+    {
+        val += b.val;
+        for (unsigned i = 0; i < N; ++i)
+            der[i] += b.der[i];
+        return *this;
+    }
+    constexpr Dual &operator-=(const Dual &b)
+    {
+        val -= b.val;
+        for (unsigned i = 0; i < N; ++i)
+            der[i] -= b.der[i];
+        return *this;
+    }
+    constexpr Dual &operator*=(const Dual &b)
+    {
+        for (unsigned i = 0; i < N; ++i)
+            der[i] = der[i] * b.val + val * b.der[i];
+        val *= b.val;
+        return *this;
+    }
+    constexpr Dual &operator/=(const Dual &b)
+    {
+        Tp inv = 1 / b.val, q = val * inv;
+        for (unsigned i = 0; i < N; ++i)
+            der[i] = (der[i] - q * b.der[i]) * inv;
+        val = q;
+        return *this;
+    }
+    constexpr Dual &operator+=(Tp b) { return val += b, *this; }
+    constexpr Dual &operator-=(Tp b) { return val -= b, *this; }
+    constexpr Dual &operator*=(Tp b)
+    {
+        val *= b;
+        for (auto &d : der)
+            d *= b;
+        return *this;
+    }
+    constexpr Dual &operator/=(Tp b) { return *this *= (1 / b); }
+
+    friend constexpr Dual operator+(const Dual &a) { return a; }
+    friend constexpr Dual operator-(Dual a) { return a *= Tp(-1); }
+    friend constexpr Dual operator+(Dual a, const Dual &b) { return a += b; }
+    friend constexpr Dual operator-(Dual a, const Dual &b) { return a -= b; }
+    friend constexpr Dual operator*(Dual a, const Dual &b) { return a *= b; }
+    friend constexpr Dual operator/(Dual a, const Dual &b) { return a /= b; }
+    friend constexpr Dual operator+(Dual a, Tp b) { return a += b; }
+    friend constexpr Dual operator-(Dual a, Tp b) { return a -= b; }
+    friend constexpr Dual operator*(Dual a, Tp b) { return a *= b; }
+    friend constexpr Dual operator/(Dual a, Tp b) { return a /= b; }
+    friend constexpr Dual operator+(Tp a, Dual b) { return b += a; }
+    friend constexpr Dual operator-(Tp a, const Dual &b) { return -b + a; }
+    friend constexpr Dual operator*(Tp a, Dual b) { return b *= a; }
+    friend constexpr Dual operator/(Tp a, const Dual &b) { return Dual(a) /= b; }
+
+    friend constexpr bool operator<(const Dual &a, const Dual &b) { return a.val < b.val; }
+    friend constexpr bool operator>(const Dual &a, const Dual &b) { return a.val > b.val; }
+    friend constexpr bool operator<=(const Dual &a, const Dual &b) { return a.val <= b.val; }
+    friend constexpr bool operator>=(const Dual &a, const Dual &b) { return a.val >= b.val; }
+    friend constexpr bool operator==(const Dual &a, const Dual &b) { return a.val == b.val; }
+    friend constexpr bool operator!=(const Dual &a, const Dual &b) { return a.val != b.val; }
+
+    //! 链式法则：返回值为 `f`、导数为 `df` 的复合函数
+    friend constexpr Dual chain(const Dual &a, Tp f, Tp df)
+    {
+        Dual r(f);
+        for (unsigned i = 0; i < N; ++i)
+            r.der[i] = df * a.der[i];
+        return r;
+    }
+
+    friend Dual sin(const Dual &a) { return chain(a, std::sin(a.val), std::cos(a.val)); }
+    friend Dual cos(const Dual &a) { return chain(a, std::cos(a.val), -std::sin(a.val)); }
+    friend Dual tan(const Dual &a)
+    {
+        Tp t = std::tan(a.val);
+        return chain(a, t, 1 + t * t);
+    }
+    friend Dual asin(const Dual &a) { return chain(a, std::asin(a.val), 1 / std::sqrt(1 - a.val * a.val)); }
+    friend Dual acos(const Dual &a) { return chain(a, std::acos(a.val), -1 / std::sqrt(1 - a.val * a.val)); }
+    friend Dual atan(const Dual &a) { return chain(a, std::atan(a.val), 1 / (1 + a.val * a.val)); }
+    friend Dual exp(const Dual &a)
+    {
+        Tp ex = std::exp(a.val);
+        return chain(a, ex, ex);
+    }
+    friend Dual log(const Dual &a) { return chain(a, std::log(a.val), 1 / a.val); }
+    friend Dual sqrt(const Dual &a)
+    {
+        Tp s = std::sqrt(a.val);
+        return chain(a, s, Tp(0.5) / s);
+    }
+    friend Dual pow(const Dual &a, Tp p) { return chain(a, std::pow(a.val, p), p * std::pow(a.val, p - 1)); }
+    friend Dual abs(const Dual &a) { return a.val < 0 ? -a : a; }
+    friend Dual atan2(const Dual &y, const Dual &x)
+    {
+        Tp r2 = x.val * x.val + y.val * y.val;
+        Dual r(std::atan2(y.val, x.val));
+        for (unsigned i = 0; i < N; ++i)
+            r.der[i] = (x.val * y.der[i] - y.val * x.der[i]) / r2;
+        return r;
+    }
+};
+
 // ------------------------【数学模型算法】------------------------
 
 //! 熵权 TOPSIS 算法
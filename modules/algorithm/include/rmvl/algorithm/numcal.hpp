@@ -11,9 +11,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <bitset>
+#include <cmath>
 #include <cstdint>
+#include <deque>
 #include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #if __cplusplus >= 202302L
@@ -21,6 +28,7 @@
 #endif
 
 #include "rmvl/core/rmvldef.hpp"
+#include "rmvl/core/util.hpp"
 
 //! @addtogroup algorithm
 //! @{
@@ -61,6 +69,24 @@ public:
      */
     RMVL_W double operator()(double x) const noexcept;
 
+    /**
+     * @brief 批量计算多项式在多个点的函数值
+     *
+     * @param[in] xs 指定点的 x 坐标列表
+     * @return 多项式在各点的函数值
+     */
+    RMVL_W std::vector<double> eval(const std::vector<double> &xs) const;
+
+    /**
+     * @brief 批量计算多项式在多个点的函数值
+     * @note 使用分组 Horner 法，每组内的多个点同时迭代且相互独立，便于编译器将其向量化为 SIMD 指令
+     *
+     * @param[in] xs 指定点的 x 坐标数组
+     * @param[out] ys 多项式在各点的函数值，需预先分配 `n` 个元素
+     * @param[in] n 点的个数
+     */
+    void eval(const double *xs, double *ys, std::size_t n) const noexcept;
+
     std::vector<double> _coeffs; //!< 多项式系数
 };
 
@@ -70,6 +96,8 @@ public:
  * @brief 函数插值器
  * @brief
  * - 由于插值多项式具有唯一性，为了提高新增节点时算法的简易性，这里使用 Newton 插值多项式
+ * @brief
+ * - 新增、删除节点均只需 \f$O(n)\f$ 的时间，配合使用 `add` 与 `pop` 即可实现滑动窗口插值
  */
 class RMVL_EXPORTS_W Interpolator
 {
@@ -97,6 +125,22 @@ public:
      */
     RMVL_W Interpolator &add(double x, double y);
 
+    /**
+     * @brief 删除最早添加的插值节点
+     * @note 删除 \f$x_0\f$ 后，差商表中以 \f$x_1\f$ 起始的各阶差商保持不变，仅需丢弃差商表的首行与各行末尾的最高阶差商
+     *
+     * @code{.cpp}
+     * // 维持最近 5 个节点的滑动窗口
+     * interf.add(x, y);
+     * if (interf.size() > 5)
+     *     interf.pop();
+     * @endcode
+     */
+    RMVL_W Interpolator &pop();
+
+    //! 插值节点个数
+    RMVL_W inline std::size_t size() const { return _xs.size(); }
+
     /**
      * @brief 计算插值多项式在指定点的函数值
      *
@@ -143,6 +187,68 @@ private:
     std::vector<double> _coeffs;   //!< 多项式拟合曲线的系数
 };
 
+/**
+ * @brief 滑动窗口曲线拟合器
+ * @brief
+ * - 与 CurveFitter 使用相同的最小二乘模型，维护窗口内样本的 QR 分解的上三角因子 \f$R\f$ 与 \f$Q^T\pmb y\f$，新增样本时使用
+ *   Givens 旋转更新，删除最早的样本时使用 LINPACK `dchdd` 算法降秩更新，二者的代价均为 \f$O(m^2)\f$（\f$m\f$ 为拟合项数），
+ *   与窗口长度无关
+ * @brief
+ * - 降秩更新会累积舍入误差，每删除窗口长度个样本后由窗口内的样本重新分解一次，均摊代价不变
+ */
+class RMVL_EXPORTS_W SlidingCurveFitter
+{
+public:
+    /**
+     * @brief 创建滑动窗口曲线拟合器对象
+     *
+     * @param[in] window 窗口长度，即参与拟合的最大样本数
+     * @param[in] order 拟合曲线的阶数，含义与 CurveFitter 相同
+     */
+    RMVL_W SlidingCurveFitter(std::size_t window, std::bitset<8> order);
+
+    /**
+     * @brief 添加新的样本，样本数超出窗口长度时删除最早的样本
+     *
+     * @param[in] x 新样本的 x 坐标
+     * @param[in] y 新样本的 y 坐标
+     */
+    RMVL_W SlidingCurveFitter &add(double x, double y);
+
+    //! 删除最早的样本
+    RMVL_W SlidingCurveFitter &pop();
+
+    //! 窗口内的样本数
+    RMVL_W inline std::size_t size() const { return _xs.size(); }
+
+    /**
+     * @brief 计算拟合的多项式曲线在指定点的函数值
+     * @note 窗口内的样本数需不少于拟合项数
+     *
+     * @param[in] x 指定点的 x 坐标
+     * @return 拟合的多项式曲线在指定点的函数值
+     */
+    RMVL_W double operator()(double x) const;
+
+private:
+    //! 计算样本的基函数值 \f$[x^{i_0},x^{i_1},\cdots]\f$
+    void basis(double x, double *phi) const noexcept;
+
+    //! 由窗口内的样本重新分解
+    void refactor();
+
+    std::size_t _window;                 //!< 窗口长度
+    std::vector<std::size_t> _idx;       //!< 多项式拟合曲线的阶数（从低到高）
+    std::deque<double> _xs;              //!< 窗口内样本的 x 坐标
+    std::deque<double> _ys;              //!< 窗口内样本的 y 坐标
+    std::vector<double> _r;              //!< 上三角因子 \f$R\f$，按行存储
+    std::vector<double> _z;              //!< \f$Q^T\pmb y\f$
+    std::vector<double> _buf;            //!< 更新过程中的临时缓冲区
+    std::size_t _downdates{};            //!< 上次重新分解以来的降秩更新次数
+    mutable std::vector<double> _coeffs; //!< 多项式拟合曲线的系数
+    mutable bool _dirty{true};           //!< 系数是否需要重新求解
+};
+
 ///////////////// 非线性方程数值解 /////////////////
 
 /**
@@ -292,6 +398,311 @@ public:
     RMVL_W RungeKutta4(const Odes &fs);
 };
 
+/**
+ * @brief 经典 2 阶 2 级 Runge-Kutta 法（中点公式）的 Butcher 表，与 RungeKutta2 相同
+ * @note 各 Butcher 表的记号与 RungeKutta 一致：\f$\pmb p\f$ 为节点，\f$\pmb\lambda\f$ 为权重，\f$R\f$ 为系数矩阵，
+ *       嵌入式 Butcher 表额外包含误差估计的权重 \f$\pmb e=\pmb\lambda-\hat{\pmb\lambda}\f$
+ */
+struct ButcherRK2
+{
+    static constexpr std::size_t stages = 2;                    //!< 级数
+    static constexpr bool embedded = false;                     //!< 是否为嵌入式 Butcher 表
+    static constexpr bool fsal = false;                         //!< 最后一级是否为下一步的第一级（First Same As Last）
+    static constexpr double p[2] = {0.0, 0.5};                  //!< 节点 \f$\pmb p\f$
+    static constexpr double lambda[2] = {0.0, 1.0};             //!< 权重 \f$\pmb\lambda\f$
+    static constexpr double r[2][2] = {{0.0, 0.0}, {0.5, 0.0}}; //!< 系数矩阵 \f$R\f$
+};
+
+//! 经典 4 阶 4 级 Runge-Kutta 法的 Butcher 表，与 RungeKutta4 相同
+struct ButcherRK4
+{
+    static constexpr std::size_t stages = 4;                                          //!< 级数
+    static constexpr bool embedded = false;                                           //!< 是否为嵌入式 Butcher 表
+    static constexpr bool fsal = false;                                               //!< 最后一级是否为下一步的第一级（First Same As Last）
+    static constexpr double p[4] = {0.0, 0.5, 0.5, 1.0};                              //!< 节点 \f$\pmb p\f$
+    static constexpr double lambda[4] = {1.0 / 6.0, 1.0 / 3.0, 1.0 / 3.0, 1.0 / 6.0}; //!< 权重 \f$\pmb\lambda\f$
+    //! 系数矩阵 \f$R\f$
+    static constexpr double r[4][4] = {{0.0, 0.0, 0.0, 0.0},
+                                       {0.5, 0.0, 0.0, 0.0},
+                                       {0.0, 0.5, 0.0, 0.0},
+                                       {0.0, 0.0, 1.0, 0.0}};
+};
+
+//! Bogacki-Shampine 3(2) 阶嵌入式 Runge-Kutta 法的 Butcher 表 \cite Bogacki89
+struct ButcherBS32
+{
+    static constexpr std::size_t stages = 4;                                    //!< 级数
+    static constexpr bool embedded = true;                                      //!< 是否为嵌入式 Butcher 表
+    static constexpr bool fsal = true;                                          //!< 最后一级是否为下一步的第一级（First Same As Last）
+    static constexpr int order = 3;                                             //!< 阶数
+    static constexpr double p[4] = {0.0, 0.5, 0.75, 1.0};                       //!< 节点 \f$\pmb p\f$
+    static constexpr double lambda[4] = {2.0 / 9.0, 1.0 / 3.0, 4.0 / 9.0, 0.0}; //!< 权重 \f$\pmb\lambda\f$
+    //! 系数矩阵 \f$R\f$
+    static constexpr double r[4][4] = {{0.0, 0.0, 0.0, 0.0},
+                                       {0.5, 0.0, 0.0, 0.0},
+                                       {0.0, 0.75, 0.0, 0.0},
+                                       {2.0 / 9.0, 1.0 / 3.0, 4.0 / 9.0, 0.0}};
+    //! 误差估计的权重 \f$\pmb e\f$
+    static constexpr double e[4] = {2.0 / 9.0 - 7.0 / 24.0, 1.0 / 3.0 - 0.25, 4.0 / 9.0 - 1.0 / 3.0, -0.125};
+};
+
+//! Dormand-Prince 5(4) 阶嵌入式 Runge-Kutta 法的 Butcher 表 \cite Dormand80
+struct ButcherDP54
+{
+    static constexpr std::size_t stages = 7; //!< 级数
+    static constexpr bool embedded = true;   //!< 是否为嵌入式 Butcher 表
+    static constexpr bool fsal = true;       //!< 最后一级是否为下一步的第一级（First Same As Last）
+    static constexpr int order = 5;          //!< 阶数
+    //! 节点 \f$\pmb p\f$
+    static constexpr double p[7] = {0.0, 0.2, 0.3, 0.8, 8.0 / 9.0, 1.0, 1.0};
+    //! 权重 \f$\pmb\lambda\f$
+    static constexpr double lambda[7] = {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0};
+    //! 系数矩阵 \f$R\f$
+    static constexpr double r[7][7] = {
+        {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+        {0.2, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+        {3.0 / 40.0, 9.0 / 40.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+        {44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0, 0.0, 0.0, 0.0, 0.0},
+        {19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0, 0.0, 0.0, 0.0},
+        {9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0, 0.0, 0.0},
+        {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0}};
+    //! 误差估计的权重 \f$\pmb e\f$
+    static constexpr double e[7] = {35.0 / 384.0 - 5179.0 / 57600.0, 0.0, 500.0 / 1113.0 - 7571.0 / 16695.0,
+                                    125.0 / 192.0 - 393.0 / 640.0, -2187.0 / 6784.0 + 92097.0 / 339200.0,
+                                    11.0 / 84.0 - 187.0 / 2100.0, -1.0 / 40.0};
+};
+
+/**
+ * @brief 固定维度的显式 Runge-Kutta 常微分方程组数值求解器
+ * @brief
+ * - 状态量使用 `std::array<double, N>` 存储，方程组使用任意可调用对象，求解过程不进行动态内存分配
+ * @brief
+ * - 使用嵌入式 Butcher 表（如 `ButcherDP54`、`ButcherBS32`）时按照局部误差估计自适应调整步长，否则使用固定步长
+ * @brief
+ * - 每一步结束后可通过三次 Hermite 插值获取该步内任意时刻的稠密输出，`until` 据此精确定位事件发生的时刻
+ *
+ * @tparam Tableau Butcher 表类型
+ * @tparam N 方程组的维度
+ * @tparam Fs 方程组的函数对象类型，签名为 `std::array<double, N>(double t, const std::array<double, N> &x)`
+ */
+template <typename Tableau, std::size_t N, typename Fs>
+class OdeIntegrator
+{
+public:
+    using state_type = std::array<double, N>; //!< 状态量类型
+
+    /**
+     * @brief 创建固定维度的常微分方程组数值求解器对象，设置初值请参考 @ref init 方法
+     *
+     * @param[in] fs 常微分方程组 \f$\pmb x'=\pmb F(t,\pmb x)\f$ 的函数对象 \f$\pmb F(t,\pmb x)\f$
+     */
+    explicit OdeIntegrator(Fs fs) : _fs(std::move(fs)) {}
+
+    /**
+     * @brief 设置常微分方程组的初值
+     *
+     * @param[in] t0 初始位置的自变量 \f$t_0\f$
+     * @param[in] x0 初始位置的因变量 \f$\pmb x(t_0)\f$
+     * @param[in] h 步长，自适应步长时作为初始步长，需大于 `0`
+     */
+    void init(double t0, const state_type &x0, double h)
+    {
+        if (!(h > 0))
+            RMVL_Error_(RMVL_StsBadArg, "The step size (%g) must be greater than 0.", h);
+        _t_prev = _t = t0, _x_prev = _x = x0, _h = h;
+        _f_prev = _f = _fs(_t, _x);
+        _accepted = _rejected = 0;
+    }
+
+    /**
+     * @brief 设置自适应步长的容许误差，仅在使用嵌入式 Butcher 表时有效
+     *
+     * @param[in] rtol 相对容许误差
+     * @param[in] atol 绝对容许误差
+     */
+    inline void setTolerance(double rtol, double atol) { _rtol = rtol, _atol = atol; }
+
+    /**
+     * @brief 前进一步，自适应步长时会重复尝试直至局部误差满足容许误差
+     *
+     * @param[in] t_max 自变量的上限，本步不会越过该值，需不小于当前位置的自变量
+     */
+    void step(double t_max = std::numeric_limits<double>::infinity())
+    {
+        if (!(_h > 0))
+            RMVL_Error(RMVL_StsBadArg, "The step size must be greater than 0, call \"init\" first.");
+        if (t_max < _t)
+            RMVL_Error_(RMVL_StsBadArg, "The upper limit (%g) is less than the current position (%g).", t_max, _t);
+        _t_prev = _t, _x_prev = _x, _f_prev = _f;
+        while (true)
+        {
+            double h = std::min(_h, t_max - _t);
+            state_type x_new{}, err{}, f_new{};
+            trial(h, x_new, err, f_new);
+            if constexpr (Tableau::embedded)
+            {
+                double norm{};
+                for (std::size_t i = 0; i < N; ++i)
+                {
+                    double sc = _atol + _rtol * std::max(std::abs(_x[i]), std::abs(x_new[i]));
+                    norm += (err[i] / sc) * (err[i] / sc);
+                }
+                norm = std::sqrt(norm / N);
+                // 步长调整因子，限制在 [0.2, 5] 之间
+                double factor = norm == 0 ? 5.0 : std::clamp(0.9 * std::pow(norm, -1.0 / Tableau::order), 0.2, 5.0);
+                if (norm > 1)
+                {
+                    _h = h * factor, ++_rejected;
+                    // 步长过小时自变量不再前进，无法满足容许误差
+                    if (_t + _h == _t)
+                        RMVL_Error_(RMVL_StsError, "Step size underflow at t = %g, the tolerance cannot be satisfied.", _t);
+                    continue;
+                }
+                // 被 t_max 截断的步不放大后续步长
+                _h = h < _h ? _h : h * factor;
+            }
+            _t = (h == t_max - _t) ? t_max : _t + h;
+            _x = x_new;
+            _f = Tableau::fsal ? f_new : _fs(_t, _x);
+            ++_accepted;
+            return;
+        }
+    }
+
+    /**
+     * @brief 求解至指定的自变量
+     *
+     * @param[in] t_end 终止位置的自变量
+     * @return 终止位置的因变量
+     */
+    const state_type &integrate(double t_end)
+    {
+        while (_t < t_end)
+            step(t_end);
+        return _x;
+    }
+
+    /**
+     * @brief 事件模式：逐步求解直至谓词首次成立，并在稠密输出上二分定位谓词成立的时刻
+     *
+     * @param[in] pred 谓词，签名为 `bool(double t, const std::array<double, N> &x)`，初值处应不成立
+     * @param[in] t_max 自变量的上限
+     * @param[in] t_tol 事件时刻的定位精度
+     * @return 谓词是否在 `t_max` 之前成立，成立时当前位置即为事件发生的位置
+     */
+    template <typename Pred>
+    bool until(Pred &&pred, double t_max, double t_tol = 1e-12)
+    {
+        while (_t < t_max)
+        {
+            step(t_max);
+            if (!pred(_t, _x))
+                continue;
+            double lo = _t_prev, hi = _t;
+            while (hi - lo > t_tol)
+            {
+                double mid = 0.5 * (lo + hi);
+                pred(mid, dense(mid)) ? (hi = mid) : (lo = mid);
+            }
+            _x = dense(hi), _t = hi;
+            _f = _fs(_t, _x);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief 稠密输出，即最近一步内任意位置的因变量
+     *
+     * @param[in] t 自变量，应位于最近一步的区间内
+     * @return 三次 Hermite 插值得到的因变量
+     */
+    state_type dense(double t) const
+    {
+        double h = _t - _t_prev;
+        if (h == 0)
+            return _x;
+        double s = (t - _t_prev) / h, s2 = s * s, s3 = s2 * s;
+        double h00 = 2 * s3 - 3 * s2 + 1, h10 = s3 - 2 * s2 + s, h01 = -2 * s3 + 3 * s2, h11 = s3 - s2;
+        state_type x{};
+        for (std::size_t i = 0; i < N; ++i)
+            x[i] = h00 * _x_prev[i] + h10 * h * _f_prev[i] + h01 * _x[i] + h11 * h * _f[i];
+        return x;
+    }
+
+    //! 当前位置的自变量
+    inline double t() const { return _t; }
+    //! 当前位置的因变量
+    inline const state_type &x() const { return _x; }
+    //! 下一步的步长
+    inline double h() const { return _h; }
+    //! 已接受的步数
+    inline std::size_t accepted() const { return _accepted; }
+    //! 被拒绝的步数
+    inline std::size_t rejected() const { return _rejected; }
+
+private:
+    /**
+     * @brief 以步长 `h` 试算一步
+     *
+     * @param[in] h 步长
+     * @param[out] x_new 新的因变量
+     * @param[out] err 局部误差估计，仅在使用嵌入式 Butcher 表时有效
+     * @param[out] f_new 新位置处的导数，仅在 Butcher 表满足 FSAL 时有效
+     */
+    void trial(double h, state_type &x_new, state_type &err, state_type &f_new)
+    {
+        constexpr std::size_t S = Tableau::stages;
+        std::array<state_type, S> ks;
+        ks[0] = _f;
+        for (std::size_t s = 1; s < S; ++s)
+        {
+            state_type xs = _x;
+            for (std::size_t j = 0; j < s; ++j)
+                if (Tableau::r[s][j] != 0)
+                    for (std::size_t i = 0; i < N; ++i)
+                        xs[i] += h * Tableau::r[s][j] * ks[j][i];
+            ks[s] = _fs(_t + Tableau::p[s] * h, xs);
+        }
+        x_new = _x;
+        for (std::size_t s = 0; s < S; ++s)
+            if (Tableau::lambda[s] != 0)
+                for (std::size_t i = 0; i < N; ++i)
+                    x_new[i] += h * Tableau::lambda[s] * ks[s][i];
+        if constexpr (Tableau::embedded)
+            for (std::size_t s = 0; s < S; ++s)
+                for (std::size_t i = 0; i < N; ++i)
+                    err[i] += h * Tableau::e[s] * ks[s][i];
+        // 最后一级的位置与新的因变量相同，可直接作为下一步的第一级
+        if constexpr (Tableau::fsal)
+            f_new = ks[S - 1];
+    }
+
+    Fs _fs;                  //!< 常微分方程组的函数对象
+    double _t{};             //!< 当前位置的自变量
+    double _t_prev{};        //!< 上一步位置的自变量
+    double _h{};             //!< 下一步的步长
+    double _rtol{1e-6};      //!< 相对容许误差
+    double _atol{1e-9};      //!< 绝对容许误差
+    state_type _x{};         //!< 当前位置的因变量
+    state_type _x_prev{};    //!< 上一步位置的因变量
+    state_type _f{};         //!< 当前位置的导数
+    state_type _f_prev{};    //!< 上一步位置的导数
+    std::size_t _accepted{}; //!< 已接受的步数
+    std::size_t _rejected{}; //!< 被拒绝的步数
+};
+
+/**
+ * @brief 创建固定维度的常微分方程组数值求解器对象
+ *
+ * @tparam N 方程组的维度
+ * @tparam Tableau Butcher 表类型，默认为 `ButcherDP54`
+ * @param[in] fs 常微分方程组的函数对象，签名为 `std::array<double, N>(double t, const std::array<double, N> &x)`
+ * @return 常微分方程组数值求解器对象
+ */
+template <std::size_t N, typename Tableau = ButcherDP54, typename Fs>
+inline auto make_ode_integrator(Fs &&fs) { return OdeIntegrator<Tableau, N, std::decay_t<Fs>>(std::forward<Fs>(fs)); }
+
 //! @} algorithm_numcal
 
 //! @addtogroup algorithm_optimal
@@ -337,6 +748,9 @@ struct RMVL_EXPORTS_W_AG OptimalOptions
     RMVL_W_RW double exterior{1e3}; //!< 外罚函数系数
     RMVL_W_RW double dx{1e-2};      //!< 求解步长
     RMVL_W_RW double tol{1e-6};     //!< 误差容限
+    //! 是否并行计算梯度、雅可比矩阵与单纯形顶点中相互独立的函数值，结果与串行计算完全一致，开启时目标函数需可在多个线程中同时调用，
+    //! 适用于单次求值耗时较长（数十微秒以上）的目标函数
+    RMVL_W_RW bool parallel{false};
 };
 
 /**
@@ -386,7 +800,7 @@ RMVL_EXPORTS_W std::pair<double, double> fminbnd(Func1d func, double x1, double
  * @brief 无约束多维函数的最小值搜索，可参考 @ref tutorial_modules_fminunc
  * @param[in] func 多维约束函数
  * @param[in] x0 初始点
- * @param[in] options 优化选项，可供设置的有 `fmin_mode`、`max_iter`、`tol` 和 `dx`
+ * @param[in] options 优化选项，可供设置的有 `fmin_mode`、`max_iter`、`tol`、`dx` 和 `parallel`
  * @return `[x, fval]` 最小值点和最小值
  */
 RMVL_EXPORTS_W std::pair<std::vector<double>, double> fminunc(FuncNd func, const std::vector<double> &x0, const OptimalOptions &options = {});
@@ -398,7 +812,7 @@ RMVL_EXPORTS_W std::pair<std::vector<double>, double> fminunc(FuncNd func, const
  * @param[in] x0 初始点
  * @param[in] c 不等式约束 \f$f_c(x)\le0\f$
  * @param[in] ceq 等式约束 \f$f_{ceq}(x)=0\f$
- * @param[in] options options 优化选项，可供设置的有 `exterior`、`fmin_mode`、`max_iter`、`tol` 和 `dx`
+ * @param[in] options options 优化选项，可供设置的有 `exterior`、`fmin_mode`、`max_iter`、`tol`、`dx` 和 `parallel`
  * @return `[x, fval]` 最小值点和最小值
  */
 RMVL_EXPORTS_W std::pair<std::vector<double>, double> fmincon(FuncNd func, const std::vector<double> &x0, FuncNds c, FuncNds ceq, const OptimalOptions &options = {});
@@ -409,7 +823,7 @@ RMVL_EXPORTS_W std::pair<std::vector<double>, double> fmincon(FuncNd func, const
  * @param[in] funcs 最小二乘目标函数，满足 \f[F(\pmb x_k)=\frac12\|\pmb f(\pmb x_k)\|_2^2=\frac12
  *                  \left(\texttt{funcs}[0]^2+\texttt{funcs}[1]^2+\cdots+\texttt{funcs}[n]^2\right)\f]
  * @param[in] x0 初始点
- * @param[in] options 优化选项，可供设置的有 `lsq_mode`、`max_iter`、`tol` 和 `dx`
+ * @param[in] options 优化选项，可供设置的有 `lsq_mode`、`max_iter`、`tol`、`dx` 和 `parallel`
  * @return 最小二乘解
  */
 RMVL_EXPORTS_W std::vector<double> lsqnonlin(const FuncNds &funcs, const std::vector<double> &x0, const OptimalOptions &options = {});
@@ -430,11 +844,542 @@ enum class RobustMode : uint8_t
  * @param[in] funcs 最小二乘目标函数，参考 rm::lsqnonlin
  * @param[in] x0 初始点
  * @param[in] rb Robust 核函数模式，参考 rm::RobustMode ，选择 `rm::RobustMode::L2` 时退化为 `rm::lsqnonlin`
- * @param[in] options 优化选项，可供设置的有 `lsq_mode`、`max_iter`、`tol` 和 `dx`
+ * @param[in] options 优化选项，可供设置的有 `lsq_mode`、`max_iter`、`tol`、`dx` 和 `parallel`
  * @return 最小二乘解
  */
 RMVL_EXPORTS_W std::vector<double> lsqnonlinRKF(const FuncNds &funcs, const std::vector<double> &x0, RobustMode rb, const OptimalOptions &options = {});
 
+/**
+ * @brief 向量值残差函数
+ * @brief
+ * - 参数依次为自变量 \f$\pmb x\f$（长度为 `n`）、输出的残差 \f$\pmb f(\pmb x)\f$（长度为 `m`，由调用方分配）
+ */
+using ResidualFunc = std::function<void(const double *, double *)>;
+
+/**
+ * @brief 雅可比矩阵函数
+ * @brief
+ * - 参数依次为自变量 \f$\pmb x\f$（长度为 `n`）、输出的雅可比矩阵 \f$J(\pmb x)\f$（`m×n`，按行存储，由调用方分配并置零）
+ * - 指定稀疏结构时仅需写入各残差块依赖的列
+ */
+using JacobianFunc = std::function<void(const double *, double *)>;
+
+/**
+ * @brief 残差块，描述雅可比矩阵的块稀疏结构
+ * @brief
+ * - 各残差块按顺序覆盖全部残差，每个残差块中的残差仅依赖 `cols` 中的自变量，例如多帧位姿拟合中，每一帧的重投影残差仅依赖共享参数与该帧的位姿
+ */
+struct LsqBlock
+{
+    std::size_t rows{};            //!< 残差块包含的残差数
+    std::vector<std::size_t> cols; //!< 残差块依赖的自变量下标
+};
+
+/**
+ * @brief 向量值残差的非线性最小二乘求解
+ * @brief
+ * - 与 rm::lsqnonlin 使用相同的 Gauss-Newton 法与 Levenberg-Marquardt 法，但一次调用即计算全部残差，残差之间的公共计算只需进行一次，
+ *   残差与雅可比矩阵的缓冲区在求解前一次性分配，且不依赖 OpenCV
+ * - 未提供雅可比矩阵函数时使用中心差商，每个雅可比矩阵需要 \f$2c\f$ 次残差函数调用，其中 \f$c\f$ 为列的着色数：无稀疏结构时
+ *   \f$c=n\f$，指定稀疏结构时，不出现在同一残差块中的自变量可同时扰动
+ * - 指定稀疏结构时，\f$J^TJ\f$ 按残差块累加，代价为 \f$\sum_b\texttt{rows}_b\cdot|\texttt{cols}_b|^2\f$
+ *
+ * @param[in] func 残差函数，满足 \f$F(\pmb x)=\frac12\|\pmb f(\pmb x)\|_2^2\f$
+ * @param[in] m 残差数
+ * @param[in] x0 初始点
+ * @param[in] options 优化选项，可供设置的有 `lsq_mode`、`max_iter`、`tol`、`dx` 和 `parallel`
+ * @param[in] jac 雅可比矩阵函数，为空时使用中心差商
+ * @param[in] blocks 雅可比矩阵的块稀疏结构，为空时视为稠密矩阵
+ * @return 最小二乘解
+ */
+RMVL_EXPORTS std::vector<double> lsqnonlinVec(const ResidualFunc &func, std::size_t m, const std::vector<double> &x0, const OptimalOptions &options = {},
+                                              const JacobianFunc &jac = nullptr, const std::vector<LsqBlock> &blocks = {});
+
+/**
+ * @brief 可复用的向量值残差非线性最小二乘求解器
+ * @brief
+ * - 算法与 rm::lsqnonlinVec 相同，残差、雅可比矩阵、法方程等缓冲区以及稀疏结构的着色结果在构造时一次性分配，
+ *   之后对相同规模问题的重复求解不再进行堆内存分配，适用于每帧求解一次的场合
+ * @note 残差函数与雅可比矩阵函数应在求解之前构造好，以 `const` 引用传入，避免每次求解时构造 `std::function`
+ */
+class RMVL_EXPORTS LsqSolver
+{
+public:
+    /**
+     * @brief 创建可复用的向量值残差非线性最小二乘求解器
+     *
+     * @param[in] m 残差数
+     * @param[in] n 自变量数
+     * @param[in] blocks 雅可比矩阵的块稀疏结构，为空时视为稠密矩阵，参考 rm::LsqBlock
+     */
+    LsqSolver(std::size_t m, std::size_t n, const std::vector<LsqBlock> &blocks = {});
+
+    /**
+     * @brief 求解非线性最小二乘问题
+     *
+     * @param[in] func 残差函数
+     * @param[in] x0 初始点，长度需为 `n`
+     * @param[in] options 优化选项，可供设置的有 `lsq_mode`、`max_iter`、`tol`、`dx` 和 `parallel`
+     * @param[in] jac 雅可比矩阵函数，为空时使用中心差商
+     * @return 最小二乘解，在下一次求解前有效
+     */
+    const std::vector<double> &solve(const ResidualFunc &func, const std::vector<double> &x0, const OptimalOptions &options = {},
+                                     const JacobianFunc &jac = nullptr);
+
+private:
+    //! 计算 \f$J^TJ\f$ 与 \f$J^T\pmb f\f$，结果写入 `_H` 与 `_g`
+    void normal();
+
+    //! 计算雅可比矩阵
+    void jacobian();
+
+    //! Gauss-Newton 法
+    void solveGN(const OptimalOptions &options);
+
+    //! Levenberg-Marquardt 法
+    void solveLM(const OptimalOptions &options);
+
+    std::size_t _m;                                    //!< 残差数
+    std::size_t _n;                                    //!< 自变量数
+    std::vector<LsqBlock> _blocks;                     //!< 残差块
+    std::vector<std::size_t> _row_begin;               //!< 各残差块的起始行
+    std::vector<std::vector<std::size_t>> _col_blocks; //!< 各自变量所在的残差块
+    std::vector<std::vector<std::size_t>> _groups;     //!< 差商计算中同时扰动的自变量
+    const ResidualFunc *_func{};                       //!< 当前求解的残差函数
+    const JacobianFunc *_jac{};                        //!< 当前求解的雅可比矩阵函数
+    double _dx{};                                      //!< 差商步长
+    bool _parallel{};                                  //!< 是否并行计算差商
+    std::vector<double> _J;                            //!< 雅可比矩阵
+    std::vector<double> _fp;                           //!< 正向扰动后的残差
+    std::vector<double> _fm;                           //!< 负向扰动后的残差
+    std::vector<double> _xk;                           //!< 当前点
+    std::vector<double> _xt;                           //!< 试探点
+    std::vector<double> _f;                            //!< 当前点的残差
+    std::vector<double> _ft;                           //!< 试探点的残差
+    std::vector<double> _H;                            //!< \f$J^TJ\f$
+    std::vector<double> _A;                            //!< 法方程的系数矩阵
+    std::vector<double> _g;                            //!< \f$J^T\pmb f\f$
+    std::vector<double> _s;                            //!< 搜索方向
+    std::vector<double> _par_x;                        //!< 并行计算差商时各组的试探点
+    std::vector<double> _par_f;                        //!< 并行计算差商时各组正、负向扰动后的残差
+};
+
+//! @} algorithm_optimal
+
+namespace detail
+{
+
+//! @cond
+
+// 进退法确定搜索区间，rm::region 与固定维度的求解器共用此实现
+template <typename Func>
+std::pair<double, double> region(Func &func, double x0, double delta)
+{
+    // 限制扩展次数以避免无界函数导致死循环
+    for (int i = 0; i < 64; ++i, delta *= 2)
+    {
+        double f1{func(x0)}, f2{func(x0 + delta)};
+        if (f1 > f2)
+        {
+            double f3 = func(x0 + 3 * delta);
+            if (f2 < f3)
+                return {x0, x0 + 3 * delta};
+            if (f2 == f3)
+                return {x0 + delta, x0 + 3 * delta};
+            x0 += delta;
+        }
+        else if (f1 < f2)
+        {
+            double f0 = func(x0 - delta);
+            if (f0 > f1)
+                return {x0 - delta, x0 + delta};
+            if (f0 == f1)
+                return {x0 - delta, x0};
+            x0 -= 3 * delta;
+        }
+        else
+            return {x0, x0 + delta};
+    }
+    return {x0, x0 + delta};
+}
+
+// 黄金分割法一维搜索，rm::fminbnd 与固定维度的求解器共用此实现
+template <typename Func>
+std::pair<double, double> fminbnd(Func &func, double x1, double x2, const OptimalOptions &options)
+{
+    constexpr double phi = 0.618033988749895;
+    double a1{x1 + (1.0 - phi) * (x2 - x1)}, a2{x1 + phi * (x2 - x1)};
+    double f1{func(a1)}, f2{func(a2)};
+    for (int i = 0; i < options.max_iter && std::abs(x1 - x2) >= options.tol; ++i)
+    {
+        if (f1 < f2)
+            x2 = a2, a2 = a1, f2 = f1, a1 = x1 + (1.0 - phi) * (x2 - x1), f1 = func(a1);
+        else
+            x1 = a1, a1 = a2, f1 = f2, a2 = x1 + phi * (x2 - x1), f2 = func(a2);
+    }
+    return {0.5 * (x1 + x2), func(0.5 * (x1 + x2))};
+}
+
+// 中心差商计算偏导数
+template <typename Func, std::size_t N>
+double partial(Func &func, std::array<double, N> &x, std::size_t i, double dx)
+{
+    double xi = x[i];
+    x[i] = xi + dx;
+    double f1 = func(std::as_const(x));
+    x[i] = xi - dx;
+    double f2 = func(std::as_const(x));
+    x[i] = xi;
+    return (f1 - f2) / (2 * dx);
+}
+
+// 计算梯度，与 rm::grad 相同
+template <typename Func, std::size_t N>
+std::array<double, N> grad(Func &func, std::array<double, N> x, DiffMode mode, double dx)
+{
+    std::array<double, N> g{};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        if (mode == DiffMode::Ridders)
+        {
+            double T00{partial(func, x, i, 2 * dx)}, T10{partial(func, x, i, dx)}, T20{partial(func, x, i, dx / 2)};
+            double T11{(4. * T10 - T00) / 3.}, T21{(4. * T20 - T10) / 3.};
+            g[i] = (16. * T21 - T11) / 15.;
+        }
+        else
+            g[i] = partial(func, x, i, dx);
+    }
+    return g;
+}
+
+template <std::size_t N>
+inline double normL2(const std::array<double, N> &x)
+{
+    double retval{};
+    for (auto v : x)
+        retval += v * v;
+    return std::sqrt(retval);
+}
+
+// Cholesky 分解求解 n 阶对称正定线性方程组 Ax = b，A 按行存储，分解后下三角部分被覆盖为 Cholesky 因子，返回 A 是否正定
+inline bool choleskySolve(std::size_t n, double *a, const double *b, double *x)
+{
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        double d = a[j * n + j];
+        for (std::size_t k = 0; k < j; ++k)
+            d -= a[j * n + k] * a[j * n + k];
+        if (!(d > 0))
+            return false;
+        d = std::sqrt(d);
+        a[j * n + j] = d;
+        for (std::size_t i = j + 1; i < n; ++i)
+        {
+            double v = a[i * n + j];
+            for (std::size_t k = 0; k < j; ++k)
+                v -= a[i * n + k] * a[j * n + k];
+            a[i * n + j] = v / d;
+        }
+    }
+    // L y = b, Lᵀ x = y
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double v = b[i];
+        for (std::size_t k = 0; k < i; ++k)
+            v -= a[i * n + k] * x[k];
+        x[i] = v / a[i * n + i];
+    }
+    for (std::size_t i = n; i-- > 0;)
+    {
+        double v = x[i];
+        for (std::size_t k = i + 1; k < n; ++k)
+            v -= a[k * n + i] * x[k];
+        x[i] = v / a[i * n + i];
+    }
+    return true;
+}
+
+// 固定阶数的 Cholesky 分解，阶数在编译期确定
+template <std::size_t N>
+inline bool choleskySolve(std::array<double, N * N> &a, const std::array<double, N> &b, std::array<double, N> &x)
+{
+    return choleskySolve(N, a.data(), b.data(), x.data());
+}
+
+//! @endcond
+
+} // namespace detail
+
+//! @addtogroup algorithm_optimal
+//! @{
+
+/**
+ * @brief 固定维度的无约束多维函数的最小值搜索
+ * @brief
+ * - 算法与 rm::fminunc 相同，自变量使用 `std::array<double, N>` 存储，目标函数使用任意可调用对象，求解过程不进行动态内存分配，
+ *   适用于每帧求解一次的低维问题
+ *
+ * @tparam N 自变量的维度，需显式指定，例如 `rm::fminuncN<2>(func, {0, 0})`
+ * @param[in] func 目标函数，签名为 `double(const std::array<double, N> &x)`
+ * @param[in] x0 初始点
+ * @param[in] options 优化选项，可供设置的有 `diff_mode`、`fmin_mode`、`max_iter`、`tol` 和 `dx`
+ * @return `[x, fval]` 最小值点和最小值
+ */
+template <std::size_t N, typename Func>
+std::pair<std::array<double, N>, double> fminuncN(Func &&func, const std::array<double, N> &x0, const OptimalOptions &options = {})
+{
+    static_assert(N > 0, "N must be greater than 0");
+    using state_type = std::array<double, N>;
+    state_type xk = x0;
+    if (options.fmin_mode == FminMode::Simplex)
+    {
+        // 单纯形法
+        std::array<std::pair<state_type, double>, N + 1> splx;
+        for (std::size_t i = 0; i <= N; ++i)
+        {
+            splx[i].first = xk;
+            if (i > 0)
+                splx[i].first[i - 1] += 100 * options.dx;
+            splx[i].second = func(std::as_const(splx[i].first));
+        }
+        auto eval = [&](const state_type &x) { return std::make_pair(x, func(x)); };
+        for (int it = 0; it < options.max_iter; ++it)
+        {
+            std::sort(splx.begin(), splx.end(), [](const auto &a, const auto &b) { return a.second < b.second; });
+            const auto &xh = splx.back().first;
+            // 除最大值点外的所有点的中心
+            state_type xc{}, xr{}, xe{}, xs{};
+            for (std::size_t i = 0; i < N; ++i)
+                for (std::size_t j = 0; j < N; ++j)
+                    xc[j] += splx[i].first[j] / N;
+            // 反射，反射点函数值大于最差点时反压缩
+            for (std::size_t j = 0; j < N; ++j)
+                xr[j] = 2 * xc[j] - xh[j];
+            auto pr = eval(xr);
+            if (splx.back().second <= pr.second)
+            {
+                for (std::size_t j = 0; j < N; ++j)
+                    xr[j] = 0.5 * (xc[j] + xh[j]);
+                pr = eval(xr);
+            }
+            if (pr.second < splx[0].second)
+            {
+                // 扩展
+                for (std::size_t j = 0; j < N; ++j)
+                    xe[j] = 3 * xc[j] - 2 * xh[j];
+                auto pe = eval(xe);
+                splx.back() = pe.second < pr.second ? pe : pr;
+            }
+            else if (pr.second < splx[N - 1].second)
+                splx.back() = pr;
+            else
+            {
+                // 压缩，失败时向最优点收缩
+                for (std::size_t j = 0; j < N; ++j)
+                    xs[j] = 1.5 * xc[j] - 0.5 * xh[j];
+                auto ps = eval(xs);
+                if (ps.second < splx.back().second)
+                    splx.back() = ps;
+                else
+                    for (std::size_t i = 1; i <= N; ++i)
+                    {
+                        for (std::size_t j = 0; j < N; ++j)
+                            splx[i].first[j] = 0.5 * (splx[i].first[j] + splx[0].first[j]);
+                        splx[i].second = func(std::as_const(splx[i].first));
+                    }
+            }
+            if (std::abs(splx.back().second - splx.front().second) < options.tol)
+                break;
+        }
+        auto best = std::min_element(splx.begin(), splx.end(), [](const auto &a, const auto &b) { return a.second < b.second; });
+        return *best;
+    }
+    // 共轭梯度法
+    auto g = detail::grad(func, xk, options.diff_mode, options.dx);
+    double fval = func(std::as_const(xk));
+    double nbl = detail::normL2(g);
+    if (nbl < options.tol)
+        return {xk, fval};
+    state_type s{}, xt{};
+    for (std::size_t j = 0; j < N; ++j)
+        s[j] = -g[j];
+    auto func_alpha = [&](double alpha) {
+        for (std::size_t j = 0; j < N; ++j)
+            xt[j] = xk[j] + alpha * s[j];
+        return func(std::as_const(xt));
+    };
+    for (int it = 0; it < options.max_iter; ++it)
+    {
+        auto [a, b] = detail::region(func_alpha, 1, 1);
+        auto [alpha, fa] = detail::fminbnd(func_alpha, a, b, options);
+        for (std::size_t j = 0; j < N; ++j)
+            xk[j] += alpha * s[j];
+        fval = fa;
+        auto g2 = detail::grad(func, xk, options.diff_mode, options.dx);
+        double nbl2 = detail::normL2(g2);
+        if (nbl2 < options.tol)
+            break;
+        // PRP+ 公式计算 beta
+        double dot{};
+        for (std::size_t j = 0; j < N; ++j)
+            dot += g[j] * g2[j];
+        double beta = std::max((nbl2 * nbl2 - dot) / (nbl * nbl), 0.0);
+        for (std::size_t j = 0; j < N; ++j)
+            s[j] = -g2[j] + beta * s[j];
+        g = g2, nbl = nbl2;
+    }
+    return {xk, fval};
+}
+
+/**
+ * @brief 固定维度的有约束多维函数的最小值搜索
+ * @brief
+ * - 算法与 rm::fmincon 相同，使用外罚函数将约束问题转化为无约束问题后调用 rm::fminuncN
+ * - 约束以向量值函数的形式给出，一次调用计算全部约束，返回值可为 `std::array<double, K>` 等任意可迭代的容器
+ *
+ * @tparam N 自变量的维度，需显式指定
+ * @param[in] func 目标函数，签名为 `double(const std::array<double, N> &x)`
+ * @param[in] x0 初始点
+ * @param[in] c 不等式约束 \f$\pmb f_c(\pmb x)\le\pmb 0\f$，签名为 `std::array<double, K>(const std::array<double, N> &x)`
+ * @param[in] ceq 等式约束 \f$\pmb f_{ceq}(\pmb x)=\pmb 0\f$，签名与 `c` 相同
+ * @param[in] options 优化选项，可供设置的有 `exterior`、`diff_mode`、`fmin_mode`、`max_iter`、`tol` 和 `dx`
+ * @return `[x, fval]` 最小值点和最小值
+ */
+template <std::size_t N, typename Func, typename C, typename Ceq>
+std::pair<std::array<double, N>, double> fminconN(Func &&func, const std::array<double, N> &x0, C &&c, Ceq &&ceq, const OptimalOptions &options = {})
+{
+    const double M{options.exterior};
+    auto farg = [&](const std::array<double, N> &x) {
+        double fval = func(x), penalty{};
+        for (double v : ceq(x))
+            penalty += v * v;
+        for (double v : c(x))
+            penalty += v > 0 ? v * v : 0;
+        return fval + M * penalty;
+    };
+    return fminuncN(farg, x0, options);
+}
+
+/**
+ * @brief 固定维度的非线性最小二乘求解
+ * @brief
+ * - 算法与 rm::lsqnonlinVec 相同，自变量、残差、雅可比矩阵均使用 `std::array` 存储，残差函数与雅可比矩阵函数使用任意可调用对象，
+ *   求解过程不进行动态内存分配
+ * - 残差数 `M` 由残差函数的返回类型推导
+ *
+ * @tparam N 自变量的维度，需显式指定
+ * @param[in] func 残差函数，签名为 `std::array<double, M>(const std::array<double, N> &x)`
+ * @param[in] x0 初始点
+ * @param[in] options 优化选项，可供设置的有 `lsq_mode`、`max_iter`、`tol` 和 `dx`
+ * @param[in] jac 雅可比矩阵函数，签名为 `std::array<std::array<double, N>, M>(const std::array<double, N> &x)`，
+ *                缺省时使用中心差商
+ * @return 最小二乘解
+ */
+template <std::size_t N, typename Func, typename Jac = std::nullptr_t>
+std::array<double, N> lsqnonlinN(Func &&func, const std::array<double, N> &x0, const OptimalOptions &options = {}, Jac &&jac = nullptr)
+{
+    using state_type = std::array<double, N>;
+    using residual_type = std::decay_t<std::invoke_result_t<Func &, const state_type &>>;
+    constexpr std::size_t M = std::tuple_size_v<residual_type>;
+    static_assert(N > 0 && M > 0, "N and M must be greater than 0");
+
+    state_type xk = x0, xt{}, g{}, s{};
+    residual_type f = func(std::as_const(xk)), ft{};
+    std::array<double, N * N> H{}, A{};
+    std::array<state_type, M> J{};
+    // 计算雅可比矩阵、JᵀJ 与 Jᵀf
+    auto normal = [&] {
+        if constexpr (std::is_null_pointer_v<std::decay_t<Jac>>)
+        {
+            xt = xk;
+            for (std::size_t j = 0; j < N; ++j)
+            {
+                xt[j] = xk[j] + options.dx;
+                auto fp = func(std::as_const(xt));
+                xt[j] = xk[j] - options.dx;
+                auto fm = func(std::as_const(xt));
+                xt[j] = xk[j];
+                for (std::size_t i = 0; i < M; ++i)
+                    J[i][j] = (fp[i] - fm[i]) / (2 * options.dx);
+            }
+        }
+        else
+            J = jac(std::as_const(xk));
+        H.fill(0), g.fill(0);
+        for (std::size_t r = 0; r < M; ++r)
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                g[i] += J[r][i] * f[r];
+                for (std::size_t j = 0; j < N; ++j)
+                    H[i * N + j] += J[r][i] * J[r][j];
+            }
+    };
+    auto norm_f = [](const residual_type &v) {
+        double retval{};
+        for (auto x : v)
+            retval += x * x;
+        return std::sqrt(retval);
+    };
+
+    if (options.lsq_mode == LsqMode::LM)
+    {
+        double lambda{0.01};
+        for (int idx = 0; idx < options.max_iter; ++idx)
+        {
+            normal();
+            double current_error = norm_f(f);
+            while (idx < options.max_iter)
+            {
+                // (JᵀJ + λI)δ = Jᵀf
+                A = H;
+                for (std::size_t i = 0; i < N; ++i)
+                    A[i * N + i] += lambda;
+                bool solved = detail::choleskySolve<N>(A, g, s);
+                if (solved)
+                {
+                    for (std::size_t i = 0; i < N; ++i)
+                        xt[i] = xk[i] - s[i];
+                    ft = func(std::as_const(xt));
+                }
+                if (solved && norm_f(ft) < current_error)
+                {
+                    xk = xt, f = ft;
+                    lambda /= 2;
+                    break;
+                }
+                lambda *= 2;
+                idx++;
+            }
+            if (detail::normL2(s) < options.tol)
+                break;
+        }
+        return xk;
+    }
+    // Gauss-Newton 法
+    auto func_alpha = [&](double alpha) {
+        for (std::size_t i = 0; i < N; ++i)
+            xt[i] = xk[i] - alpha * s[i];
+        return norm_f(func(std::as_const(xt)));
+    };
+    for (int idx = 0; idx < options.max_iter; ++idx)
+    {
+        if (norm_f(f) < options.tol)
+            break;
+        // JᵀJs = Jᵀf
+        normal();
+        if (!detail::choleskySolve<N>(H, g, s))
+            break;
+        auto [a, b] = detail::region(func_alpha, 1, 1);
+        double alpha = detail::fminbnd(func_alpha, a, b, options).first;
+        for (std::size_t i = 0; i < N; ++i)
+            xk[i] -= alpha * s[i];
+        f = func(std::as_const(xk));
+        if (std::abs(alpha) * detail::normL2(s) < options.tol)
+            break;
+    }
+    return xk;
+}
+
 //! @} algorithm_optimal
 
 } // namespace rm
@@ -0,0 +1,289 @@
+/**
+ * @file perf_dsp.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 数字信号处理基准测试
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <cmath>
+#include <deque>
+
+#include <benchmark/benchmark.h>
+
+#ifdef HAVE_OPENCV
+#include <opencv2/core.hpp>
+#endif // HAVE_OPENCV
+
+#include "rmvl/algorithm/dsp.hpp"
+#include "rmvl/algorithm/math.hpp"
+
+namespace rm_test
+{
+
+// 能量机关转速，采样频率 100 Hz
+static double speed(int n) { return 0.785 * std::sin(1.9 * n / 100.0) + 1.305 + 0.05 * std::sin(37.0 * n); }
+
+// 每个采样点对窗口内的信号重新计算完整的 DFT，再取幅值最大的频点
+static void frequency_full_dft(benchmark::State &state)
+{
+    const std::size_t N = state.range(0);
+    rm::ComplexSignal window;
+    int n = 0;
+    for (; window.size() < N; ++n)
+        window.push_back(speed(n));
+    for (auto _ : state)
+    {
+        window.pop_front();
+        window.push_back(speed(n++));
+        auto X = rm::dft(window);
+        std::size_t k = 1;
+        for (std::size_t i = 2; i <= 10; ++i)
+            if (std::norm(X[i]) > std::norm(X[k]))
+                k = i;
+        benchmark::DoNotOptimize(k);
+    }
+}
+
+// 滑动 DFT 仅跟踪第 1 ~ 10 个频点
+static void frequency_sliding_dft(benchmark::State &state)
+{
+    const std::size_t N = state.range(0);
+    rm::SlidingDFT sdft(N, 1, 10);
+    int n = 0;
+    for (; n < static_cast<int>(N); ++n)
+        sdft.update(speed(n));
+    for (auto _ : state)
+    {
+        sdft.update(speed(n++));
+        benchmark::DoNotOptimize(sdft.frequency(100));
+    }
+    state.counters["omega"] = 2 * rm::PI * sdft.frequency(100);
+}
+
+// 每个采样点更新 10 个候选频率，每 N 个采样点输出一次
+static void frequency_goertzel(benchmark::State &state)
+{
+    const std::size_t N = state.range(0);
+    std::vector<double> freqs(10);
+    for (std::size_t i = 0; i < freqs.size(); ++i)
+        freqs[i] = (1.7 + 0.05 * i) / (2 * rm::PI * 100);
+    rm::GoertzelBank bank(freqs, N);
+    int n = 0;
+    for (auto _ : state)
+        if (bank.update(speed(n++)))
+            benchmark::DoNotOptimize(bank.peak());
+}
+
+BENCHMARK(frequency_full_dft)->Name("dominant frequency - full dft   ")->Arg(256)->Arg(1024);
+BENCHMARK(frequency_sliding_dft)->Name("dominant frequency - sliding dft")->Arg(256)->Arg(1024);
+BENCHMARK(frequency_goertzel)->Name("dominant frequency - goertzel   ")->Arg(256)->Arg(1024);
+
+// 原有的递归实现，仅支持 2 的幂，作为对照
+static rm::ComplexSignal fftRecursive(const rm::ComplexSignal &xt)
+{
+    std::size_t N = xt.size();
+    if (N == 1)
+        return xt;
+    rm::ComplexSignal pe(N / 2), po(N / 2);
+    for (std::size_t i = 0; i < N / 2; ++i)
+        pe[i] = xt[2 * i], po[i] = xt[2 * i + 1];
+    rm::ComplexSignal y(N);
+    auto ye = fftRecursive(pe), yo = fftRecursive(po);
+    for (std::size_t k = 0; k < N / 2; ++k)
+    {
+        auto wk_yo = std::polar(1.0, -2 * rm::PI / N * k) * yo[k];
+        y[k] = ye[k] + wk_yo, y[k + N / 2] = ye[k] - wk_yo;
+    }
+    return y;
+}
+
+static std::vector<std::complex<double>> fftInput(std::size_t N)
+{
+    std::vector<std::complex<double>> x(N);
+    for (std::size_t i = 0; i < N; ++i)
+        x[i] = speed(static_cast<int>(i));
+    return x;
+}
+
+static void fft_recursive(benchmark::State &state)
+{
+    auto x = fftInput(state.range(0));
+    rm::ComplexSignal xt(x.begin(), x.end());
+    for (auto _ : state)
+        benchmark::DoNotOptimize(fftRecursive(xt));
+}
+
+static void fft_deque(benchmark::State &state)
+{
+    auto x = fftInput(state.range(0));
+    rm::ComplexSignal xt(x.begin(), x.end());
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rm::dft(xt));
+}
+
+static void fft_plan(benchmark::State &state)
+{
+    auto x = fftInput(state.range(0));
+    rm::FFTPlan plan(x.size());
+    std::vector<std::complex<double>> X(x.size());
+    for (auto _ : state)
+    {
+        plan.forward(x.data(), X.data());
+        benchmark::DoNotOptimize(X.data());
+    }
+}
+
+static void fft_plan_real(benchmark::State &state)
+{
+    const std::size_t N = state.range(0);
+    std::vector<double> x(N);
+    for (std::size_t i = 0; i < N; ++i)
+        x[i] = speed(static_cast<int>(i));
+    rm::FFTPlan plan(N);
+    std::vector<std::complex<double>> X(N / 2 + 1);
+    for (auto _ : state)
+    {
+        plan.forwardReal(x.data(), X.data());
+        benchmark::DoNotOptimize(X.data());
+    }
+}
+
+#ifdef HAVE_OPENCV
+
+static void fft_cv(benchmark::State &state)
+{
+    auto x = fftInput(state.range(0));
+    cv::Mat input(1, static_cast<int>(x.size()), CV_64FC2, x.data()), output;
+    for (auto _ : state)
+    {
+        cv::dft(input, output, cv::DFT_COMPLEX_OUTPUT);
+        benchmark::DoNotOptimize(output.data);
+    }
+}
+
+static void fft_cv_real(benchmark::State &state)
+{
+    const int N = static_cast<int>(state.range(0));
+    cv::Mat input(1, N, CV_64FC1), output;
+    for (int i = 0; i < N; ++i)
+        input.at<double>(0, i) = speed(i);
+    for (auto _ : state)
+    {
+        cv::dft(input, output, cv::DFT_COMPLEX_OUTPUT);
+        benchmark::DoNotOptimize(output.data);
+    }
+}
+
+BENCHMARK(fft_cv)->Name("fft (complex) - by opencv   ")->Arg(1024)->Arg(1000)->Arg(1031);
+BENCHMARK(fft_cv_real)->Name("fft (real) - by opencv      ")->Arg(1024)->Arg(1000)->Arg(1031);
+
+#endif // HAVE_OPENCV
+
+BENCHMARK(fft_recursive)->Name("fft (complex) - recursive   ")->Arg(1024);
+BENCHMARK(fft_deque)->Name("fft (complex) - rm::dft     ")->Arg(1024)->Arg(1000)->Arg(1031);
+BENCHMARK(fft_plan)->Name("fft (complex) - rm::FFTPlan ")->Arg(1024)->Arg(1000)->Arg(1031);
+BENCHMARK(fft_plan_real)->Name("fft (real) - rm::FFTPlan    ")->Arg(1024)->Arg(1000)->Arg(1031);
+
+// 预先生成的输入信号，避免 speed 的计算耗时掩盖滤波器本身的代价
+static double sample(int n)
+{
+    static const std::vector<double> table = [] {
+        std::vector<double> t(1024);
+        for (int i = 0; i < 1024; ++i)
+            t[i] = speed(i);
+        return t;
+    }();
+    return table[n & 1023];
+}
+
+// 手写的滑动平均：每个采样点写入 std::deque 并重新求和，作为对照
+static void filter_deque_average(benchmark::State &state)
+{
+    const std::size_t N = state.range(0);
+    std::deque<double> window;
+    int n = 0;
+    for (auto _ : state)
+    {
+        window.push_back(sample(n++));
+        if (window.size() > N)
+            window.pop_front();
+        double sum{};
+        for (double v : window)
+            sum += v;
+        benchmark::DoNotOptimize(sum / window.size());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void filter_fir_average(benchmark::State &state)
+{
+    auto fir = rm::FIRFilter::movingAverage(state.range(0));
+    int n = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(fir.update(sample(n++)));
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void filter_fir_savgol(benchmark::State &state)
+{
+    auto fir = rm::FIRFilter::savitzkyGolay(state.range(0), 2, 1, 0.01);
+    int n = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(fir.update(sample(n++)));
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void filter_biquad(benchmark::State &state)
+{
+    auto lpf = rm::BiquadCascade::butterworth(state.range(0), 0.05);
+    int n = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(lpf.update(sample(n++)));
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void filter_one_euro(benchmark::State &state)
+{
+    rm::OneEuroFilter filter(1.0, 0.5);
+    int n = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(filter.update(sample(n), n * 0.01));
+        ++n;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 以 256 个采样点为一块进行处理，state.range(1) 为 0 时为 FIR 低通（参数为系数个数），为 1 时为 Butterworth 低通（参数为阶数）
+static void filter_block(benchmark::State &state)
+{
+    constexpr std::size_t B = 256;
+    std::vector<double> x(B), y(B);
+    for (std::size_t i = 0; i < B; ++i)
+        x[i] = speed(static_cast<int>(i));
+    auto fir = rm::FIRFilter::lowpass(state.range(0), 0.05);
+    auto iir = rm::BiquadCascade::butterworth(state.range(0), 0.05);
+    for (auto _ : state)
+    {
+        if (state.range(1) == 0)
+            fir.process(x.data(), y.data(), B);
+        else
+            iir.process(x.data(), y.data(), B);
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations() * B);
+}
+
+BENCHMARK(filter_deque_average)->Name("filter (moving average) - std::deque  ")->Arg(16)->Arg(64);
+BENCHMARK(filter_fir_average)->Name("filter (moving average) - FIRFilter  ")->Arg(16)->Arg(64);
+BENCHMARK(filter_fir_savgol)->Name("filter (savitzky-golay, derivative)  ")->Arg(11)->Arg(31);
+BENCHMARK(filter_biquad)->Name("filter (butterworth) - per sample     ")->Arg(2)->Arg(4);
+BENCHMARK(filter_one_euro)->Name("filter (one euro) - per sample        ");
+BENCHMARK(filter_block)->Name("filter (fir lowpass) - block of 256   ")->Args({31, 0})->Args({63, 0});
+BENCHMARK(filter_block)->Name("filter (butterworth) - block of 256   ")->Args({2, 1})->Args({4, 1});
+
+} // namespace rm_test
@@ -11,6 +11,8 @@
 
 #ifdef HAVE_OPENCV
 #include <fstream>
+#include <vector>
+
 #include <benchmark/benchmark.h>
 #include <opencv2/video/tracking.hpp>
 
@@ -76,8 +78,288 @@ void kalman42_opencv(benchmark::State &state)
     }
 }
 
+// 6 状态量 3 观测量的匀速运动模型，使用结构标签为 Structure 的 rm::KalmanFilter
+template <typename Structure>
+void kalman63_rmvl(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        rm::KalmanFilter<float, 6, 3, Structure> kf;
+        kf.setQ(cv::Matx66f::eye() * 0.1f);
+        kf.setR(cv::Matx33f::eye() * 1e-3f);
+        kf.init(cv::Matx61f::zeros(), 1e5f);
+        kf.setH({1, 0, 0, 0, 0, 0,
+                 0, 1, 0, 0, 0, 0,
+                 0, 0, 1, 0, 0, 0});
+        cv::Matx61f xk;
+        for (int i = 0; i < 1000; i++)
+        {
+            float t{0.01f};
+            kf.setA({1, 0, 0, t, 0, 0,
+                     0, 1, 0, 0, t, 0,
+                     0, 0, 1, 0, 0, t,
+                     0, 0, 0, 1, 0, 0,
+                     0, 0, 0, 0, 1, 0,
+                     0, 0, 0, 0, 0, 1});
+            kf.predict();
+            xk = kf.correct({1.f * i, 2.f * i, 3.f * i});
+        }
+        benchmark::DoNotOptimize(xk);
+    }
+}
+
+// 6 状态量 3 观测量的匀速运动模型，使用 cv::KalmanFilter
+void kalman63_opencv(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        cv::KalmanFilter kf(6, 3);
+        kf.processNoiseCov = cv::Mat::eye(6, 6, CV_32F) * 0.1;
+        kf.measurementNoiseCov = cv::Mat::eye(3, 3, CV_32F) * 1e-3;
+        kf.errorCovPost = cv::Mat::eye(6, 6, CV_32F) * 1e5;
+        kf.measurementMatrix = cv::Mat::eye(3, 6, CV_32F);
+        cv::Mat xk;
+        for (int i = 0; i < 1000; i++)
+        {
+            float t{0.01f};
+            kf.transitionMatrix = (cv::Mat_<float>(6, 6) << 1, 0, 0, t, 0, 0,
+                                   0, 1, 0, 0, t, 0,
+                                   0, 0, 1, 0, 0, t,
+                                   0, 0, 0, 1, 0, 0,
+                                   0, 0, 0, 0, 1, 0,
+                                   0, 0, 0, 0, 0, 1);
+            kf.predict();
+            cv::Mat z = (cv::Mat_<float>(3, 1) << 1.f * i, 2.f * i, 3.f * i);
+            xk = kf.correct(z);
+        }
+        benchmark::DoNotOptimize(xk);
+    }
+}
+
+/////////////////////// EKF 雅可比矩阵：自动微分与数值微分 ///////////////////////
+
+// 7 状态量 [cx, cy, cz, vx, vy, θ, ω] 的状态方程
+template <typename T>
+static cv::Matx<T, 7, 1> ekf73Fa(const cv::Matx<T, 7, 1> &x, double t)
+{
+    return {x(0) + x(3) * t, x(1) + x(4) * t, x(2), x(3), x(4), x(5) + x(6) * t, x(6)};
+}
+
+// 7 状态量 3 观测量的观测方程，装甲板绕中心旋转，半径 0.25
+template <typename T>
+static cv::Matx<T, 3, 1> ekf73Fh(const cv::Matx<T, 7, 1> &x)
+{
+    using std::cos, std::sin;
+    return {x(0) + 0.25 * cos(x(5)), x(1) + 0.25 * sin(x(5)), x(2)};
+}
+
+// 9 状态量 [cx, cy, cz, vx, vy, vz, θ, ω, r] 的状态方程
+template <typename T>
+static cv::Matx<T, 9, 1> ekf94Fa(const cv::Matx<T, 9, 1> &x, double t)
+{
+    return {x(0) + x(3) * t, x(1) + x(4) * t, x(2) + x(5) * t, x(3), x(4), x(5), x(6) + x(7) * t, x(7), x(8)};
+}
+
+// 9 状态量 4 观测量的观测方程
+template <typename T>
+static cv::Matx<T, 4, 1> ekf94Fh(const cv::Matx<T, 9, 1> &x)
+{
+    using std::cos, std::sin;
+    return {x(0) + x(8) * cos(x(6)), x(1) + x(8) * sin(x(6)), x(2), x(6)};
+}
+
+// 中心差分计算雅可比矩阵
+template <unsigned N, unsigned M, typename Func>
+static cv::Matx<double, M, N> numericJacobian(Func f, const cv::Matx<double, N, 1> &x)
+{
+    cv::Matx<double, M, N> J;
+    for (unsigned j = 0; j < N; j++)
+    {
+        auto x1 = x, x2 = x;
+        x1(j) += 1e-6, x2(j) -= 1e-6;
+        auto df = (f(x1) - f(x2)) * (1 / 2e-6);
+        for (unsigned i = 0; i < M; i++)
+            J(i, j) = df(i);
+    }
+    return J;
+}
+
+template <unsigned N, unsigned M, typename FaFunc, typename FhFunc>
+static void ekf_numeric(benchmark::State &state, FaFunc fa, FhFunc fh)
+{
+    for (auto _ : state)
+    {
+        rm::ExtendedKalmanFilter<double, N, M> ekf;
+        ekf.setQ(cv::Matx<double, N, N>::eye() * 0.1);
+        ekf.setR(cv::Matx<double, M, M>::eye() * 1e-3);
+        ekf.init(cv::Matx<double, N, 1>::zeros(), 1e5);
+        ekf.setFa(fa);
+        ekf.setFh(fh);
+        cv::Matx<double, N, 1> xk;
+        for (int i = 0; i < 1000; i++)
+        {
+            ekf.setJa(numericJacobian<N, N>(fa, xk));
+            auto x_ = ekf.predict();
+            ekf.setJh(numericJacobian<N, M>(fh, x_));
+            cv::Matx<double, M, 1> z;
+            for (unsigned j = 0; j < M; j++)
+                z(j) = 0.01 * i + j;
+            xk = ekf.correct(z);
+        }
+        benchmark::DoNotOptimize(xk);
+    }
+}
+
+template <unsigned N, unsigned M, typename FaFunc, typename FhFunc>
+static void ekf_autodiff(benchmark::State &state, FaFunc fa, FhFunc fh)
+{
+    for (auto _ : state)
+    {
+        auto ekf = rm::make_autodiff_ekf<double, N, M>(fa, fh);
+        ekf.setQ(cv::Matx<double, N, N>::eye() * 0.1);
+        ekf.setR(cv::Matx<double, M, M>::eye() * 1e-3);
+        ekf.init(cv::Matx<double, N, 1>::zeros(), 1e5);
+        cv::Matx<double, N, 1> xk;
+        for (int i = 0; i < 1000; i++)
+        {
+            ekf.predict();
+            cv::Matx<double, M, 1> z;
+            for (unsigned j = 0; j < M; j++)
+                z(j) = 0.01 * i + j;
+            xk = ekf.correct(z);
+        }
+        benchmark::DoNotOptimize(xk);
+    }
+}
+
+using Dual7d = rm::Dual<double, 7>;
+using Dual9d = rm::Dual<double, 9>;
+
+static void ekf73_numeric(benchmark::State &state)
+{
+    ekf_numeric<7, 3>(
+        state, [](const cv::Matx<double, 7, 1> &x) { return ekf73Fa(x, 0.01); }, ekf73Fh<double>);
+}
+
+static void ekf73_autodiff(benchmark::State &state)
+{
+    ekf_autodiff<7, 3>(
+        state, [](const cv::Matx<Dual7d, 7, 1> &x) { return ekf73Fa(x, 0.01); }, ekf73Fh<Dual7d>);
+}
+
+static void ekf94_numeric(benchmark::State &state)
+{
+    ekf_numeric<9, 4>(
+        state, [](const cv::Matx<double, 9, 1> &x) { return ekf94Fa(x, 0.01); }, ekf94Fh<double>);
+}
+
+static void ekf94_autodiff(benchmark::State &state)
+{
+    ekf_autodiff<9, 4>(
+        state, [](const cv::Matx<Dual9d, 9, 1> &x) { return ekf94Fa(x, 0.01); }, ekf94Fh<Dual9d>);
+}
+
+// 6 状态量 3 观测量的匀速运动模型单次更新（预测 + 校正）的耗时，Steady 表示是否使用离线求解的稳态增益
+template <typename Structure, bool Steady>
+void kalman63_update(benchmark::State &state)
+{
+    rm::KalmanFilter<float, 6, 3, Structure> kf;
+    kf.setQ(cv::Matx66f::eye() * 0.1f);
+    kf.setR(cv::Matx33f::eye() * 1e-3f);
+    kf.init(cv::Matx61f::zeros(), 1e5f);
+    float t{0.01f};
+    kf.setA({1, 0, 0, t, 0, 0,
+             0, 1, 0, 0, t, 0,
+             0, 0, 1, 0, 0, t,
+             0, 0, 0, 1, 0, 0,
+             0, 0, 0, 0, 1, 0,
+             0, 0, 0, 0, 0, 1});
+    if constexpr (Steady)
+        kf.solveSteadyState(1000, 1e-5f);
+    float i{};
+    for (auto _ : state)
+    {
+        kf.predict();
+        benchmark::DoNotOptimize(kf.correct({i, 2.f * i, 3.f * i}));
+        i += 1.f;
+    }
+}
+
+// K 个 6 状态量 3 观测量的 rm::KalmanFilter 逐个更新
+void kalman63_each(benchmark::State &state)
+{
+    std::size_t K = static_cast<std::size_t>(state.range(0));
+    std::vector<rm::KF63f> kfs(K);
+    for (auto &kf : kfs)
+    {
+        kf.setQ(cv::Matx66f::eye() * 0.1f);
+        kf.setR(cv::Matx33f::eye() * 1e-3f);
+        kf.init(cv::Matx61f::zeros(), 1e5f);
+    }
+    for (auto _ : state)
+    {
+        for (std::size_t k = 0; k < K; k++)
+        {
+            float t{0.01f + 0.001f * k};
+            kfs[k].setA({1, 0, 0, t, 0, 0,
+                         0, 1, 0, 0, t, 0,
+                         0, 0, 1, 0, 0, t,
+                         0, 0, 0, 1, 0, 0,
+                         0, 0, 0, 0, 1, 0,
+                         0, 0, 0, 0, 0, 1});
+            kfs[k].predict();
+            benchmark::DoNotOptimize(kfs[k].correct({1.f * k, 2.f * k, 3.f * k}));
+        }
+    }
+}
+
+// K 个 6 状态量 3 观测量的滤波器，使用 rm::KalmanFilterBank 批量更新
+void kalman63_bank(benchmark::State &state)
+{
+    std::size_t K = static_cast<std::size_t>(state.range(0));
+    rm::KFBank63f bank(K);
+    for (std::size_t k = 0; k < K; k++)
+    {
+        auto idx = bank.add();
+        bank.setQ(idx, cv::Matx66f::eye() * 0.1f);
+        bank.setR(idx, cv::Matx33f::eye() * 1e-3f);
+        bank.init(idx, cv::Matx61f::zeros(), 1e5f);
+    }
+    for (auto _ : state)
+    {
+        for (std::size_t k = 0; k < K; k++)
+        {
+            float t{0.01f + 0.001f * k};
+            bank.setA(k, {1, 0, 0, t, 0, 0,
+                          0, 1, 0, 0, t, 0,
+                          0, 0, 1, 0, 0, t,
+                          0, 0, 0, 1, 0, 0,
+                          0, 0, 0, 0, 1, 0,
+                          0, 0, 0, 0, 0, 1});
+            bank.setZ(k, {1.f * k, 2.f * k, 3.f * k});
+        }
+        bank.predict();
+        bank.correct();
+        benchmark::DoNotOptimize(bank.state(0));
+    }
+}
+
 BENCHMARK(kalman42_rmvl)->Name("kf (x_dim: 4, z_dim: 2, n: 1000) - by rmvl  ")->Iterations(10);
 BENCHMARK(kalman42_opencv)->Name("kf (x_dim: 4, z_dim: 2, n: 1000) - by opencv")->Iterations(10);
+BENCHMARK(kalman63_rmvl<rm::KFDense>)->Name("kf (x_dim: 6, z_dim: 3, n: 1000) - dense     ")->Iterations(100);
+BENCHMARK(kalman63_rmvl<rm::KFSelectH>)->Name("kf (x_dim: 6, z_dim: 3, n: 1000) - select H  ")->Iterations(100);
+BENCHMARK(kalman63_rmvl<rm::KFConstVelocity>)->Name("kf (x_dim: 6, z_dim: 3, n: 1000) - const vel ")->Iterations(100);
+BENCHMARK(kalman63_opencv)->Name("kf (x_dim: 6, z_dim: 3, n: 1000) - by opencv ")->Iterations(100);
+BENCHMARK(kalman63_update<rm::KFDense, false>)->Name("kf (x_dim: 6, z_dim: 3) update - dense, full       ");
+BENCHMARK(kalman63_update<rm::KFDense, true>)->Name("kf (x_dim: 6, z_dim: 3) update - dense, steady     ");
+BENCHMARK(kalman63_update<rm::KFConstVelocity, false>)->Name("kf (x_dim: 6, z_dim: 3) update - const vel, full   ");
+BENCHMARK(kalman63_update<rm::KFConstVelocity, true>)->Name("kf (x_dim: 6, z_dim: 3) update - const vel, steady ");
+BENCHMARK(ekf73_numeric)->Name("ekf (x_dim: 7, z_dim: 3, n: 1000) - numeric diff ")->Iterations(50);
+BENCHMARK(ekf73_autodiff)->Name("ekf (x_dim: 7, z_dim: 3, n: 1000) - autodiff     ")->Iterations(50);
+BENCHMARK(ekf94_numeric)->Name("ekf (x_dim: 9, z_dim: 4, n: 1000) - numeric diff ")->Iterations(50);
+BENCHMARK(ekf94_autodiff)->Name("ekf (x_dim: 9, z_dim: 4, n: 1000) - autodiff     ")->Iterations(50);
+BENCHMARK(kalman63_each)->Name("kf (x_dim: 6, z_dim: 3) x K - one by one")->RangeMultiplier(2)->Range(1, 64);
+BENCHMARK(kalman63_bank)->Name("kf (x_dim: 6, z_dim: 3) x K - by bank   ")->RangeMultiplier(2)->Range(1, 64);
 
 } // namespace rm_test
 
@@ -0,0 +1,208 @@
+/**
+ * @file perf_numcal.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 数值计算模块基准测试
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include "rmvl/algorithm/numcal.hpp"
+
+namespace rm_test
+{
+
+/////////////////////// 重力补偿的弹道模型 ///////////////////////
+
+// 空气阻力系数，与 gravity_compensator 的默认参数一致
+static const double k_drag = 1.29 * 1.4186e-3 * 4.0194e-5 / (2 * 0.041);
+static const double a22 = -k_drag * 0.26, a24 = -k_drag * 0.2, a42 = -a24, a44 = a22;
+static constexpr double g = 9.788, v0 = 16, angle = 0.1, target = 8;
+
+using State = std::array<double, 4>;
+
+static State bullet(double, const State &x) { return {x[1], a22 * x[1] + a24 * x[3], x[3], a42 * x[1] + a44 * x[3] - g}; }
+
+static const rm::Odes bullet_odes = {[](double, const std::vector<double> &x) { return x[1]; },
+                                     [](double, const std::vector<double> &x) { return a22 * x[1] + a24 * x[3]; },
+                                     [](double, const std::vector<double> &x) { return x[3]; },
+                                     [](double, const std::vector<double> &x) { return a42 * x[1] + a44 * x[3] - g; }};
+
+// 高精度参考解：水平距离到达 target 时的落点高度
+static double referenceHeight()
+{
+    static double y = [] {
+        auto integrator = rm::make_ode_integrator<4>(bullet);
+        integrator.setTolerance(1e-13, 1e-15);
+        integrator.init(0, {0, v0 * std::cos(angle), 0, v0 * std::sin(angle)}, 1e-3);
+        integrator.until([](double, const State &x) { return x[0] >= target; }, 10, 1e-15);
+        return integrator.x()[2];
+    }();
+    return y;
+}
+
+// 与 GravityCompensator 相同的使用方式：积分整条弹道后在目标水平距离处线性插值
+template <typename RK>
+static double legacyHeight(RK &rk, double h)
+{
+    rk.init(0, {0, v0 * std::cos(angle), 0, v0 * std::sin(angle)});
+    auto res = rk.solve(h, static_cast<std::size_t>(std::ceil(target / (v0 * std::cos(angle)) * 1.15 / h)) + 1);
+    std::size_t i = 1;
+    while (res[i][0] < target)
+        i++;
+    double r = (target - res[i - 1][0]) / (res[i][0] - res[i - 1][0]);
+    return res[i - 1][2] + (res[i][2] - res[i - 1][2]) * r;
+}
+
+template <typename RK>
+static void bullet_legacy(benchmark::State &state)
+{
+    constexpr double h = 0.02;
+    RK rk(bullet_odes);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(legacyHeight(rk, h));
+    state.counters["y_err"] = std::abs(legacyHeight(rk, h) - referenceHeight());
+}
+
+// 固定维度的求解器，使用事件模式在目标水平距离处停止
+template <typename Tableau>
+static void bullet_fixed_dim(benchmark::State &state)
+{
+    auto integrator = rm::make_ode_integrator<4, Tableau>(bullet);
+    integrator.setTolerance(1e-6, 1e-6);
+    for (auto _ : state)
+    {
+        integrator.init(0, {0, v0 * std::cos(angle), 0, v0 * std::sin(angle)}, 0.02);
+        integrator.until([](double, const State &x) { return x[0] >= target; }, 10, 1e-9);
+        benchmark::DoNotOptimize(integrator.x());
+    }
+    state.counters["y_err"] = std::abs(integrator.x()[2] - referenceHeight());
+    state.counters["steps"] = static_cast<double>(integrator.accepted() + integrator.rejected());
+}
+
+BENCHMARK(bullet_legacy<rm::RungeKutta2>)->Name("bullet (x: 8 m) - RungeKutta2, h = 0.02      ");
+BENCHMARK(bullet_legacy<rm::RungeKutta4>)->Name("bullet (x: 8 m) - RungeKutta4, h = 0.02      ");
+BENCHMARK(bullet_fixed_dim<rm::ButcherRK2>)->Name("bullet (x: 8 m) - OdeIntegrator RK2, h = 0.02");
+BENCHMARK(bullet_fixed_dim<rm::ButcherRK4>)->Name("bullet (x: 8 m) - OdeIntegrator RK4, h = 0.02");
+BENCHMARK(bullet_fixed_dim<rm::ButcherBS32>)->Name("bullet (x: 8 m) - OdeIntegrator BS32, tol 1e-6");
+BENCHMARK(bullet_fixed_dim<rm::ButcherDP54>)->Name("bullet (x: 8 m) - OdeIntegrator DP54, tol 1e-6");
+
+/////////////////////// 滑动窗口更新 ///////////////////////
+
+static double signal(int i) { return std::sin(0.05 * i) + 0.1 * std::cos(0.7 * i); }
+
+// 每帧由窗口内的样本重新构造插值器
+static void interpolator_rebuild(benchmark::State &state)
+{
+    const int n = static_cast<int>(state.range(0));
+    std::vector<double> xs(n), ys(n);
+    int i = 0;
+    for (auto _ : state)
+    {
+        for (int k = 0; k < n; ++k)
+            xs[k] = i + k, ys[k] = signal(i + k);
+        rm::Interpolator foo(xs, ys);
+        benchmark::DoNotOptimize(foo(i + n));
+        ++i;
+    }
+}
+
+// 每帧删除最早的样本并添加新的样本
+static void interpolator_sliding(benchmark::State &state)
+{
+    const int n = static_cast<int>(state.range(0));
+    std::vector<double> xs(n), ys(n);
+    for (int k = 0; k < n; ++k)
+        xs[k] = k, ys[k] = signal(k);
+    rm::Interpolator foo(xs, ys);
+    int i = n;
+    for (auto _ : state)
+    {
+        foo.pop().add(i, signal(i));
+        benchmark::DoNotOptimize(foo(i + 1));
+        ++i;
+    }
+}
+
+#ifdef HAVE_OPENCV
+
+static void curve_fitter_rebuild(benchmark::State &state)
+{
+    const int n = static_cast<int>(state.range(0));
+    std::vector<double> xs(n), ys(n);
+    int i = 0;
+    for (auto _ : state)
+    {
+        for (int k = 0; k < n; ++k)
+            xs[k] = 0.01 * (i + k), ys[k] = signal(i + k);
+        rm::CurveFitter foo(xs, ys, 0b111);
+        benchmark::DoNotOptimize(foo(0.01 * (i + n)));
+        ++i;
+    }
+}
+
+#endif // HAVE_OPENCV
+
+static void curve_fitter_sliding(benchmark::State &state)
+{
+    const int n = static_cast<int>(state.range(0));
+    rm::SlidingCurveFitter foo(n, 0b111);
+    int i = 0;
+    for (; i < n; ++i)
+        foo.add(0.01 * i, signal(i));
+    for (auto _ : state)
+    {
+        foo.add(0.01 * i, signal(i));
+        benchmark::DoNotOptimize(foo(0.01 * (i + 1)));
+        ++i;
+    }
+}
+
+BENCHMARK(interpolator_rebuild)->Name("interpolator - rebuild")->Arg(8)->Arg(32);
+BENCHMARK(interpolator_sliding)->Name("interpolator - pop + add")->Arg(8)->Arg(32);
+#ifdef HAVE_OPENCV
+BENCHMARK(curve_fitter_rebuild)->Name("curve fitter (ax^2+bx+c) - rebuild")->Arg(32)->Arg(128);
+#endif // HAVE_OPENCV
+BENCHMARK(curve_fitter_sliding)->Name("curve fitter (ax^2+bx+c) - sliding")->Arg(32)->Arg(128);
+
+/////////////////////// 多项式批量求值 ///////////////////////
+
+static const rm::Polynomial poly({0.3, -1.2, 0.7, 2.1, -0.4, 0.05});
+
+static void polynomial_scalar(benchmark::State &state)
+{
+    std::vector<double> xs(state.range(0)), ys(state.range(0));
+    for (std::size_t i = 0; i < xs.size(); ++i)
+        xs[i] = 0.001 * i;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < xs.size(); ++i)
+            ys[i] = poly(xs[i]);
+        benchmark::DoNotOptimize(ys.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void polynomial_batch(benchmark::State &state)
+{
+    std::vector<double> xs(state.range(0)), ys(state.range(0));
+    for (std::size_t i = 0; i < xs.size(); ++i)
+        xs[i] = 0.001 * i;
+    for (auto _ : state)
+    {
+        poly.eval(xs.data(), ys.data(), xs.size());
+        benchmark::DoNotOptimize(ys.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(polynomial_scalar)->Name("polynomial (degree 5) - scalar")->Arg(1024);
+BENCHMARK(polynomial_batch)->Name("polynomial (degree 5) - batch ")->Arg(1024);
+
+} // namespace rm_test
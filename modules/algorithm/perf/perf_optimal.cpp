@@ -9,14 +9,41 @@
  *
  */
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
 #include <benchmark/benchmark.h>
+
+#ifdef HAVE_OPENCV
 #include <opencv2/core.hpp>
+#endif // HAVE_OPENCV
 
 #include "rmvl/algorithm/numcal.hpp"
 
+// 统计堆内存分配次数
+static std::atomic_size_t g_allocs{};
+
+void *operator new(std::size_t size)
+{
+    ++g_allocs;
+    if (void *p = std::malloc(size == 0 ? 1 : size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
 namespace rm_test
 {
 
+// 每次求解的平均堆内存分配次数
+static inline void countAllocs(benchmark::State &state, std::size_t begin)
+{
+    state.counters["allocs"] = static_cast<double>(g_allocs - begin) / state.iterations();
+}
+
 /////////////////////// Quadratic Function ///////////////////////
 
 static double quadraticFunc(const std::vector<double> &x)
@@ -27,10 +54,26 @@ static double quadraticFunc(const std::vector<double> &x)
 
 static void cg_quadratic_rmvl(benchmark::State &state)
 {
+    auto begin = g_allocs.load();
     for (auto _ : state)
         rm::fminunc(quadraticFunc, {0, 0});
+    countAllocs(state, begin);
+}
+
+static void cg_quadratic_fixed(benchmark::State &state)
+{
+    auto quadratic = [](const std::array<double, 2> &x) { return 60 - 10 * x[0] - 4 * x[1] + x[0] * x[0] + x[1] * x[1] - x[0] * x[1]; };
+    auto begin = g_allocs.load();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rm::fminuncN<2>(quadratic, {0, 0}));
+    countAllocs(state, begin);
 }
 
+BENCHMARK(cg_quadratic_rmvl)->Name("fminunc (conj_grad, quadratic) - by rmvl  ")->Iterations(50);
+BENCHMARK(cg_quadratic_fixed)->Name("fminunc (conj_grad, quadratic) - fixed N=2 ")->Iterations(50);
+
+#ifdef HAVE_OPENCV
+
 class Quadratic : public cv::MinProblemSolver::Function
 {
 public:
@@ -54,9 +97,10 @@ static void cg_quadratic_cv(benchmark::State &state)
     }
 }
 
-BENCHMARK(cg_quadratic_rmvl)->Name("fminunc (conj_grad, quadratic) - by rmvl  ")->Iterations(50);
 BENCHMARK(cg_quadratic_cv)->Name("fminunc (conj_grad, quadratic) - by opencv")->Iterations(50);
 
+#endif // HAVE_OPENCV
+
 static inline double cle1(const std::vector<double> &x) { return -x[0] - x[1] + 10; }
 static inline double cle2(const std::vector<double> &x) { return 2 * x[0] + x[1] - 30; }
 static inline double cle3(const std::vector<double> &x) { return -x[0] + x[1] - 5; }
@@ -87,6 +131,10 @@ void splx_rosenbrock_rmvl(benchmark::State &state)
     }
 }
 
+BENCHMARK(splx_rosenbrock_rmvl)->Name("fminunc (simplex, rosenbrock) - by rmvl  ")->Iterations(50);
+
+#ifdef HAVE_OPENCV
+
 class Rosenbrock : public cv::DownhillSolver::Function
 {
 public:
@@ -111,9 +159,10 @@ void splx_rosenbrock_cv(benchmark::State &state)
     }
 }
 
-BENCHMARK(splx_rosenbrock_rmvl)->Name("fminunc (simplex, rosenbrock) - by rmvl  ")->Iterations(50);
 BENCHMARK(splx_rosenbrock_cv)->Name("fminunc (simplex, rosenbrock) - by opencv")->Iterations(50);
 
+#endif // HAVE_OPENCV
+
 // 待拟合曲线: 0.8sin(1.9FPSx) + 2.09 - 0.8
 static inline double real_f(double x)
 {
@@ -121,8 +170,11 @@ static inline double real_f(double x)
     return 0.8 * std::sin(1.9 / FPS * x - 0.2) + 1.29;
 };
 
+#ifdef HAVE_OPENCV
+
 void lsqnonlin_rmvl(benchmark::State &state)
 {
+    auto begin = g_allocs.load();
     for (auto _ : state)
     {
         rm::FuncNds lsq_sine(20);
@@ -131,8 +183,236 @@ void lsqnonlin_rmvl(benchmark::State &state)
 
         auto x = rm::lsqnonlin(lsq_sine, {1, 0.02, 0, 1.09});
     }
+    countAllocs(state, begin);
+}
+
+BENCHMARK(lsqnonlin_rmvl)->Name("lsqnonlin (sine) - by rmvl                   ")->Iterations(50);
+
+#endif // HAVE_OPENCV
+
+// 一次计算全部残差，使用中心差商
+void lsqnonlin_vec_numeric(benchmark::State &state)
+{
+    auto residual = [](const double *x, double *r) {
+        for (int i = 0; i < 20; ++i)
+            r[i] = x[0] * std::sin(x[1] * i + x[2]) + x[3] - real_f(i);
+    };
+    auto begin = g_allocs.load();
+    for (auto _ : state)
+        auto x = rm::lsqnonlinVec(residual, 20, {1, 0.02, 0, 1.09});
+    countAllocs(state, begin);
+}
+
+// 一次计算全部残差，使用解析雅可比矩阵
+void lsqnonlin_vec_analytic(benchmark::State &state)
+{
+    auto residual = [](const double *x, double *r) {
+        for (int i = 0; i < 20; ++i)
+            r[i] = x[0] * std::sin(x[1] * i + x[2]) + x[3] - real_f(i);
+    };
+    auto jacobian = [](const double *x, double *J) {
+        for (int i = 0; i < 20; ++i, J += 4)
+        {
+            double s = std::sin(x[1] * i + x[2]), c = std::cos(x[1] * i + x[2]);
+            J[0] = s, J[1] = x[0] * c * i, J[2] = x[0] * c, J[3] = 1;
+        }
+    };
+    auto begin = g_allocs.load();
+    for (auto _ : state)
+        auto x = rm::lsqnonlinVec(residual, 20, {1, 0.02, 0, 1.09}, {}, jacobian);
+    countAllocs(state, begin);
+}
+
+// 复用求解器的缓冲区
+void lsqnonlin_vec_reuse(benchmark::State &state)
+{
+    rm::ResidualFunc residual = [](const double *x, double *r) {
+        for (int i = 0; i < 20; ++i)
+            r[i] = x[0] * std::sin(x[1] * i + x[2]) + x[3] - real_f(i);
+    };
+    rm::LsqSolver solver(20, 4);
+    const std::vector<double> x0 = {1, 0.02, 0, 1.09};
+    auto begin = g_allocs.load();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(solver.solve(residual, x0));
+    countAllocs(state, begin);
+}
+
+// 固定维度
+void lsqnonlin_fixed(benchmark::State &state)
+{
+    auto residual = [](const std::array<double, 4> &x) {
+        std::array<double, 20> r{};
+        for (int i = 0; i < 20; ++i)
+            r[i] = x[0] * std::sin(x[1] * i + x[2]) + x[3] - real_f(i);
+        return r;
+    };
+    auto begin = g_allocs.load();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rm::lsqnonlinN<4>(residual, {1, 0.02, 0, 1.09}));
+    countAllocs(state, begin);
+}
+
+BENCHMARK(lsqnonlin_vec_numeric)->Name("lsqnonlin (sine) - vector residual, numeric  ")->Iterations(50);
+BENCHMARK(lsqnonlin_vec_analytic)->Name("lsqnonlin (sine) - vector residual, analytic ")->Iterations(50);
+BENCHMARK(lsqnonlin_vec_reuse)->Name("lsqnonlin (sine) - vector residual, reused   ")->Iterations(50);
+BENCHMARK(lsqnonlin_fixed)->Name("lsqnonlin (sine) - fixed N=4, M=20           ")->Iterations(50);
+
+// 多段观测共享振幅与角频率，每段观测的相位与偏置相互独立，state.range(0) 为观测段数
+static constexpr int SEG_N = 20;
+static inline double segment_f(int k, int i) { return 0.8 * std::sin(1.9 * i / 10. + 0.3 * k) + 1.2 + 0.1 * k; }
+
+static std::vector<double> segmentX0(int K)
+{
+    std::vector<double> x0 = {1, 2};
+    for (int k = 0; k < K; ++k)
+        x0.insert(x0.end(), {0.3 * k + 0.1, 1});
+    return x0;
+}
+
+#ifdef HAVE_OPENCV
+
+void lsqnonlin_segments_rmvl(benchmark::State &state)
+{
+    const int K = static_cast<int>(state.range(0));
+    rm::FuncNds funcs;
+    for (int k = 0; k < K; ++k)
+        for (int i = 0; i < SEG_N; ++i)
+            funcs.push_back([=](const std::vector<double> &x) { return x[0] * std::sin(x[1] * i / 10. + x[2 + 2 * k]) + x[3 + 2 * k] - segment_f(k, i); });
+    rm::OptimalOptions options;
+    options.lsq_mode = rm::LsqMode::LM;
+    options.max_iter = 200;
+    auto x0 = segmentX0(K);
+    for (auto _ : state)
+        auto x = rm::lsqnonlin(funcs, x0, options);
+}
+
+BENCHMARK(lsqnonlin_segments_rmvl)->Name("lsqnonlin (segments) - by rmvl               ")->Arg(4)->Arg(16)->Iterations(20);
+
+#endif // HAVE_OPENCV
+
+void lsqnonlin_segments_vec(benchmark::State &state)
+{
+    const int K = static_cast<int>(state.range(0));
+    auto residual = [=](const double *x, double *r) {
+        for (int k = 0; k < K; ++k)
+            for (int i = 0; i < SEG_N; ++i)
+                *r++ = x[0] * std::sin(x[1] * i / 10. + x[2 + 2 * k]) + x[3 + 2 * k] - segment_f(k, i);
+    };
+    std::vector<rm::LsqBlock> blocks;
+    if (state.range(1))
+        for (std::size_t k = 0; k < static_cast<std::size_t>(K); ++k)
+            blocks.push_back({SEG_N, {0, 1, 2 + 2 * k, 3 + 2 * k}});
+    rm::OptimalOptions options;
+    options.lsq_mode = rm::LsqMode::LM;
+    options.max_iter = 200;
+    auto x0 = segmentX0(K);
+    for (auto _ : state)
+        auto x = rm::lsqnonlinVec(residual, K * SEG_N, x0, options, nullptr, blocks);
+}
+
+BENCHMARK(lsqnonlin_segments_vec)->Name("lsqnonlin (segments) - vector residual, dense")->Args({4, 0})->Args({16, 0})->Iterations(20);
+BENCHMARK(lsqnonlin_segments_vec)->Name("lsqnonlin (segments) - vector residual, block")->Args({4, 1})->Args({16, 1})->Iterations(20);
+
+// 单次求值耗时较长的目标函数，state.range(0) 为自变量个数，state.range(1) 表示是否并行计算
+static double costlyTerm(const double *x, std::size_t n)
+{
+    // 数值积分 ∫₀¹ exp(-t)·cos(t·Σx) dt，单次求值耗时约数十微秒
+    double w{}, acc{};
+    for (std::size_t i = 0; i < n; ++i)
+        w += x[i];
+    constexpr int K = 4000;
+    for (int k = 0; k <= K; ++k)
+    {
+        double t = static_cast<double>(k) / K;
+        acc += (k == 0 || k == K ? 0.5 : 1.0) * std::exp(-t) * std::cos(t * w);
+    }
+    return 1e-3 * acc / K;
+}
+
+static void costly_fminunc(benchmark::State &state, rm::FminMode mode)
+{
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto func = [n](const std::vector<double> &x) {
+        double sum{};
+        for (std::size_t i = 0; i < n; ++i)
+            sum += (i + 1) * (x[i] - 0.1 * i) * (x[i] - 0.1 * i);
+        return sum + costlyTerm(x.data(), n);
+    };
+    rm::OptimalOptions options;
+    options.fmin_mode = mode;
+    options.max_iter = mode == rm::FminMode::Simplex ? 200 : 20;
+    options.parallel = state.range(1);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rm::fminunc(func, std::vector<double>(n, 1), options));
+}
+
+static void costly_lsqnonlin(benchmark::State &state)
+{
+    auto n = static_cast<std::size_t>(state.range(0));
+    rm::ResidualFunc residual = [n](const double *x, double *r) {
+        double c = costlyTerm(x, n);
+        for (std::size_t i = 0; i < n; ++i)
+            r[i] = (i + 1) * (x[i] - 0.1 * i) + c;
+    };
+    rm::OptimalOptions options;
+    options.max_iter = 20;
+    options.parallel = state.range(1);
+    rm::LsqSolver solver(n, n);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(solver.solve(residual, std::vector<double>(n, 1), options));
+}
+
+BENCHMARK_CAPTURE(costly_fminunc, conj_grad, rm::FminMode::ConjGrad)->Name("fminunc (conj_grad, costly) - serial/parallel")->ArgsProduct({{6, 12}, {0, 1}})->Iterations(5);
+BENCHMARK_CAPTURE(costly_fminunc, simplex, rm::FminMode::Simplex)->Name("fminunc (simplex, costly) - serial/parallel  ")->ArgsProduct({{6, 12}, {0, 1}})->Iterations(5);
+BENCHMARK(costly_lsqnonlin)->Name("lsqnonlin (costly) - serial/parallel          ")->ArgsProduct({{6, 12}, {0, 1}})->Iterations(5);
+
+// 单次求值耗时仅数微秒的目标函数，并行计算的收益取决于线程调度的开销，state.range(1) 表示是否并行计算
+static double cheapTerm(const double *x, std::size_t n)
+{
+    double w{}, acc{};
+    for (std::size_t i = 0; i < n; ++i)
+        w += x[i];
+    for (int k = 0; k < 100; ++k)
+        acc += std::cos(k * 0.01 * w);
+    return 1e-5 * acc;
+}
+
+static void cheap_fminunc(benchmark::State &state, rm::FminMode mode)
+{
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto func = [n](const std::vector<double> &x) {
+        double sum{};
+        for (std::size_t i = 0; i < n; ++i)
+            sum += (i + 1) * (x[i] - 0.1 * i) * (x[i] - 0.1 * i);
+        return sum + cheapTerm(x.data(), n);
+    };
+    rm::OptimalOptions options;
+    options.fmin_mode = mode;
+    options.max_iter = mode == rm::FminMode::Simplex ? 200 : 20;
+    options.parallel = state.range(1);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rm::fminunc(func, std::vector<double>(n, 1), options));
+}
+
+static void cheap_lsqnonlin(benchmark::State &state)
+{
+    auto n = static_cast<std::size_t>(state.range(0));
+    rm::ResidualFunc residual = [n](const double *x, double *r) {
+        double c = cheapTerm(x, n);
+        for (std::size_t i = 0; i < n; ++i)
+            r[i] = (i + 1) * (x[i] - 0.1 * i) + c;
+    };
+    rm::OptimalOptions options;
+    options.max_iter = 20;
+    options.parallel = state.range(1);
+    rm::LsqSolver solver(n, n);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(solver.solve(residual, std::vector<double>(n, 1), options));
 }
 
-BENCHMARK(lsqnonlin_rmvl)->Name("lsqnonlin (sine) - by rmvl")->Iterations(50);
+BENCHMARK_CAPTURE(cheap_fminunc, conj_grad, rm::FminMode::ConjGrad)->Name("fminunc (conj_grad, cheap) - serial/parallel ")->ArgsProduct({{6, 12}, {0, 1}})->Iterations(20);
+BENCHMARK_CAPTURE(cheap_fminunc, simplex, rm::FminMode::Simplex)->Name("fminunc (simplex, cheap) - serial/parallel   ")->ArgsProduct({{6, 12}, {0, 1}})->Iterations(20);
+BENCHMARK(cheap_lsqnonlin)->Name("lsqnonlin (cheap) - serial/parallel           ")->ArgsProduct({{6, 12}, {0, 1}})->Iterations(20);
 
 } // namespace rm_test
@@ -13,6 +13,9 @@
 #include <opencv2/imgproc.hpp>
 #endif // HAVE_OPENCV
 
+#include <algorithm>
+#include <array>
+
 #include "rmvl/algorithm/dsp.hpp"
 #include "rmvl/algorithm/math.hpp"
 
@@ -46,133 +49,735 @@ RealSignal Gx(const ComplexSignal &x, GxType type)
     }
 }
 
-#ifdef HAVE_OPENCV
+double jacobsen(std::complex<double> prev, std::complex<double> peak, std::complex<double> next)
+{
+    auto den = 2. * peak - prev - next;
+    if (std::norm(den) == 0)
+        return 0;
+    double delta = std::real((prev - next) / den);
+    return std::clamp(delta, -0.5, 0.5);
+}
 
-cv::Mat draw(const RealSignal &datas, const cv::Scalar &color)
+SlidingDFT::SlidingDFT(std::size_t n, std::size_t first, std::size_t last) : _first(first)
 {
-    cv::Mat img(cv::Size(datas.size() * 2.5, datas.size() * 1.5), CV_8UC3, cv::Scalar(40, 40, 40));
-    int cx{img.cols / 2}, cy{img.rows / 2};
+    if (n == 0)
+        RMVL_Error(RMVL_StsBadArg, "The window size must be greater than 0.");
+    if (first > last || last >= n)
+        RMVL_Error_(RMVL_StsBadArg, "Invalid bin range [%zu, %zu] for the window size %zu.", first, last, n);
+    _buf.assign(n, 0.0);
+    _roots.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+        _roots[i] = std::polar(1.0, 2 * PI * i / n);
+    _bins.assign(last - first + 1, 0.0);
+}
 
-    double max_val = *std::max_element(datas.begin(), datas.end(), [](double lhs, double rhs) { return std::abs(lhs) < std::abs(rhs); });
-    double height_ratio{cy / max_val};
+void SlidingDFT::update(double x)
+{
+    const std::size_t N = _buf.size();
+    double diff = x - _buf[_head];
+    _buf[_head] = x;
+    _head = (_head + 1) % N;
+    _count = std::min(_count + 1, N);
+    if (++_updates >= N)
+        return resync();
+    for (std::size_t i = 0; i < _bins.size(); ++i)
+        _bins[i] = (_bins[i] + diff) * _roots[_first + i];
+}
 
-    cv::line(img, cv::Point(0, cy), cv::Point(img.cols, cy), cv::Scalar(255, 255, 255), 1);
-    cv::line(img, cv::Point(0.2 * cx, 0), cv::Point(0.2 * cx, img.rows), cv::Scalar(255, 255, 255), 1);
-    cv::line(img, cv::Point(0.2 * cx, 0.2 * cy), cv::Point(0.22 * cx, 0.2 * cy), cv::Scalar(255, 255, 255));
-    cv::line(img, cv::Point(0.2 * cx, 1.8 * cy), cv::Point(0.22 * cx, 1.8 * cy), cv::Scalar(255, 255, 255));
-    cv::putText(img, std::to_string(max_val), cv::Point(0.22 * cx, 0.2 * cy), cv::FONT_HERSHEY_COMPLEX, 0.002 * cy, cv::Scalar(255, 255, 255));
-    cv::putText(img, std::to_string(-max_val), cv::Point(0.22 * cx, 1.8 * cy), cv::FONT_HERSHEY_COMPLEX, 0.002 * cy, cv::Scalar(255, 255, 255));
+void SlidingDFT::resync()
+{
+    const std::size_t N = _buf.size();
+    for (std::size_t i = 0; i < _bins.size(); ++i)
+    {
+        std::complex<double> sum{};
+        // 第 m 个采样点的旋转因子 e^{-j2πkm/N} 为第 km mod N 个单位根的共轭
+        for (std::size_t m = 0, idx = 0; m < N; ++m, idx = (idx + _first + i) % N)
+            sum += _buf[(_head + m) % N] * std::conj(_roots[idx]);
+        _bins[i] = sum;
+    }
+    _updates = 0;
+}
 
-    for (std::size_t i = 0; i + 1 < datas.size(); ++i)
-        cv::line(img, cv::Point(cx + 2 * (i - datas.size() / 2), height_ratio * 0.8 * -datas[i] + cy),
-                 cv::Point(cx + 2 * (i + 1 - datas.size() / 2), height_ratio * 0.8 * -datas[i + 1] + cy),
-                 color, 2);
+std::size_t SlidingDFT::peak() const
+{
+    auto it = std::max_element(_bins.begin(), _bins.end(), [](const auto &lhs, const auto &rhs) { return std::norm(lhs) < std::norm(rhs); });
+    return _first + (it - _bins.begin());
+}
 
-    return img;
+double SlidingDFT::frequency(double fs) const
+{
+    std::size_t k = peak();
+    double delta{};
+    if (k > _first && k - _first + 1 < _bins.size())
+        delta = jacobsen(bin(k - 1), bin(k), bin(k + 1));
+    return (k + delta) * fs / _buf.size();
 }
 
-ComplexSignal dft(const ComplexSignal &xt)
+GoertzelBank::GoertzelBank(const std::vector<double> &freqs, std::size_t n) : _n(n)
 {
-    const std::size_t N = xt.size();
-    // std::deque -> cv::Mat
-    cv::Mat input(1, N, CV_64FC2);
-    for (std::size_t i = 0; i < N; ++i)
-        input.at<cv::Vec2d>(0, i) = {xt[i].real(), xt[i].imag()};
-    cv::Mat output;
-    // process
-    cv::dft(input, output, cv::DFT_COMPLEX_OUTPUT);
-    ComplexSignal res(N);
-    for (std::size_t i = 0; i < N; ++i)
-        res[i] = {output.at<cv::Vec2d>(0, i)[0], output.at<cv::Vec2d>(0, i)[1]};
+    if (n == 0)
+        RMVL_Error(RMVL_StsBadArg, "The block size must be greater than 0.");
+    const std::size_t K = freqs.size();
+    _coeff.resize(K);
+    _rotate.resize(K);
+    _correct.resize(K);
+    for (std::size_t i = 0; i < K; ++i)
+    {
+        double omega = 2 * PI * freqs[i];
+        _coeff[i] = 2 * std::cos(omega);
+        _rotate[i] = std::polar(1.0, -omega);
+        _correct[i] = std::polar(1.0, -omega * (n - 1));
+    }
+    _s1.assign(K, 0.0);
+    _s2.assign(K, 0.0);
+    _values.assign(K, 0.0);
+}
 
-    return res;
+bool GoertzelBank::update(double x)
+{
+    for (std::size_t i = 0; i < _coeff.size(); ++i)
+    {
+        double s = x + _coeff[i] * _s1[i] - _s2[i];
+        _s2[i] = _s1[i];
+        _s1[i] = s;
+    }
+    if (++_count < _n)
+        return false;
+    // y[N-1] = s[N-1] - e^{-jω} s[N-2] = e^{jω(N-1)} X(ω)
+    for (std::size_t i = 0; i < _coeff.size(); ++i)
+        _values[i] = _correct[i] * (_s1[i] - _rotate[i] * _s2[i]);
+    std::fill(_s1.begin(), _s1.end(), 0.0);
+    std::fill(_s2.begin(), _s2.end(), 0.0);
+    _count = 0;
+    return true;
 }
 
-ComplexSignal idft(const ComplexSignal &Xf)
+std::size_t GoertzelBank::peak() const
 {
-    const std::size_t N = Xf.size();
-    // std::deque -> cv::Mat
-    cv::Mat input(1, N, CV_64FC2);
-    for (std::size_t i = 0; i < N; ++i)
-        input.at<cv::Vec2d>(0, i) = {Xf[i].real(), Xf[i].imag()};
-    cv::Mat output;
-    // process
-    cv::dft(input, output, cv::DFT_INVERSE | cv::DFT_COMPLEX_OUTPUT);
-    ComplexSignal res(N);
-    for (std::size_t i = 0; i < N; ++i)
-        res[i] = {output.at<cv::Vec2d>(0, i)[0] / N, output.at<cv::Vec2d>(0, i)[1] / N};
+    auto it = std::max_element(_values.begin(), _values.end(), [](const auto &lhs, const auto &rhs) { return std::norm(lhs) < std::norm(rhs); });
+    return it - _values.begin();
+}
 
-    return res;
+//////////////////////////////////// 快速傅里叶变换 ////////////////////////////////////
+
+// Stockham 混合基算法支持的最大素因子，含更大素因子的长度使用 Bluestein 算法
+static constexpr std::size_t MAX_RADIX = 13;
+
+// 复数乘法，不处理 inf 与 NaN，避免 std::complex 乘法的库函数调用
+static inline std::complex<double> cmul(std::complex<double> a, std::complex<double> b)
+{
+    return {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
 }
 
-#else
+FFTPlan::FFTPlan(std::size_t n) : _n(n)
+{
+    if (n == 0)
+        RMVL_Error(RMVL_StsBadArg, "The size of the signal must be greater than 0.");
+    // 2 的幂：位逆序表与旋转因子 W_N^k, k < N/2
+    if ((n & (n - 1)) == 0)
+    {
+        _rev.resize(n);
+        for (std::size_t i = 1, bits = n >> 1; i < n; ++i)
+            _rev[i] = (_rev[i >> 1] >> 1) | ((i & 1) ? bits : 0);
+        _twiddles.resize(n / 2);
+        for (std::size_t k = 0; k < n / 2; ++k)
+            _twiddles[k] = std::polar(1.0, -2 * PI * k / n);
+        return;
+    }
+    // 分解素因子，优先使用基 4
+    std::size_t m = n;
+    for (std::size_t p : {4, 2, 3, 5, 7, 11, 13})
+        for (; m % p == 0; m /= p)
+            _factors.push_back(p);
+    if (m == 1)
+    {
+        // 每一级依次存放 W_{Lp}^{qj}（j < L, q < p）与 W_p^q（q < p）
+        for (std::size_t i = 0, L = 1; i < _factors.size(); L *= _factors[i++])
+        {
+            std::size_t p = _factors[i];
+            for (std::size_t j = 0; j < L; ++j)
+                for (std::size_t q = 0; q < p; ++q)
+                    _twiddles.push_back(std::polar(1.0, -2 * PI * static_cast<double>(q * j) / (L * p)));
+            for (std::size_t q = 0; q < p; ++q)
+                _twiddles.push_back(std::polar(1.0, -2 * PI * q / p));
+        }
+        _work.resize(n);
+        return;
+    }
+    // Bluestein：X_k = c_k Σ (x_t c_t) c*_{k-t}，其中 c_t = e^{-jπt²/N}，卷积使用长度 M >= 2N - 1 的 2 的幂
+    _factors.clear();
+    std::size_t M = 1;
+    while (M < 2 * n - 1)
+        M <<= 1;
+    _sub = std::make_unique<FFTPlan>(M);
+    _chirp.resize(n);
+    for (std::size_t t = 0; t < n; ++t)
+    {
+        // t² 对 2N 取模以避免大数相位的精度损失
+        auto t2 = static_cast<unsigned long long>(t) * t % (2 * n);
+        _chirp[t] = std::polar(1.0, -PI * static_cast<double>(t2) / n);
+    }
+    _kernel.assign(M, 0.0);
+    _kernel[0] = std::conj(_chirp[0]);
+    for (std::size_t t = 1; t < n; ++t)
+        _kernel[t] = _kernel[M - t] = std::conj(_chirp[t]);
+    _sub->transform(_kernel.data());
+    // 预先除以 M，使卷积结果无需再次缩放
+    for (auto &v : _kernel)
+        v /= static_cast<double>(M);
+    _work.resize(M);
+}
 
-using namespace numeric_literals;
+void FFTPlan::radix2(std::complex<double> *data) const
+{
+    const std::size_t N = _n;
+    for (std::size_t i = 0; i < N; ++i)
+        if (i < _rev[i])
+            std::swap(data[i], data[_rev[i]]);
+    for (std::size_t len = 2; len <= N; len <<= 1)
+    {
+        const std::size_t half = len / 2, step = N / len;
+        for (std::size_t i = 0; i < N; i += len)
+            for (std::size_t j = 0; j < half; ++j)
+            {
+                auto u = data[i + j], v = cmul(data[i + j + half], _twiddles[j * step]);
+                data[i + j] = u + v;
+                data[i + j + half] = u - v;
+            }
+    }
+}
 
-/**
- * @brief 快速傅里叶变换递归函数
- *
- * @param[in] xt 离散时域信号
- * @param[in] N 信号长度
- * @return 离散频域信号
+/*
+ * 第 r 个长度为 L 的子序列由 x[r + S·t]（t < L，S = N / L）组成，其 DFT 的第 j 个频点存放于 A[j·S + r]。每一级以基 p
+ * 合并 p 个子序列，新的子序列 r' 由旧的子序列 r' + S'·t₂（t₂ < p，S' = S / p）交错组成，因此
+ *     B[(j + L·q)·S' + r'] = Σ_{t₂} W_p^{t₂q} · W_{Lp}^{t₂j} · A[j·S + S'·t₂ + r']
+ * 最后一级 S = 1，结果按自然顺序排列
  */
-static inline ComplexSignal fftprocess(const ComplexSignal &xt)
+void FFTPlan::stockham(std::complex<double> *data)
 {
-    std::size_t N = xt.size();
-    if (N == 1)
-        return xt;
-    ComplexSignal pe(N / 2), po(N / 2);
-    for (std::size_t i = 0; i < N / 2; ++i)
-        pe[i] = xt[2 * i], po[i] = xt[2 * i + 1];
-    ComplexSignal y(N);
-    auto ye = fftprocess(pe), yo = fftprocess(po);
-    for (std::size_t k = 0; k < N / 2; ++k)
+    std::complex<double> *A = data, *B = _work.data();
+    const std::complex<double> *tw = _twiddles.data();
+    std::array<std::complex<double>, MAX_RADIX> a{};
+    constexpr double SIN_60 = 0.86602540378443864676;
+    for (std::size_t i = 0, L = 1, S = _n; i < _factors.size(); ++i)
     {
-        auto wk_yo = std::polar(1.0, -2_PI / N * k) * yo[k];
-        y[k] = ye[k] + wk_yo, y[k + N / 2] = ye[k] - wk_yo;
+        const std::size_t p = _factors[i], Sp = S / p;
+        const std::complex<double> *roots = tw + L * p;
+        for (std::size_t j = 0; j < L; ++j)
+        {
+            const std::complex<double> *w = tw + j * p;
+            for (std::size_t r = 0; r < Sp; ++r)
+            {
+                const std::complex<double> *src = A + j * S + r;
+                std::complex<double> *dst = B + j * Sp + r;
+                a[0] = src[0];
+                for (std::size_t t = 1; t < p; ++t)
+                    a[t] = cmul(w[t], src[t * Sp]);
+                const std::size_t stride = L * Sp;
+                switch (p)
+                {
+                case 2:
+                    dst[0] = a[0] + a[1];
+                    dst[stride] = a[0] - a[1];
+                    break;
+                case 3: {
+                    auto sum = a[1] + a[2], mid = a[0] - 0.5 * sum;
+                    auto d = a[1] - a[2];
+                    std::complex<double> rot{SIN_60 * d.imag(), -SIN_60 * d.real()}; // -j·sin60°·d
+                    dst[0] = a[0] + sum;
+                    dst[stride] = mid + rot;
+                    dst[2 * stride] = mid - rot;
+                    break;
+                }
+                case 4: {
+                    auto s02 = a[0] + a[2], d02 = a[0] - a[2];
+                    auto s13 = a[1] + a[3], d13 = a[1] - a[3];
+                    std::complex<double> rot{d13.imag(), -d13.real()}; // -j·d13
+                    dst[0] = s02 + s13;
+                    dst[stride] = d02 + rot;
+                    dst[2 * stride] = s02 - s13;
+                    dst[3 * stride] = d02 - rot;
+                    break;
+                }
+                case 5: {
+                    // X_q = a₀ + Σ_{t=1,2} [cos(2πtq/5)(a_t + a_{5-t}) - j·sin(2πtq/5)(a_t - a_{5-t})]
+                    constexpr double C1 = 0.30901699437494742410, C2 = -0.80901699437494742410;
+                    constexpr double S1 = 0.95105651629515357212, S2 = 0.58778525229247312917;
+                    auto s14 = a[1] + a[4], d14 = a[1] - a[4];
+                    auto s23 = a[2] + a[3], d23 = a[2] - a[3];
+                    auto m1 = a[0] + C1 * s14 + C2 * s23, m2 = a[0] + C2 * s14 + C1 * s23;
+                    auto n1 = S1 * d14 + S2 * d23, n2 = S2 * d14 - S1 * d23;
+                    std::complex<double> r1{n1.imag(), -n1.real()}, r2{n2.imag(), -n2.real()}; // -j·n
+                    dst[0] = a[0] + s14 + s23;
+                    dst[stride] = m1 + r1;
+                    dst[2 * stride] = m2 + r2;
+                    dst[3 * stride] = m2 - r2;
+                    dst[4 * stride] = m1 - r1;
+                    break;
+                }
+                default:
+                    for (std::size_t q = 0; q < p; ++q)
+                    {
+                        std::complex<double> sum = a[0];
+                        for (std::size_t t = 1, idx = q; t < p; ++t)
+                        {
+                            sum += cmul(a[t], roots[idx]);
+                            idx += q;
+                            if (idx >= p)
+                                idx -= p;
+                        }
+                        dst[q * stride] = sum;
+                    }
+                    break;
+                }
+            }
+        }
+        tw = roots + p;
+        std::swap(A, B);
+        L *= p;
+        S = Sp;
     }
+    if (A != data)
+        std::copy(A, A + _n, data);
+}
 
-    return y;
+void FFTPlan::bluestein(std::complex<double> *data)
+{
+    const std::size_t M = _work.size();
+    for (std::size_t t = 0; t < _n; ++t)
+        _work[t] = cmul(data[t], _chirp[t]);
+    std::fill(_work.begin() + _n, _work.end(), 0.0);
+    _sub->transform(_work.data());
+    // 频域相乘后，利用 IDFT(X) = conj(DFT(conj(X))) 完成逆变换
+    for (std::size_t k = 0; k < M; ++k)
+        _work[k] = std::conj(cmul(_work[k], _kernel[k]));
+    _sub->transform(_work.data());
+    for (std::size_t k = 0; k < _n; ++k)
+        data[k] = cmul(_chirp[k], std::conj(_work[k]));
+}
+
+void FFTPlan::transform(std::complex<double> *data)
+{
+    if (!_rev.empty())
+        radix2(data);
+    else if (!_factors.empty())
+        stockham(data);
+    else if (_sub != nullptr)
+        bluestein(data);
+}
+
+void FFTPlan::forward(const std::complex<double> *xt, std::complex<double> *Xf)
+{
+    if (xt != Xf)
+        std::copy(xt, xt + _n, Xf);
+    transform(Xf);
+}
+
+void FFTPlan::inverse(const std::complex<double> *Xf, std::complex<double> *xt)
+{
+    // IDFT(X) = conj(DFT(conj(X))) / N
+    for (std::size_t i = 0; i < _n; ++i)
+        xt[i] = std::conj(Xf[i]);
+    transform(xt);
+    const double scale = 1.0 / _n;
+    for (std::size_t i = 0; i < _n; ++i)
+        xt[i] = std::conj(xt[i]) * scale;
 }
 
-static inline ComplexSignal ifftprocess(const ComplexSignal &Xf)
+void FFTPlan::forwardReal(const double *xt, std::complex<double> *Xf)
 {
-    std::size_t N = Xf.size();
-    if (N == 1)
-        return Xf;
-    ComplexSignal pe(N / 2), po(N / 2);
-    for (std::size_t i = 0; i < N / 2; ++i)
-        pe[i] = Xf[2 * i], po[i] = Xf[2 * i + 1];
-    ComplexSignal y(N);
-    auto ye = ifftprocess(pe), yo = ifftprocess(po);
-    for (std::size_t k = 0; k < N / 2; ++k)
+    if (_n == 1)
     {
-        auto wk_yo = std::polar(1.0, 2_PI / N * k) * yo[k];
-        y[k] = ye[k] + wk_yo, y[k + N / 2] = ye[k] - wk_yo;
+        Xf[0] = xt[0];
+        return;
     }
+    // 奇数长度按照复信号计算
+    if (_n % 2 == 1)
+    {
+        _buf.resize(_n);
+        std::copy(xt, xt + _n, _buf.begin());
+        transform(_buf.data());
+        std::copy(_buf.begin(), _buf.begin() + _n / 2 + 1, Xf);
+        return;
+    }
+    // 偶数长度：z_t = x_{2t} + j·x_{2t+1}，由长度为 N/2 的 Z 分离出偶、奇序列的频谱
+    //     E_k = (Z_k + Z*_{N/2-k}) / 2,  O_k = (Z_k - Z*_{N/2-k}) / 2j,  X_k = E_k + W_N^k O_k
+    const std::size_t h = _n / 2;
+    if (_half == nullptr)
+    {
+        _half = std::make_unique<FFTPlan>(h);
+        _real_tw.resize(h);
+        for (std::size_t k = 0; k < h; ++k)
+            _real_tw[k] = std::polar(1.0, -2 * PI * k / _n);
+    }
+    for (std::size_t t = 0; t < h; ++t)
+        Xf[t] = {xt[2 * t], xt[2 * t + 1]};
+    _half->transform(Xf);
+    auto z0 = Xf[0];
+    Xf[0] = z0.real() + z0.imag();
+    Xf[h] = z0.real() - z0.imag();
+    for (std::size_t k = 1; k <= h / 2; ++k)
+    {
+        const std::size_t m = h - k;
+        auto zk = Xf[k], zm = Xf[m];
+        auto ek = 0.5 * (zk + std::conj(zm)), ok = std::complex<double>(0, -0.5) * (zk - std::conj(zm));
+        auto em = 0.5 * (zm + std::conj(zk)), om = std::complex<double>(0, -0.5) * (zm - std::conj(zk));
+        Xf[k] = ek + cmul(_real_tw[k], ok);
+        Xf[m] = em + cmul(_real_tw[m], om);
+    }
+}
 
-    return y;
+//! 当前线程缓存的 FFTPlan
+static FFTPlan &cachedPlan(std::size_t n)
+{
+    thread_local std::unique_ptr<FFTPlan> plan;
+    if (plan == nullptr || plan->size() != n)
+        plan = std::make_unique<FFTPlan>(n);
+    return *plan;
 }
 
+void dft(const std::complex<double> *xt, std::size_t n, std::complex<double> *Xf) { cachedPlan(n).forward(xt, Xf); }
+
+void idft(const std::complex<double> *Xf, std::size_t n, std::complex<double> *xt) { cachedPlan(n).inverse(Xf, xt); }
+
 ComplexSignal dft(const ComplexSignal &xt)
 {
-    std::size_t N = xt.size();
-    if (std::log2(N) != std::floor(std::log2(N)))
-        RMVL_Error(RMVL_StsBadArg, "The size of the signal must be a power of 2.");
-    return fftprocess(xt);
+    std::vector<std::complex<double>> buf(xt.begin(), xt.end());
+    dft(buf.data(), buf.size(), buf.data());
+    return ComplexSignal(buf.begin(), buf.end());
 }
 
 ComplexSignal idft(const ComplexSignal &Xf)
 {
-    std::size_t N = Xf.size();
-    if (std::log2(N) != std::floor(std::log2(N)))
-        RMVL_Error(RMVL_StsBadArg, "The size of the signal must be a power of 2.");
-    auto x = ifftprocess(Xf);
-    for (auto &xi : x)
-        xi /= static_cast<double>(N);
+    std::vector<std::complex<double>> buf(Xf.begin(), Xf.end());
+    idft(buf.data(), buf.size(), buf.data());
+    return ComplexSignal(buf.begin(), buf.end());
+}
+
+//////////////////////////////////// 流式滤波器 ////////////////////////////////////
+
+// 频率 f 处的 z⁻¹ = e^{-j2πf}
+static inline std::complex<double> zinv(double f) { return std::polar(1.0, -2 * PI * f); }
+
+Biquad Biquad::lowpass(double fc, double q)
+{
+    if (fc <= 0 || fc >= 0.5)
+        RMVL_Error_(RMVL_StsBadArg, "The cutoff frequency (%g) must be in (0, 0.5).", fc);
+    double w0 = 2 * PI * fc, c = std::cos(w0), alpha = std::sin(w0) / (2 * q);
+    double a0 = 1 + alpha;
+    return {(1 - c) / 2 / a0, (1 - c) / a0, (1 - c) / 2 / a0, -2 * c / a0, (1 - alpha) / a0};
+}
+
+Biquad Biquad::notch(double f0, double q)
+{
+    if (f0 <= 0 || f0 >= 0.5)
+        RMVL_Error_(RMVL_StsBadArg, "The notch frequency (%g) must be in (0, 0.5).", f0);
+    double w0 = 2 * PI * f0, c = std::cos(w0), alpha = std::sin(w0) / (2 * q);
+    double a0 = 1 + alpha;
+    return {1 / a0, -2 * c / a0, 1 / a0, -2 * c / a0, (1 - alpha) / a0};
+}
+
+std::complex<double> Biquad::response(double f) const
+{
+    auto z1 = zinv(f), z2 = z1 * z1;
+    return (b0 + b1 * z1 + b2 * z2) / (1.0 + a1 * z1 + a2 * z2);
+}
+
+BiquadCascade::BiquadCascade(std::vector<Biquad> sections) : _sections(std::move(sections))
+{
+    _z1.assign(_sections.size(), 0);
+    _z2.assign(_sections.size(), 0);
+}
+
+BiquadCascade BiquadCascade::butterworth(std::size_t order, double fc)
+{
+    if (order == 0)
+        RMVL_Error(RMVL_StsBadArg, "The order of the filter must be greater than 0.");
+    if (fc <= 0 || fc >= 0.5)
+        RMVL_Error_(RMVL_StsBadArg, "The cutoff frequency (%g) must be in (0, 0.5).", fc);
+    std::vector<Biquad> sections;
+    sections.reserve((order + 1) / 2);
+    // 模拟原型的共轭极点对 s² + s/Q + 1，Q = 1 / (2sin(π(2k+1)/(2N)))
+    for (std::size_t k = 0; k < order / 2; ++k)
+        sections.push_back(Biquad::lowpass(fc, 1 / (2 * std::sin(PI * (2 * k + 1) / (2 * order)))));
+    // 奇数阶时的实极点 s = -1，双线性变换后为一阶节
+    if (order % 2 == 1)
+    {
+        double K = std::tan(PI * fc);
+        sections.push_back({K / (K + 1), K / (K + 1), 0, (K - 1) / (K + 1), 0});
+    }
+    return BiquadCascade(std::move(sections));
+}
+
+double BiquadCascade::update(double x)
+{
+    // 转置直接 II 型
+    for (std::size_t i = 0; i < _sections.size(); ++i)
+    {
+        const auto &sec = _sections[i];
+        double y = sec.b0 * x + _z1[i];
+        _z1[i] = sec.b1 * x - sec.a1 * y + _z2[i];
+        _z2[i] = sec.b2 * x - sec.a2 * y;
+        x = y;
+    }
     return x;
 }
 
+void BiquadCascade::process(const double *in, double *out, std::size_t n)
+{
+    if (_sections.empty())
+    {
+        if (in != out)
+            std::copy(in, in + n, out);
+        return;
+    }
+    // 逐节处理整段信号，状态保存在寄存器中
+    for (std::size_t i = 0; i < _sections.size(); ++i)
+    {
+        const auto &sec = _sections[i];
+        const double *src = i == 0 ? in : out;
+        double z1 = _z1[i], z2 = _z2[i];
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            double x = src[k];
+            double y = sec.b0 * x + z1;
+            z1 = sec.b1 * x - sec.a1 * y + z2;
+            z2 = sec.b2 * x - sec.a2 * y;
+            out[k] = y;
+        }
+        _z1[i] = z1, _z2[i] = z2;
+    }
+}
+
+void BiquadCascade::reset(double x)
+{
+    for (std::size_t i = 0; i < _sections.size(); ++i)
+    {
+        const auto &sec = _sections[i];
+        // 恒定输入下的稳态输出为直流增益与输入之积
+        double y = x * (sec.b0 + sec.b1 + sec.b2) / (1 + sec.a1 + sec.a2);
+        _z2[i] = sec.b2 * x - sec.a2 * y;
+        _z1[i] = y - sec.b0 * x;
+        x = y;
+    }
+}
+
+std::complex<double> BiquadCascade::response(double f) const
+{
+    std::complex<double> h{1};
+    for (const auto &sec : _sections)
+        h *= sec.response(f);
+    return h;
+}
+
+FIRFilter::FIRFilter(std::vector<double> taps) : _taps(std::move(taps))
+{
+    if (_taps.empty())
+        RMVL_Error(RMVL_StsBadArg, "The taps of the FIR filter are empty.");
+    _rtaps.assign(_taps.rbegin(), _taps.rend());
+    _buf.assign(2 * _taps.size(), 0);
+}
+
+FIRFilter FIRFilter::movingAverage(std::size_t n)
+{
+    if (n == 0)
+        RMVL_Error(RMVL_StsBadArg, "The window size must be greater than 0.");
+    return FIRFilter(std::vector<double>(n, 1.0 / n));
+}
+
+FIRFilter FIRFilter::lowpass(std::size_t n, double fc)
+{
+    if (n == 0)
+        RMVL_Error(RMVL_StsBadArg, "The number of taps must be greater than 0.");
+    if (fc <= 0 || fc >= 0.5)
+        RMVL_Error_(RMVL_StsBadArg, "The cutoff frequency (%g) must be in (0, 0.5).", fc);
+    std::vector<double> taps(n, 1.0);
+    double center = (n - 1) / 2.0, sum{};
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double t = i - center;
+        double sinc = t == 0 ? 2 * fc : std::sin(2 * PI * fc * t) / (PI * t);
+        double window = n == 1 ? 1 : 0.54 - 0.46 * std::cos(2 * PI * i / (n - 1));
+        taps[i] = sinc * window;
+        sum += taps[i];
+    }
+    for (auto &h : taps)
+        h /= sum;
+    return FIRFilter(std::move(taps));
+}
+
+FIRFilter FIRFilter::savitzkyGolay(std::size_t window, std::size_t order, std::size_t deriv, double dt, std::size_t lag)
+{
+    if (window <= order)
+        RMVL_Error_(RMVL_StsBadArg, "The window size (%zu) must be greater than the polynomial order (%zu).", window, order);
+    if (deriv > order)
+        RMVL_Error_(RMVL_StsBadArg, "The derivative order (%zu) must not exceed the polynomial order (%zu).", deriv, order);
+    if (lag >= window)
+        RMVL_Error_(RMVL_StsBadArg, "The lag (%zu) must be less than the window size (%zu).", lag, window);
+    if (dt <= 0)
+        RMVL_Error(RMVL_StsBadArg, "The sampling interval must be greater than 0.");
+    // 窗口内第 j 个采样点（由旧到新）相对于求值点的时间 τ_j = j - (window - 1 - lag)，设计矩阵 A_jk = τ_j^k
+    const std::size_t M = order + 1;
+    std::vector<double> A(window * M);
+    for (std::size_t j = 0; j < window; ++j)
+    {
+        double tau = static_cast<double>(j) - static_cast<double>(window - 1 - lag), p = 1;
+        for (std::size_t k = 0; k < M; ++k, p *= tau)
+            A[j * M + k] = p;
+    }
+    // 多项式系数 c = (AᵀA)⁻¹Aᵀy，求值点处的 deriv 阶导数为 deriv!·c_deriv，由 (AᵀA)v = e_deriv 得到 (AᵀA)⁻¹ 的第 deriv 行
+    std::vector<double> G(M * M), v(M);
+    for (std::size_t r = 0; r < M; ++r)
+        for (std::size_t c = 0; c < M; ++c)
+            for (std::size_t j = 0; j < window; ++j)
+                G[r * M + c] += A[j * M + r] * A[j * M + c];
+    v[deriv] = 1;
+    // 列主元 Gauss 消元
+    for (std::size_t c = 0; c < M; ++c)
+    {
+        std::size_t piv = c;
+        for (std::size_t r = c + 1; r < M; ++r)
+            if (std::abs(G[r * M + c]) > std::abs(G[piv * M + c]))
+                piv = r;
+        for (std::size_t k = 0; k < M; ++k)
+            std::swap(G[c * M + k], G[piv * M + k]);
+        std::swap(v[c], v[piv]);
+        for (std::size_t r = c + 1; r < M; ++r)
+        {
+            double ratio = G[r * M + c] / G[c * M + c];
+            for (std::size_t k = c; k < M; ++k)
+                G[r * M + k] -= ratio * G[c * M + k];
+            v[r] -= ratio * v[c];
+        }
+    }
+    for (std::size_t c = M; c-- > 0;)
+    {
+        for (std::size_t k = c + 1; k < M; ++k)
+            v[c] -= G[c * M + k] * v[k];
+        v[c] /= G[c * M + c];
+    }
+    double scale = 1;
+    for (std::size_t k = 2; k <= deriv; ++k)
+        scale *= k;
+    scale /= std::pow(dt, static_cast<double>(deriv));
+    // 第 i 个系数对应第 i 个最新的采样点，即窗口内的第 window - 1 - i 个采样点
+    std::vector<double> taps(window);
+    for (std::size_t i = 0; i < window; ++i)
+    {
+        const double *a = A.data() + (window - 1 - i) * M;
+        double w{};
+        for (std::size_t k = 0; k < M; ++k)
+            w += a[k] * v[k];
+        taps[i] = scale * w;
+    }
+    return FIRFilter(std::move(taps));
+}
+
+// 使用 8 个相互独立的累加器计算内积，便于编译器打包为 SIMD 指令
+static inline double dot(const double *a, const double *b, std::size_t n)
+{
+    double s0{}, s1{}, s2{}, s3{}, s4{}, s5{}, s6{}, s7{};
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        s0 += a[i] * b[i];
+        s1 += a[i + 1] * b[i + 1];
+        s2 += a[i + 2] * b[i + 2];
+        s3 += a[i + 3] * b[i + 3];
+        s4 += a[i + 4] * b[i + 4];
+        s5 += a[i + 5] * b[i + 5];
+        s6 += a[i + 6] * b[i + 6];
+        s7 += a[i + 7] * b[i + 7];
+    }
+    for (; i < n; ++i)
+        s0 += a[i] * b[i];
+    return ((s0 + s1) + (s2 + s3)) + ((s4 + s5) + (s6 + s7));
+}
+
+double FIRFilter::update(double x)
+{
+    const std::size_t N = _taps.size();
+    if (N == 0)
+        return x;
+    // 首个采样点填满窗口
+    if (_count++ == 0)
+    {
+        std::fill(_buf.begin(), _buf.end(), x);
+        _head = 0;
+    }
+    // 上一个窗口中除最早的采样点外的 N - 1 个采样点由旧到新连续存放于 _buf[_head + 1, _head + N)，与新的采样点组成当前窗口
+    double y = dot(_buf.data() + _head + 1, _rtaps.data(), N - 1) + _rtaps[N - 1] * x;
+    _buf[_head] = _buf[_head + N] = x;
+    _head = _head + 1 == N ? 0 : _head + 1;
+    return y;
+}
+
+void FIRFilter::process(const double *in, double *out, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = update(in[i]);
+}
+
+std::complex<double> FIRFilter::response(double f) const
+{
+    std::complex<double> h{}, z{1}, z1 = zinv(f);
+    for (auto tap : _taps)
+        h += tap * z, z *= z1;
+    return h;
+}
+
+double OneEuroFilter::update(double x, double t)
+{
+    if (!_initialized)
+    {
+        _initialized = true;
+        _x = _raw = x, _dx = 0, _t = t;
+        return x;
+    }
+    double dt = t - _t;
+    if (dt <= 0)
+        return _x;
+    _t = t;
+    // 一阶低通的平滑系数 α = dt / (dt + τ)，τ = 1 / (2πf_c)
+    auto alpha = [dt](double cutoff) { return dt / (dt + 1 / (2 * PI * cutoff)); };
+    // 变化率由相邻两个输入采样点的差分经低通滤波得到
+    _dx += alpha(_d_cutoff) * ((x - _raw) / dt - _dx);
+    _raw = x;
+    _x += alpha(_min_cutoff + _beta * std::abs(_dx)) * (x - _x);
+    return _x;
+}
+
+void OneEuroFilter::process(const double *in, const double *ts, double *out, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = update(in[i], ts[i]);
+}
+
+#ifdef HAVE_OPENCV
+
+cv::Mat draw(const RealSignal &datas, const cv::Scalar &color)
+{
+    cv::Mat img(cv::Size(datas.size() * 2.5, datas.size() * 1.5), CV_8UC3, cv::Scalar(40, 40, 40));
+    int cx{img.cols / 2}, cy{img.rows / 2};
+
+    double max_val = *std::max_element(datas.begin(), datas.end(), [](double lhs, double rhs) { return std::abs(lhs) < std::abs(rhs); });
+    double height_ratio{cy / max_val};
+
+    cv::line(img, cv::Point(0, cy), cv::Point(img.cols, cy), cv::Scalar(255, 255, 255), 1);
+    cv::line(img, cv::Point(0.2 * cx, 0), cv::Point(0.2 * cx, img.rows), cv::Scalar(255, 255, 255), 1);
+    cv::line(img, cv::Point(0.2 * cx, 0.2 * cy), cv::Point(0.22 * cx, 0.2 * cy), cv::Scalar(255, 255, 255));
+    cv::line(img, cv::Point(0.2 * cx, 1.8 * cy), cv::Point(0.22 * cx, 1.8 * cy), cv::Scalar(255, 255, 255));
+    cv::putText(img, std::to_string(max_val), cv::Point(0.22 * cx, 0.2 * cy), cv::FONT_HERSHEY_COMPLEX, 0.002 * cy, cv::Scalar(255, 255, 255));
+    cv::putText(img, std::to_string(-max_val), cv::Point(0.22 * cx, 1.8 * cy), cv::FONT_HERSHEY_COMPLEX, 0.002 * cy, cv::Scalar(255, 255, 255));
+
+    for (std::size_t i = 0; i + 1 < datas.size(); ++i)
+        cv::line(img, cv::Point(cx + 2 * (i - datas.size() / 2), height_ratio * 0.8 * -datas[i] + cy),
+                 cv::Point(cx + 2 * (i + 1 - datas.size() / 2), height_ratio * 0.8 * -datas[i + 1] + cy),
+                 color, 2);
+
+    return img;
+}
+
 #endif // HAVE_OPENCV
 
 } // namespace rm
@@ -29,6 +29,34 @@ double Polynomial::operator()(double x) const noexcept
     return y;
 }
 
+std::vector<double> Polynomial::eval(const std::vector<double> &xs) const
+{
+    std::vector<double> ys(xs.size());
+    eval(xs.data(), ys.data(), xs.size());
+    return ys;
+}
+
+void Polynomial::eval(const double *xs, double *ys, std::size_t n) const noexcept
+{
+    // 每组 8 个点，组内各点的 Horner 迭代相互独立，可映射至 SIMD 寄存器的各个通道
+    constexpr std::size_t lanes = 8;
+    const std::size_t deg = _coeffs.size() - 1;
+    std::size_t i = 0;
+    for (; i + lanes <= n; i += lanes)
+    {
+        double y[lanes], x[lanes];
+        for (std::size_t l = 0; l < lanes; ++l)
+            x[l] = xs[i + l], y[l] = _coeffs[deg];
+        for (std::size_t k = deg; k-- > 0;)
+            for (std::size_t l = 0; l < lanes; ++l)
+                y[l] = y[l] * x[l] + _coeffs[k];
+        for (std::size_t l = 0; l < lanes; ++l)
+            ys[i + l] = y[l];
+    }
+    for (; i < n; ++i)
+        ys[i] = (*this)(xs[i]);
+}
+
 ///////////////////// 函数插值 /////////////////////
 
 Interpolator::Interpolator(const std::vector<double> &xs, const std::vector<double> &ys)
@@ -61,6 +89,18 @@ Interpolator &Interpolator::add(double x, double y)
     return *this;
 }
 
+Interpolator &Interpolator::pop()
+{
+    if (_xs.empty())
+        RMVL_Error(RMVL_StsBadSize, "The interpolator is empty");
+    // 以 x1 起始的 k 阶差商即为原差商表中第 k + 1 行的 k 阶差商
+    _xs.erase(_xs.begin());
+    _diffquot.erase(_diffquot.begin());
+    for (auto &row : _diffquot)
+        row.pop_back();
+    return *this;
+}
+
 double Interpolator::operator()(double x) const
 {
     double y{};
@@ -136,6 +176,197 @@ double CurveFitter::operator()(double) const
 
 #endif // HAVE_OPENCV
 
+SlidingCurveFitter::SlidingCurveFitter(std::size_t window, std::bitset<8> order) : _window(window)
+{
+    if (order.none())
+        RMVL_Error(RMVL_StsBadArg, "\"order\" must contain at least one 1.");
+    if (order.count() > window)
+        RMVL_Error(RMVL_StsBadArg, "The number of 1 in \"order\" must be less than or equal to the window size.");
+    for (std::size_t i = 0; i < order.size(); i++)
+        if (order.test(i))
+            _idx.push_back(i);
+    const std::size_t m = _idx.size();
+    _r.assign(m * m, 0.0);
+    _z.assign(m, 0.0);
+    _buf.assign(3 * m, 0.0);
+    _coeffs.assign(m, 0.0);
+}
+
+void SlidingCurveFitter::basis(double x, double *phi) const noexcept
+{
+    double p{1.0};
+    std::size_t k{};
+    for (std::size_t i = 0; i < _idx.size(); ++i)
+    {
+        for (; k < _idx[i]; ++k)
+            p *= x;
+        phi[i] = p;
+    }
+}
+
+/**
+ * @brief 使用 Givens 旋转将新的一行 \f$[\pmb a^T\quad y]\f$ 合并至上三角因子
+ *
+ * @param[in] m 拟合项数
+ * @param[in,out] r 上三角因子 \f$R\f$，按行存储
+ * @param[in,out] z \f$Q^T\pmb y\f$
+ * @param[in,out] a 新样本的基函数值，调用后被消为 `0`
+ * @param[in] y 新样本的 y 坐标
+ */
+static void givensUpdate(std::size_t m, double *r, double *z, double *a, double y)
+{
+    for (std::size_t k = 0; k < m; ++k)
+    {
+        double *rk = r + k * m;
+        double h = std::hypot(rk[k], a[k]);
+        if (h == 0)
+            continue;
+        double c = rk[k] / h, s = a[k] / h;
+        rk[k] = h;
+        for (std::size_t j = k + 1; j < m; ++j)
+        {
+            double t = c * rk[j] + s * a[j];
+            a[j] = c * a[j] - s * rk[j];
+            rk[j] = t;
+        }
+        double t = c * z[k] + s * y;
+        y = c * y - s * z[k];
+        z[k] = t;
+    }
+}
+
+/**
+ * @brief 从上三角因子中移除一行 \f$[\pmb a^T\quad y]\f$，即 LINPACK `dchdd` 算法
+ *
+ * @param[in] m 拟合项数
+ * @param[in,out] r 上三角因子 \f$R\f$，按行存储
+ * @param[in,out] z \f$Q^T\pmb y\f$
+ * @param[in] a 待移除样本的基函数值
+ * @param[in] y 待移除样本的 y 坐标
+ * @param[in] buf 长度为 `2m` 的临时缓冲区
+ * @return 是否移除成功，移除后 \f$R^TR\f$ 不再正定时返回 `false`，此时 `r` 与 `z` 未被修改
+ */
+static bool givensDowndate(std::size_t m, double *r, double *z, const double *a, double y, double *buf)
+{
+    double *s = buf, *c = buf + m;
+    // 求解 R^T s = a
+    double norm2{};
+    for (std::size_t j = 0; j < m; ++j)
+    {
+        double t = a[j];
+        for (std::size_t i = 0; i < j; ++i)
+            t -= r[i * m + j] * s[i];
+        if (r[j * m + j] == 0)
+            return false;
+        s[j] = t / r[j * m + j];
+        norm2 += s[j] * s[j];
+    }
+    if (norm2 >= 1)
+        return false;
+    // 确定旋转变换
+    double alpha = std::sqrt(1 - norm2);
+    for (std::size_t i = m; i-- > 0;)
+    {
+        double scale = alpha + std::abs(s[i]);
+        double p = alpha / scale, q = s[i] / scale, h = std::hypot(p, q);
+        c[i] = p / h;
+        s[i] = q / h;
+        alpha = scale * h;
+    }
+    // 作用于 R
+    for (std::size_t j = 0; j < m; ++j)
+    {
+        double xx{};
+        for (std::size_t i = j + 1; i-- > 0;)
+        {
+            double t = c[i] * xx + s[i] * r[i * m + j];
+            r[i * m + j] = c[i] * r[i * m + j] - s[i] * xx;
+            xx = t;
+        }
+    }
+    // 作用于 Q^T y
+    double zeta = y;
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        z[i] = (z[i] - s[i] * zeta) / c[i];
+        zeta = c[i] * zeta - s[i] * z[i];
+    }
+    return true;
+}
+
+void SlidingCurveFitter::refactor()
+{
+    const std::size_t m = _idx.size();
+    std::fill(_r.begin(), _r.end(), 0.0);
+    std::fill(_z.begin(), _z.end(), 0.0);
+    for (std::size_t k = 0; k < _xs.size(); ++k)
+    {
+        basis(_xs[k], _buf.data());
+        givensUpdate(m, _r.data(), _z.data(), _buf.data(), _ys[k]);
+    }
+    _downdates = 0;
+}
+
+SlidingCurveFitter &SlidingCurveFitter::add(double x, double y)
+{
+    _xs.push_back(x);
+    _ys.push_back(y);
+    basis(x, _buf.data());
+    givensUpdate(_idx.size(), _r.data(), _z.data(), _buf.data(), y);
+    _dirty = true;
+    if (_xs.size() > _window)
+        pop();
+    return *this;
+}
+
+SlidingCurveFitter &SlidingCurveFitter::pop()
+{
+    if (_xs.empty())
+        RMVL_Error(RMVL_StsBadSize, "The curve fitter is empty");
+    const std::size_t m = _idx.size();
+    double x = _xs.front(), y = _ys.front();
+    _xs.pop_front();
+    _ys.pop_front();
+    _dirty = true;
+    // 样本数少于拟合项数时 R 奇异，无法降秩更新，此时样本很少，直接重新分解
+    if (_xs.size() < m || ++_downdates >= _window)
+        return refactor(), *this;
+    basis(x, _buf.data());
+    if (!givensDowndate(m, _r.data(), _z.data(), _buf.data(), y, _buf.data() + m))
+        refactor();
+    return *this;
+}
+
+double SlidingCurveFitter::operator()(double x) const
+{
+    const std::size_t m = _idx.size();
+    if (_xs.size() < m)
+        RMVL_Error_(RMVL_StsBadSize, "The number of samples (%zu) must be greater than or equal to the number of coefficients (%zu)", _xs.size(), m);
+    if (_dirty)
+    {
+        // 回代求解 R c = Q^T y
+        for (std::size_t i = m; i-- > 0;)
+        {
+            double t = _z[i];
+            for (std::size_t j = i + 1; j < m; ++j)
+                t -= _r[i * m + j] * _coeffs[j];
+            if (_r[i * m + i] == 0)
+                RMVL_Error(RMVL_StsDivByZero, "The samples are degenerate, coefficients can not be solved");
+            _coeffs[i] = t / _r[i * m + i];
+        }
+        _dirty = false;
+    }
+    double retval{}, p{1.0};
+    std::size_t k{};
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        for (; k < _idx[i]; ++k)
+            p *= x;
+        retval += _coeffs[i] * p;
+    }
+    return retval;
+}
+
 double NonlinearSolver::operator()(double x0, double eps, std::size_t max_iter) const
 {
     double xk{x0};
@@ -174,9 +405,9 @@ RungeKutta::RungeKutta(
  * @param[in] lambda Butcher 表 λ 向量
  * @param[in] fs 一阶常微分方程组的函数对象
  * @param[in] h 步长
- * @param[in out] t 初始位置的自变量
- * @param[in out] x 初始位置的因变量
- * @param[in out] ks 加权平均系数 k
+ * @param[in,out] t 初始位置的自变量
+ * @param[in,out] x 初始位置的因变量
+ * @param[in,out] ks 加权平均系数 k
  */
 static inline void calcRK(const std::vector<std::vector<double>> &r, const std::vector<double> &p,
                           const std::vector<double> &lambda, const Odes &fs, const double h,
@@ -9,7 +9,13 @@
  *
  */
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <numeric>
+#include <thread>
 
 #ifdef HAVE_OPENCV
 #include <opencv2/core.hpp>
@@ -23,6 +29,146 @@
 namespace rm
 {
 
+//! 并行计算可用的线程数
+static inline std::size_t parallelWorkers()
+{
+#ifdef HAVE_OPENCV
+    return static_cast<std::size_t>(std::max(cv::getNumThreads(), 1));
+#else
+    return std::max(std::thread::hardware_concurrency(), 1u);
+#endif // HAVE_OPENCV
+}
+
+#ifndef HAVE_OPENCV
+
+/**
+ * @brief 并行计算使用的常驻线程池，首次使用时创建，避免每次并行计算时创建、销毁线程
+ * @note 同一时刻仅执行一个任务，任务执行期间的其余调用（包括任务中嵌套的调用）退化为串行执行
+ */
+class ParallelPool
+{
+public:
+    //! 任务函数，参数为任务上下文与任务下标
+    using Task = void (*)(void *, std::size_t);
+
+    //! 获取全局线程池
+    static ParallelPool &instance()
+    {
+        static ParallelPool pool(parallelWorkers() - 1);
+        return pool;
+    }
+
+    /**
+     * @brief 使用调用线程与全部工作线程执行 `n` 个任务
+     *
+     * @param[in] n 任务数
+     * @param[in] task 任务函数
+     * @param[in] ctx 任务上下文
+     * @return 线程池正忙时不执行任何任务并返回 `false`
+     */
+    bool run(std::size_t n, Task task, void *ctx)
+    {
+        if (_busy.exchange(true))
+            return false;
+        {
+            std::lock_guard lk(_mtx);
+            _n = n, _task = task, _ctx = ctx, _next = 0;
+            _active = _threads.size();
+            ++_generation;
+        }
+        _start.notify_all();
+        work();
+        std::unique_lock lk(_mtx);
+        _done.wait(lk, [this] { return _active == 0; });
+        _busy = false;
+        return true;
+    }
+
+    ~ParallelPool()
+    {
+        {
+            std::lock_guard lk(_mtx);
+            _stop = true;
+        }
+        _start.notify_all();
+        for (auto &t : _threads)
+            t.join();
+    }
+
+private:
+    explicit ParallelPool(std::size_t nthreads)
+    {
+        _threads.reserve(nthreads);
+        for (std::size_t i = 0; i < nthreads; ++i)
+            _threads.emplace_back([this] { loop(); });
+    }
+
+    //! 领取并执行任务，直至全部任务被领取
+    void work()
+    {
+        for (std::size_t i = _next++; i < _n; i = _next++)
+            _task(_ctx, i);
+    }
+
+    //! 工作线程主循环
+    void loop()
+    {
+        std::size_t generation{};
+        std::unique_lock lk(_mtx);
+        while (true)
+        {
+            _start.wait(lk, [&] { return _stop || _generation != generation; });
+            if (_stop)
+                return;
+            generation = _generation;
+            lk.unlock();
+            work();
+            lk.lock();
+            if (--_active == 0)
+                _done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> _threads;      //!< 工作线程
+    std::mutex _mtx;                        //!< 保护任务参数与线程状态
+    std::condition_variable _start, _done;  //!< 任务开始、任务完成通知
+    std::atomic_bool _busy{};               //!< 是否正在执行任务
+    bool _stop{};                           //!< 是否停止工作线程
+    std::size_t _generation{};              //!< 任务序号
+    std::size_t _active{};                  //!< 尚未完成当前任务的工作线程数
+    std::size_t _n{};                       //!< 任务数
+    Task _task{};                           //!< 任务函数
+    void *_ctx{};                           //!< 任务上下文
+    std::atomic_size_t _next{};             //!< 下一个待领取的任务下标
+};
+
+#endif // HAVE_OPENCV
+
+/**
+ * @brief 并行执行 `n` 个相互独立的任务，每个任务仅写入各自的结果，因此结果与串行执行完全一致
+ * @note 使用 OpenCV 时使用 `cv::parallel_for_` 的共享线程池，否则使用常驻的 `ParallelPool`
+ *
+ * @param[in] n 任务数
+ * @param[in] fn 任务函数，参数为任务下标，不应抛出异常
+ */
+template <typename Fn>
+static void parallelFor(std::size_t n, Fn &&fn)
+{
+#ifdef HAVE_OPENCV
+    cv::parallel_for_(cv::Range(0, static_cast<int>(n)), [&](const cv::Range &range) {
+        for (int i = range.start; i < range.end; ++i)
+            fn(static_cast<std::size_t>(i));
+    });
+#else
+    using F = std::remove_reference_t<Fn>;
+    auto task = [](void *ctx, std::size_t i) { (*static_cast<F *>(ctx))(i); };
+    if (n > 1 && ParallelPool::instance().run(n, task, const_cast<void *>(static_cast<const void *>(std::addressof(fn)))))
+        return;
+    for (std::size_t i = 0; i < n; ++i)
+        fn(i);
+#endif // HAVE_OPENCV
+}
+
 // 中心差商计算一元函数导数
 static inline double partial(Func1d func, double x_dx, double dx)
 {
@@ -37,11 +183,13 @@ static inline double partial(Func1d func, double x_dx, double dx)
 // 中心差商计算多元函数偏导数
 static inline double partial(FuncNd func, std::vector<double> &x_dx, std::size_t idx, double dx)
 {
-    x_dx[idx] += dx;
+    // 直接恢复原值，避免舍入误差在各分量的计算之间累积，使串行与并行计算的结果一致
+    const double x = x_dx[idx];
+    x_dx[idx] = x + dx;
     double f1 = func(x_dx);
-    x_dx[idx] -= 2 * dx;
+    x_dx[idx] = x - dx;
     double f2 = func(x_dx);
-    x_dx[idx] += dx;
+    x_dx[idx] = x;
     return (f1 - f2) / (2 * dx);
 }
 
@@ -69,24 +217,31 @@ double derivative(Func1d func, double x, DiffMode mode, double dx)
  * @param[out] xgrad 函数在指定点的梯度向量
  * @param[in] mode 梯度计算模式
  * @param[in] dx 计算偏导数时的步长
- * @return 函数在指定点的梯度向量
+ * @param[in] parallel 是否并行计算各偏导数
  */
-static void calcGrad(FuncNd func, const std::vector<double> &x, std::vector<double> &xgrad, DiffMode mode, double dx)
+static void calcGrad(FuncNd func, const std::vector<double> &x, std::vector<double> &xgrad, DiffMode mode, double dx, bool parallel = false)
 {
-    auto x_dx{x};
-    if (mode == DiffMode::Ridders)
-        for (std::size_t i = 0; i < x_dx.size(); ++i)
-        {
-            double T00{partial(func, x_dx, i, 2 * dx)};
-            double T10{partial(func, x_dx, i, dx)};
-            double T20{partial(func, x_dx, i, dx / 2)};
-            double T11{(4. * T10 - T00) / 3.};
-            double T21{(4. * T20 - T10) / 3.};
-            xgrad[i] = (16. * T21 - T11) / 15.;
-        }
+    auto partial_i = [&](std::vector<double> &x_dx, std::size_t i) {
+        if (mode != DiffMode::Ridders)
+            return partial(func, x_dx, i, dx);
+        double T00{partial(func, x_dx, i, 2 * dx)};
+        double T10{partial(func, x_dx, i, dx)};
+        double T20{partial(func, x_dx, i, dx / 2)};
+        double T11{(4. * T10 - T00) / 3.};
+        double T21{(4. * T20 - T10) / 3.};
+        return (16. * T21 - T11) / 15.;
+    };
+    if (parallel && x.size() > 1)
+        parallelFor(x.size(), [&](std::size_t i) {
+            auto x_dx{x};
+            xgrad[i] = partial_i(x_dx, i);
+        });
     else
+    {
+        auto x_dx{x};
         for (std::size_t i = 0; i < x_dx.size(); ++i)
-            xgrad[i] = partial(func, x_dx, i, dx);
+            xgrad[i] = partial_i(x_dx, i);
+    }
 }
 
 std::vector<double> grad(FuncNd func, const std::vector<double> &x, DiffMode mode, double dx)
@@ -110,59 +265,21 @@ static inline double normL2(const std::vector<double> &x)
     return std::sqrt(retval);
 }
 
-std::pair<double, double> region(Func1d func, double x0, double delta)
-{
-    double f1{func(x0)}, f2{func(x0 + delta)};
-    if (f1 > f2)
-    {
-        f1 = f2;
-        f2 = func(x0 + 3 * delta);
-        return f1 < f2 ? std::make_pair(x0, x0 + 3 * delta) : (f1 == f2 ? std::make_pair(x0 + delta, x0 + 3 * delta) : region(func, x0 + delta, 2 * delta));
-    }
-    else if (f1 < f2)
-    {
-        f2 = f1;
-        f1 = func(x0 - delta);
-        return f1 > f2 ? std::make_pair(x0 - delta, x0 + delta) : (f1 == f2 ? std::make_pair(x0 - delta, x0) : region(func, x0 - 3 * delta, 2 * delta));
-    }
-    else
-        return {x0, x0 + delta};
-}
+std::pair<double, double> region(Func1d func, double x0, double delta) { return detail::region(func, x0, delta); }
 
-std::pair<double, double> fminbnd(Func1d func, double x1, double x2, const OptimalOptions &options)
-{
-    constexpr double phi = 0.618033988749895;
-    double a1{x1 + (1.0 - phi) * (x2 - x1)}, a2{x1 + phi * (x2 - x1)};
-    double f1{func(a1)}, f2{func(a2)};
-    for (int i = 0; i < options.max_iter; ++i)
-    {
-        if (std::abs(x1 - x2) < options.tol)
-            break;
-        if (f1 < f2) // 替换右端点
-        {
-            x2 = a2, a2 = a1, f2 = f1;
-            a1 = x1 + (1.0 - phi) * (x2 - x1);
-            f1 = func(a1);
-        }
-        else // 替换左端点
-        {
-            x1 = a1, a1 = a2, f1 = f2;
-            a2 = x1 + phi * (x2 - x1);
-            f2 = func(a2);
-        }
-    }
-    return {0.5 * (x1 + x2), func(0.5 * (x1 + x2))};
-}
+std::pair<double, double> fminbnd(Func1d func, double x1, double x2, const OptimalOptions &options) { return detail::fminbnd(func, x1, x2, options); }
 
 // 共轭梯度法
 static double fminunc_cg(FuncNd func, std::vector<double> &xk, const OptimalOptions &options)
 {
-    std::vector<double> s = -xk;
-    std::vector<double> xk_grad = grad(func, xk, options.diff_mode, options.dx), xk2_grad(xk_grad.size());
+    std::vector<double> xk_grad(xk.size()), xk2_grad(xk.size());
+    calcGrad(func, xk, xk_grad, options.diff_mode, options.dx, options.parallel);
     // 判断是否收敛
     double nbl_xk = normL2(xk_grad);
     if (nbl_xk < options.tol)
         return func(xk);
+    // 初始搜索方向为负梯度方向
+    std::vector<double> s = -xk_grad;
     // 一维搜索函数
     auto func_alpha = [&](double alpha) {
         auto xk2 = xk + alpha * s;
@@ -178,8 +295,7 @@ static double fminunc_cg(FuncNd func, std::vector<double> &xk, const OptimalOpti
         for (std::size_t j = 0; j < xk.size(); ++j)
             xk[j] += alpha * s[j];
         retfval = fval;
-        calcGrad(func, xk, xk2_grad, options.diff_mode, options.dx);
-        xk2_grad = grad(func, xk, options.diff_mode, options.dx);
+        calcGrad(func, xk, xk2_grad, options.diff_mode, options.dx, options.parallel);
         auto nbl_xk2 = normL2(xk2_grad);
         if (nbl_xk2 < options.tol)
             break;
@@ -204,8 +320,25 @@ static double fminunc_splx(FuncNd func, std::vector<double> &xk, const OptimalOp
         p = {xk, 0};
     for (std::size_t i = 0; i < dim; ++i)
         splx[i + 1].first[i] += 100 * options.dx;
-    for (std::size_t i = 0; i < N; ++i)
-        splx[i].second = func(splx[i].first);
+    auto eval_vertices = [&](std::size_t first) {
+        if (options.parallel)
+            parallelFor(N - first, [&](std::size_t i) { splx[first + i].second = func(splx[first + i].first); });
+        else
+            for (std::size_t i = first; i < N; ++i)
+                splx[i].second = func(splx[i].first);
+    };
+    eval_vertices(0);
+    // 候选点：反射点、反压缩点、扩展点、压缩点，均仅由中心与最差点决定，并行时同时计算
+    // 串行时通常只需计算其中 1 ~ 2 个，因此仅在有多个线程可用时预先计算全部候选点
+    const bool speculate = options.parallel && parallelWorkers() > 1;
+    std::array<std::vector<double>, 4> cand;
+    std::array<double, 4> fcand{};
+    std::array<bool, 4> evaluated{};
+    auto value = [&](std::size_t k) {
+        if (!evaluated[k])
+            fcand[k] = func(cand[k]), evaluated[k] = true;
+        return fcand[k];
+    };
     // 单纯形迭代
     for (int i = 0; i < options.max_iter; ++i)
     {
@@ -214,52 +347,52 @@ static double fminunc_splx(FuncNd func, std::vector<double> &xk, const OptimalOp
         std::vector<double> xc(dim);
         std::for_each(splx.begin(), splx.end() - 1, [&](const auto &vp) { xc += vp.first; });
         xc /= static_cast<double>(N - 1);
+        const auto &xh = splx.back().first;
         // 反射 xr = xc + alpha * (xc - xh)，其中 alpha = 1
-        std::vector<double> xr(dim);
-        for (std::size_t j = 0; j < dim; ++j)
-            xr[j] = 2 * xc[j] - splx.back().first[j];
-
-        double fxr = func(xr);
-        // f(xn-1) <= f(xr)，反射点函数值大于最差点，则重新计算反射点（反压缩）
-        if (splx.back().second <= fxr)
+        // 反压缩 xr = xc - beta * (xc - xh)，其中 beta = 0.5
+        // 扩展 xe = xc + gamma * (xc - xh)，其中 gamma = 2
+        // 压缩 xs = xc + beta * (xc - xh)，其中 beta = 0.5
+        constexpr double coeffs[4] = {1, -0.5, 2, 0.5};
+        for (std::size_t k = 0; k < 4; ++k)
+        {
+            cand[k].resize(dim);
+            for (std::size_t j = 0; j < dim; ++j)
+                cand[k][j] = xc[j] + coeffs[k] * (xc[j] - xh[j]);
+        }
+        evaluated.fill(false);
+        if (speculate)
         {
-            // 压缩 xs = xc - beta * (xc - xh)，其中 beta = 0.5
-            xr = xc + splx.back().first;
-            xr /= 2.0;
-            fxr = func(xr);
+            parallelFor(4, [&](std::size_t k) { fcand[k] = func(cand[k]); });
+            evaluated.fill(true);
         }
 
-        // f(xr) < f(x0)，反射点函数值小于最优点
+        std::size_t r = 0;
+        double fxr = value(0);
+        // f(xn-1) <= f(xr)，反射点函数值大于最差点，则使用反压缩点
+        if (splx.back().second <= fxr)
+            r = 1, fxr = value(1);
+
+        // f(xr) < f(x0)，反射点函数值小于最优点，尝试扩展
         if (fxr < splx[0].second)
         {
-            // 扩展 xe = xc + gamma * (xc - xh)，其中 gamma = 2
-            std::vector<double> xe(dim);
-            for (std::size_t j = 0; j < dim; ++j)
-                xe[j] = 3 * xc[j] - 2 * splx.back().first[j];
-            double fxe = func(xe);
-            splx.back() = fxe < fxr ? std::make_pair(std::move(xe), fxe) : std::make_pair(std::move(xr), fxr);
+            double fxe = value(2);
+            splx.back() = fxe < fxr ? std::make_pair(cand[2], fxe) : std::make_pair(cand[r], fxr);
         }
         // f(x0) <= f(xr) < f(xn-2)，反射点函数值大于最优点，小于次差点
         else if (splx[0].second <= fxr && fxr < splx[N - 2].second)
-            splx.back() = {std::move(xr), fxr};
+            splx.back() = {cand[r], fxr};
         // f(xn-2) <= f(xr) < f(xn)，反射点函数值大于次差点，小于最差点
         else
         {
-            // 压缩 xs = xc + beta * (xc - xh)，其中 beta = 0.5
-            std::vector<double> xs(dim);
-            for (std::size_t j = 0; j < dim; ++j)
-                xs[j] = 1.5 * xc[j] - 0.5 * splx.back().first[j];
-            double fxs = func(xs);
+            double fxs = value(3);
             if (fxs < splx.back().second)
-                splx.back() = {std::move(xs), fxs};
+                splx.back() = {cand[3], fxs};
             else
             {
                 for (std::size_t i = 1; i < N; ++i)
-                {
                     for (std::size_t j = 0; j < dim; ++j)
                         splx[i].first[j] = 0.5 * (splx[i].first[j] + splx[0].first[j]);
-                    splx[i].second = func(splx[i].first);
-                }
+                eval_vertices(1);
             }
         }
         // 判断是否收敛
@@ -320,12 +453,16 @@ std::pair<std::vector<double>, double> fmincon(FuncNd func, const std::vector<do
  */
 static inline void calcJacobi(const FuncNds &funcs, const std::vector<double> &xk, const OptimalOptions &options, cv::Mat &jac)
 {
-    for (std::size_t i = 0; i < funcs.size(); ++i)
-    {
+    auto row = [&](std::size_t i) {
         auto xgrad = grad(funcs[i], xk, options.diff_mode, options.dx);
         for (std::size_t j = 0; j < xgrad.size(); ++j)
             jac.at<double>(i, j) = xgrad[j];
-    }
+    };
+    if (options.parallel)
+        parallelFor(funcs.size(), row);
+    else
+        for (std::size_t i = 0; i < funcs.size(); ++i)
+            row(i);
 }
 
 /**
@@ -334,11 +471,15 @@ static inline void calcJacobi(const FuncNds &funcs, const std::vector<double> &x
  * @param[in] funcs 多元函数集合
  * @param[in] xk 指定位置的自变量
  * @param[out] phi 函数值
+ * @param[in] parallel 是否并行计算
  */
-static inline void calcFs(const FuncNds &funcs, const std::vector<double> &xk, std::vector<double> &phi)
+static inline void calcFs(const FuncNds &funcs, const std::vector<double> &xk, std::vector<double> &phi, bool parallel)
 {
-    for (std::size_t i = 0; i < funcs.size(); ++i)
-        phi[i] = funcs[i](xk);
+    if (parallel)
+        parallelFor(funcs.size(), [&](std::size_t i) { phi[i] = funcs[i](xk); });
+    else
+        for (std::size_t i = 0; i < funcs.size(); ++i)
+            phi[i] = funcs[i](xk);
 }
 
 // 获取鲁棒加权
@@ -404,7 +545,7 @@ static std::vector<double> lsqnonlin_gn(const FuncNds &funcs, const std::vector<
     for (int idx = 0; idx < options.max_iter; ++idx)
     {
         // 计算函数值和搜索方向
-        calcFs(funcs, xk, phi);
+        calcFs(funcs, xk, phi, options.parallel);
         if (normL2(phi) < options.tol)
             break;
         calcJacobi(funcs, xk, options, J);
@@ -420,8 +561,7 @@ static std::vector<double> lsqnonlin_gn(const FuncNds &funcs, const std::vector<
             for (std::size_t i = 0; i < xk.size(); ++i)
                 xk2[i] -= alpha * s.at<double>(i, 0);
             std::vector<double> fvals2(funcs.size());
-            for (std::size_t i = 0; i < funcs.size(); ++i)
-                fvals2[i] = funcs[i](xk2);
+            calcFs(funcs, xk2, fvals2, options.parallel);
             return normL2(fvals2);
         };
         auto [a, b] = region(func_alpha, 1);
@@ -455,7 +595,7 @@ static std::vector<double> lsqnonlin_lm(const FuncNds &funcs, const std::vector<
     for (int idx = 0; idx < options.max_iter; ++idx)
     {
         // 计算函数值和雅可比矩阵
-        calcFs(funcs, xk, f_x);
+        calcFs(funcs, xk, f_x, options.parallel);
         cv::Mat fvals(f_x);
         calcJacobi(funcs, xk, options, J);
 
@@ -473,7 +613,7 @@ static std::vector<double> lsqnonlin_lm(const FuncNds &funcs, const std::vector<
                 new_xk[i] -= delta.at<double>(i, 0);
 
             // 计算新的函数值
-            calcFs(funcs, new_xk, f_x_new);
+            calcFs(funcs, new_xk, f_x_new, options.parallel);
 
             // 计算误差变化
             double current_error{}, new_error{};
@@ -535,4 +675,198 @@ std::vector<double> lsqnonlin(const FuncNds &funcs, const std::vector<double> &x
     return lsqnonlinRKF(funcs, x0, RobustMode::L2, options);
 }
 
+LsqSolver::LsqSolver(std::size_t m, std::size_t n, const std::vector<LsqBlock> &blocks)
+    : _m(m), _n(n), _blocks(blocks), _J(m * n), _fp(m), _fm(m), _xk(n), _xt(n), _f(m), _ft(m), _H(n * n), _A(n * n), _g(n), _s(n)
+{
+    if (n == 0)
+        RMVL_Error(RMVL_StsBadArg, "the number of variables must be greater than 0");
+    if (m == 0)
+        RMVL_Error(RMVL_StsBadArg, "the number of residuals must be greater than 0");
+    if (_blocks.empty())
+    {
+        _blocks.push_back({m, std::vector<std::size_t>(n)});
+        std::iota(_blocks.front().cols.begin(), _blocks.front().cols.end(), 0);
+    }
+    std::size_t rows{};
+    _col_blocks.resize(n);
+    for (std::size_t b = 0; b < _blocks.size(); ++b)
+    {
+        _row_begin.push_back(rows);
+        rows += _blocks[b].rows;
+        for (auto c : _blocks[b].cols)
+        {
+            if (c >= n)
+                RMVL_Error_(RMVL_StsBadArg, "Column index %zu of block %zu is out of range", c, b);
+            _col_blocks[c].push_back(b);
+        }
+    }
+    if (rows != m)
+        RMVL_Error_(RMVL_StsBadSize, "The blocks cover %zu residuals, but m = %zu", rows, m);
+    // 贪心着色：出现在同一残差块中的自变量着不同的颜色，同色的自变量在差商计算中同时扰动
+    std::vector<std::size_t> color(n, n);
+    std::vector<bool> used;
+    for (std::size_t c = 0; c < n; ++c)
+    {
+        used.assign(n, false);
+        for (auto b : _col_blocks[c])
+            for (auto other : _blocks[b].cols)
+                if (color[other] < n)
+                    used[color[other]] = true;
+        color[c] = std::find(used.begin(), used.end(), false) - used.begin();
+        if (color[c] >= _groups.size())
+            _groups.resize(color[c] + 1);
+        _groups[color[c]].push_back(c);
+    }
+}
+
+void LsqSolver::jacobian()
+{
+    std::fill(_J.begin(), _J.end(), 0.0);
+    if (*_jac)
+        return (*_jac)(_xk.data(), _J.data());
+    // 各组自变量对应雅可比矩阵中互不重叠的列，可相互独立地计算
+    auto column = [this](std::size_t g, double *x, double *fp, double *fm) {
+        std::copy(_xk.begin(), _xk.end(), x);
+        for (auto c : _groups[g])
+            x[c] += _dx;
+        (*_func)(x, fp);
+        for (auto c : _groups[g])
+            x[c] -= 2 * _dx;
+        (*_func)(x, fm);
+        for (auto c : _groups[g])
+            for (auto b : _col_blocks[c])
+                for (std::size_t r = _row_begin[b]; r < _row_begin[b] + _blocks[b].rows; ++r)
+                    _J[r * _n + c] = (fp[r] - fm[r]) / (2 * _dx);
+    };
+    if (_parallel)
+        parallelFor(_groups.size(), [&](std::size_t g) {
+            double *f = _par_f.data() + 2 * _m * g;
+            column(g, _par_x.data() + _n * g, f, f + _m);
+        });
+    else
+        for (std::size_t g = 0; g < _groups.size(); ++g)
+            column(g, _xt.data(), _fp.data(), _fm.data());
+}
+
+void LsqSolver::normal()
+{
+    jacobian();
+    std::fill(_H.begin(), _H.end(), 0.0);
+    std::fill(_g.begin(), _g.end(), 0.0);
+    for (std::size_t b = 0; b < _blocks.size(); ++b)
+    {
+        const auto &cols = _blocks[b].cols;
+        for (std::size_t r = _row_begin[b]; r < _row_begin[b] + _blocks[b].rows; ++r)
+        {
+            const double *Jr = _J.data() + r * _n;
+            for (std::size_t i = 0; i < cols.size(); ++i)
+            {
+                double ji = Jr[cols[i]];
+                if (ji == 0)
+                    continue;
+                _g[cols[i]] += ji * _f[r];
+                for (std::size_t j = 0; j < cols.size(); ++j)
+                    _H[cols[i] * _n + cols[j]] += ji * Jr[cols[j]];
+            }
+        }
+    }
+}
+
+void LsqSolver::solveGN(const OptimalOptions &options)
+{
+    // 仅捕获 this，std::function 不进行堆内存分配
+    Func1d func_alpha = [this](double alpha) {
+        for (std::size_t i = 0; i < _n; ++i)
+            _xt[i] = _xk[i] - alpha * _s[i];
+        (*_func)(_xt.data(), _ft.data());
+        return normL2(_ft);
+    };
+    for (int idx = 0; idx < options.max_iter; ++idx)
+    {
+        // 计算函数值和搜索方向
+        (*_func)(_xk.data(), _f.data());
+        if (normL2(_f) < options.tol)
+            break;
+        // JᵀJs = Jᵀf
+        normal();
+        if (!detail::choleskySolve(_n, _H.data(), _g.data(), _s.data()))
+            break;
+        // 一维搜索 alpha
+        auto [a, b] = region(func_alpha, 1);
+        double alpha = fminbnd(func_alpha, a, b, options).first;
+        // 更新 xk
+        for (std::size_t i = 0; i < _n; ++i)
+            _xk[i] -= alpha * _s[i];
+        if (std::abs(alpha) * normL2(_s) < options.tol)
+            break;
+    }
+}
+
+void LsqSolver::solveLM(const OptimalOptions &options)
+{
+    double lambda{0.01};
+    (*_func)(_xk.data(), _f.data());
+    for (int idx = 0; idx < options.max_iter; ++idx)
+    {
+        normal();
+        double current_error = normL2(_f);
+        while (idx < options.max_iter)
+        {
+            // (JᵀJ + λI)δ = Jᵀf
+            std::copy(_H.begin(), _H.end(), _A.begin());
+            for (std::size_t i = 0; i < _n; ++i)
+                _A[i * _n + i] += lambda;
+            bool solved = detail::choleskySolve(_n, _A.data(), _g.data(), _s.data());
+            if (solved)
+            {
+                for (std::size_t i = 0; i < _n; ++i)
+                    _xt[i] = _xk[i] - _s[i];
+                (*_func)(_xt.data(), _ft.data());
+            }
+            // 接受新参数，减小 lambda
+            if (solved && normL2(_ft) < current_error)
+            {
+                std::swap(_xk, _xt);
+                std::swap(_f, _ft);
+                lambda /= 2;
+                break;
+            }
+            // 拒绝新参数，增加 lambda
+            lambda *= 2;
+            idx++;
+        }
+        // 检查收敛条件
+        if (normL2(_s) < options.tol)
+            break;
+    }
+}
+
+const std::vector<double> &LsqSolver::solve(const ResidualFunc &func, const std::vector<double> &x0, const OptimalOptions &options, const JacobianFunc &jac)
+{
+    if (x0.size() != _n)
+        RMVL_Error_(RMVL_StsBadSize, "the size of x0 (%zu) must be equal to n (%zu)", x0.size(), _n);
+    _func = &func, _jac = &jac, _dx = options.dx;
+    _parallel = options.parallel && !jac && _groups.size() > 1;
+    // 并行计算时每组自变量使用独立的缓冲区，首次使用时分配
+    if (_parallel && _par_x.empty())
+    {
+        _par_x.resize(_groups.size() * _n);
+        _par_f.resize(_groups.size() * 2 * _m);
+    }
+    std::copy(x0.begin(), x0.end(), _xk.begin());
+    if (options.lsq_mode == LsqMode::LM)
+        solveLM(options);
+    else
+        solveGN(options);
+    return _xk;
+}
+
+std::vector<double> lsqnonlinVec(const ResidualFunc &func, std::size_t m, const std::vector<double> &x0, const OptimalOptions &options,
+                                 const JacobianFunc &jac, const std::vector<LsqBlock> &blocks)
+{
+    if (x0.empty())
+        RMVL_Error(RMVL_StsBadArg, "x0 is empty");
+    return LsqSolver(m, x0.size(), blocks).solve(func, x0, options, jac);
+}
+
 } // namespace rm
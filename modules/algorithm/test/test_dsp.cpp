@@ -13,6 +13,7 @@
 
 #include "rmvl/algorithm/dsp.hpp"
 #include "rmvl/algorithm/math.hpp"
+#include "rmvl/core/util.hpp"
 
 namespace rm_test
 {
@@ -31,4 +32,315 @@ TEST(DSPTest, dft)
     EXPECT_EQ(max_it, f);
 }
 
+// 按照定义计算的 DFT
+static std::vector<std::complex<double>> naiveDFT(const std::vector<std::complex<double>> &x)
+{
+    const std::size_t N = x.size();
+    std::vector<std::complex<double>> X(N);
+    for (std::size_t k = 0; k < N; ++k)
+        for (std::size_t t = 0; t < N; ++t)
+            X[k] += x[t] * std::polar(1.0, -2 * rm::PI * static_cast<double>(k * t % N) / N);
+    return X;
+}
+
+TEST(DSPTest, fft_plan_lengths)
+{
+    // 2 的幂、混合基、含大素因子（Bluestein）的长度
+    for (std::size_t N : {1, 2, 8, 1024, 6, 12, 30, 49, 100, 143, 1000, 17, 97, 2 * 37, 1031})
+    {
+        std::vector<std::complex<double>> x(N);
+        for (std::size_t i = 0; i < N; ++i)
+            x[i] = {std::sin(0.37 * i + 1), std::cos(1.3 * i * i)};
+        auto expect = naiveDFT(x);
+        rm::FFTPlan plan(N);
+        std::vector<std::complex<double>> X(N);
+        plan.forward(x.data(), X.data());
+        for (std::size_t k = 0; k < N; ++k)
+            EXPECT_LT(std::abs(X[k] - expect[k]), 1e-9 * N) << "N = " << N << ", k = " << k;
+        // 原址逆变换
+        plan.inverse(X.data(), X.data());
+        for (std::size_t i = 0; i < N; ++i)
+            EXPECT_LT(std::abs(X[i] - x[i]), 1e-12 * N) << "N = " << N << ", i = " << i;
+    }
+    EXPECT_THROW(rm::FFTPlan(0), rm::Exception);
+}
+
+TEST(DSPTest, fft_plan_real)
+{
+    for (std::size_t N : {1, 2, 16, 30, 1000, 17, 97})
+    {
+        std::vector<double> x(N);
+        for (std::size_t i = 0; i < N; ++i)
+            x[i] = 0.785 * std::sin(1.9 * i / 10.0) + 1.305 + 0.1 * std::cos(3.7 * i);
+        auto expect = naiveDFT({x.begin(), x.end()});
+        rm::FFTPlan plan(N);
+        std::vector<std::complex<double>> X(N / 2 + 1);
+        // 重复调用结果一致
+        for (int rep = 0; rep < 2; ++rep)
+        {
+            plan.forwardReal(x.data(), X.data());
+            for (std::size_t k = 0; k <= N / 2; ++k)
+                EXPECT_LT(std::abs(X[k] - expect[k]), 1e-9 * N) << "N = " << N << ", k = " << k;
+        }
+    }
+}
+
+TEST(DSPTest, dft_preallocated)
+{
+    constexpr std::size_t N = 360;
+    std::vector<std::complex<double>> x(N), X(N), y(N);
+    for (std::size_t i = 0; i < N; ++i)
+        x[i] = std::polar(1.0, 2 * rm::PI * 7 * i / N);
+    rm::dft(x.data(), N, X.data());
+    EXPECT_NEAR(std::abs(X[7]), N, 1e-9);
+    EXPECT_NEAR(std::abs(X[8]), 0, 1e-9);
+    rm::idft(X.data(), N, y.data());
+    for (std::size_t i = 0; i < N; ++i)
+        EXPECT_LT(std::abs(y[i] - x[i]), 1e-12);
+    // 任意长度的 ComplexSignal
+    rm::ComplexSignal xs(x.begin(), x.end());
+    auto Xs = rm::dft(xs);
+    EXPECT_NEAR(std::abs(Xs[7]), N, 1e-9);
+}
+
+TEST(DSPTest, jacobsen)
+{
+    // 频率位于第 10 与第 11 个频点之间
+    constexpr std::size_t N = 64;
+    constexpr double k = 10.3;
+    rm::ComplexSignal x(N);
+    for (std::size_t i = 0; i < N; ++i)
+        x[i] = std::polar(1.0, 2 * rm::PI * k * i / N);
+    auto X = rm::dft(x);
+    // 插值误差远小于频点间隔
+    EXPECT_NEAR(10 + rm::jacobsen(X[9], X[10], X[11]), k, 1e-3);
+}
+
+TEST(DSPTest, sliding_dft)
+{
+    // 与窗口内采样点的完整 DFT 一致
+    constexpr std::size_t N = 32;
+    rm::SlidingDFT sdft(N, 1, 6);
+    rm::ComplexSignal window;
+    for (int n = 0; n < 200; ++n)
+    {
+        double xn = std::sin(0.37 * n) + 0.5 * std::cos(1.1 * n + 0.2) + 0.3;
+        sdft.update(xn);
+        window.push_back(xn);
+        if (window.size() > N)
+            window.pop_front();
+        if (window.size() == N)
+        {
+            auto X = rm::dft(window);
+            for (std::size_t k = 1; k <= 6; ++k)
+            {
+                EXPECT_NEAR(sdft.bin(k).real(), X[k].real(), 1e-9);
+                EXPECT_NEAR(sdft.bin(k).imag(), X[k].imag(), 1e-9);
+            }
+        }
+    }
+    EXPECT_TRUE(sdft.full());
+}
+
+TEST(DSPTest, sliding_dft_frequency)
+{
+    // 能量机关转速 0.785 sin(1.9t) + 1.305，采样频率 100 Hz，窗口 8 s
+    constexpr double fs = 100, omega = 1.9;
+    rm::SlidingDFT sdft(800, 1, 10);
+    for (int n = 0; n < 3000; ++n)
+        sdft.update(0.785 * std::sin(omega * n / fs) + 1.305);
+    EXPECT_NEAR(2 * rm::PI * sdft.frequency(fs), omega, 0.02);
+}
+
+TEST(DSPTest, goertzel)
+{
+    // 候选频率处的 DFT 值与直接求和一致，功率最大处为信号频率
+    constexpr std::size_t N = 50;
+    std::vector<double> freqs = {0.05, 0.083, 0.12, 0.2};
+    rm::GoertzelBank bank(freqs, N);
+    std::vector<double> x(N);
+    for (std::size_t n = 0; n < N; ++n)
+        x[n] = 2 * std::cos(2 * rm::PI * 0.083 * n + 0.4);
+    for (std::size_t n = 0; n + 1 < N; ++n)
+        EXPECT_FALSE(bank.update(x[n]));
+    EXPECT_TRUE(bank.update(x.back()));
+    EXPECT_EQ(bank.peak(), 1);
+    for (std::size_t i = 0; i < freqs.size(); ++i)
+    {
+        std::complex<double> X{};
+        for (std::size_t n = 0; n < N; ++n)
+            X += x[n] * std::polar(1.0, -2 * rm::PI * freqs[i] * n);
+        EXPECT_NEAR(bank.value(i).real(), X.real(), 1e-9);
+        EXPECT_NEAR(bank.value(i).imag(), X.imag(), 1e-9);
+    }
+}
+
+// 以输入正弦信号稳态输出的幅值与相位测量滤波器在频率 f 处的响应
+template <typename Filter>
+static std::complex<double> measureResponse(Filter &filter, double f, std::size_t settle = 2000, std::size_t n = 1000)
+{
+    std::complex<double> X{}, Y{};
+    for (std::size_t i = 0; i < settle + n; ++i)
+    {
+        double x = std::cos(2 * rm::PI * f * i);
+        double y = filter.update(x);
+        if (i >= settle)
+        {
+            auto w = std::polar(1.0, -2 * rm::PI * f * i);
+            X += x * w, Y += y * w;
+        }
+    }
+    return Y / X;
+}
+
+TEST(DSPTest, butterworth_response)
+{
+    constexpr double fc = 0.05;
+    for (std::size_t order = 1; order <= 5; ++order)
+    {
+        auto lpf = rm::BiquadCascade::butterworth(order, fc);
+        EXPECT_EQ(lpf.sections().size(), (order + 1) / 2);
+        EXPECT_NEAR(std::abs(lpf.response(0)), 1, 1e-12);
+        EXPECT_NEAR(std::abs(lpf.response(fc)), std::sqrt(0.5), 1e-9);
+        // 双线性变换的 Butterworth 滤波器：|H|² = 1 / (1 + (tan(πf) / tan(πfc))^{2N})
+        for (double f : {0.01, 0.03, 0.08, 0.15, 0.3})
+        {
+            double r = std::tan(rm::PI * f) / std::tan(rm::PI * fc);
+            double expect = 1 / std::sqrt(1 + std::pow(r, 2.0 * order));
+            EXPECT_NEAR(std::abs(lpf.response(f)), expect, 1e-9);
+            // 实测的稳态响应与理论响应一致
+            lpf.reset();
+            auto h = measureResponse(lpf, f);
+            EXPECT_NEAR(std::abs(h - lpf.response(f)), 0, 1e-6) << "order = " << order << ", f = " << f;
+        }
+    }
+    EXPECT_THROW(rm::BiquadCascade::butterworth(0, fc), rm::Exception);
+    EXPECT_THROW(rm::BiquadCascade::butterworth(2, 0.5), rm::Exception);
+}
+
+TEST(DSPTest, biquad_notch)
+{
+    constexpr double f0 = 0.12;
+    rm::BiquadCascade notch({rm::Biquad::notch(f0, 5)});
+    EXPECT_LT(std::abs(notch.response(f0)), 1e-12);
+    EXPECT_NEAR(std::abs(notch.response(0)), 1, 1e-12);
+    EXPECT_NEAR(std::abs(notch.response(0.5)), 1, 1e-12);
+    // 带宽约为 f0 / Q，远离陷波频率处几乎无衰减
+    EXPECT_GT(std::abs(notch.response(0.03)), 0.95);
+    EXPECT_LT(std::abs(measureResponse(notch, f0)), 1e-6);
+}
+
+TEST(DSPTest, biquad_block_and_reset)
+{
+    auto lpf = rm::BiquadCascade::butterworth(4, 0.1);
+    auto blk = lpf;
+    std::vector<double> x(200), y(200);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        x[i] = std::sin(0.3 * i) + 0.01 * i;
+    // 分两段处理，结果与逐点处理一致
+    blk.process(x.data(), y.data(), 77);
+    blk.process(x.data() + 77, y.data() + 77, x.size() - 77);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        EXPECT_EQ(y[i], lpf.update(x[i]));
+    // 原址处理
+    blk.reset();
+    blk.process(x.data(), x.data(), x.size());
+    EXPECT_EQ(x, y);
+    // 稳态初始化后，恒定输入的输出保持不变
+    lpf.reset(2.5);
+    for (int i = 0; i < 10; ++i)
+        EXPECT_NEAR(lpf.update(2.5), 2.5, 1e-12);
+}
+
+TEST(DSPTest, fir_response)
+{
+    // 滑动平均：|H(f)| = |sin(πfN) / (N·sin(πf))|
+    constexpr std::size_t N = 8;
+    auto ma = rm::FIRFilter::movingAverage(N);
+    for (double f : {0.01, 0.05, 0.125, 0.2, 0.37})
+    {
+        double expect = std::abs(std::sin(rm::PI * f * N) / (N * std::sin(rm::PI * f)));
+        EXPECT_NEAR(std::abs(ma.response(f)), expect, 1e-12);
+        ma.reset();
+        EXPECT_NEAR(std::abs(measureResponse(ma, f, 100) - ma.response(f)), 0, 1e-9);
+    }
+    // 窗函数低通：通带增益接近 1，阻带衰减大于 50 dB
+    auto lpf = rm::FIRFilter::lowpass(61, 0.1);
+    EXPECT_NEAR(std::abs(lpf.response(0)), 1, 1e-12);
+    EXPECT_NEAR(std::abs(lpf.response(0.02)), 1, 5e-3);
+    EXPECT_NEAR(std::abs(lpf.response(0.1)), 0.5, 0.02);
+    for (double f : {0.16, 0.25, 0.4})
+        EXPECT_LT(std::abs(lpf.response(f)), 3e-3);
+    // 分段、原址处理与逐点处理一致
+    auto blk = lpf;
+    std::vector<double> x(300), y(300);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        x[i] = std::sin(0.05 * i) + std::sin(1.7 * i);
+    blk.process(x.data(), y.data(), 100);
+    blk.process(x.data() + 100, y.data() + 100, x.size() - 100);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        EXPECT_EQ(y[i], lpf.update(x[i]));
+    blk.reset();
+    blk.process(x.data(), x.data(), x.size());
+    EXPECT_EQ(x, y);
+    EXPECT_THROW(rm::FIRFilter(std::vector<double>{}), rm::Exception);
+}
+
+TEST(DSPTest, savitzky_golay)
+{
+    // 二次多项式信号，二阶拟合的平滑值与导数均为精确值
+    constexpr double dt = 0.01;
+    auto signal = [](double t) { return 3 + 2 * t - 40 * t * t; };
+    auto velocity = [](double t) { return 2 - 80 * t; };
+    auto smooth = rm::FIRFilter::savitzkyGolay(11, 2, 0, dt);
+    auto deriv = rm::FIRFilter::savitzkyGolay(11, 2, 1, dt);
+    auto accel = rm::FIRFilter::savitzkyGolay(11, 2, 2, dt);
+    auto center = rm::FIRFilter::savitzkyGolay(11, 2, 1, dt, 5);
+    for (int i = 0; i < 50; ++i)
+    {
+        double t = i * dt, x = signal(t);
+        double s = smooth.update(x), v = deriv.update(x), a = accel.update(x), vc = center.update(x);
+        if (i >= 10)
+        {
+            EXPECT_NEAR(s, x, 1e-9);
+            EXPECT_NEAR(v, velocity(t), 1e-7);
+            EXPECT_NEAR(a, -80, 1e-4);
+            EXPECT_NEAR(vc, velocity(t - 5 * dt), 1e-7);
+        }
+    }
+    // 低频处导数滤波器的响应接近理想微分器 j2πf / dt
+    auto h = center.response(0.005) * std::polar(1.0, 2 * rm::PI * 0.005 * 5);
+    EXPECT_NEAR(h.imag(), 2 * rm::PI * 0.005 / dt, 1e-2 * 2 * rm::PI * 0.005 / dt);
+    EXPECT_THROW(rm::FIRFilter::savitzkyGolay(3, 3), rm::Exception);
+    EXPECT_THROW(rm::FIRFilter::savitzkyGolay(5, 2, 3), rm::Exception);
+}
+
+TEST(DSPTest, one_euro)
+{
+    // 带噪声的静止信号：抖动被抑制
+    rm::OneEuroFilter still(1.0, 0.5);
+    double var_in{}, var_out{};
+    for (int i = 0; i < 2000; ++i)
+    {
+        double noise = 0.01 * std::sin(12.9898 * i) * std::cos(78.233 * i);
+        double y = still.update(1 + noise, i * 0.01);
+        if (i >= 500)
+            var_in += noise * noise, var_out += (y - 1) * (y - 1);
+    }
+    EXPECT_LT(var_out, 0.1 * var_in);
+    // 匀速变化的信号：beta > 0 时截止频率升高，滞后小于固定截止频率的一阶低通
+    rm::OneEuroFilter fixed(1.0, 0), adaptive(1.0, 0.5);
+    std::vector<double> t(500), x(500), y_fixed(500), y_adaptive(500);
+    for (std::size_t i = 0; i < t.size(); ++i)
+        t[i] = i * 0.01, x[i] = 5 * t[i];
+    fixed.process(x.data(), t.data(), y_fixed.data(), x.size());
+    adaptive.process(x.data(), t.data(), y_adaptive.data(), x.size());
+    double lag_fixed = x.back() - y_fixed.back(), lag_adaptive = x.back() - y_adaptive.back();
+    EXPECT_GT(lag_fixed, 0);
+    EXPECT_LT(lag_adaptive, 0.5 * lag_fixed);
+    EXPECT_NEAR(adaptive.derivative(), 5, 1e-3);
+    // 时间戳不递增的采样点被忽略
+    EXPECT_EQ(adaptive.update(100, t.back()), y_adaptive.back());
+}
+
 } // namespace rm_test
@@ -88,6 +88,234 @@ TEST(KalmanTest, kf2)
     EXPECT_NEAR(x(3), 20, 1e-2); // 0.2 / 0.01
 }
 
+// 结构化（匀速运动模型、选择观测矩阵）与稠密卡尔曼滤波器结果一致性测试
+TEST(KalmanTest, kf_structured)
+{
+    std::default_random_engine ng;
+    std::uniform_real_distribution<double> err{-1, 1};
+
+    rm::KF63d dense;
+    rm::KF63dCV cv_kf;
+    rm::KalmanFilter<double, 6, 3, rm::KFSelectH> select_kf;
+    cv::Matx66d Q = 1e-1 * cv::Matx66d::eye();
+    Q(0, 3) = Q(3, 0) = 1e-2;
+    cv::Matx33d R{1e-2, 1e-3, 0,
+                  1e-3, 2e-2, 0,
+                  0, 0, 3e-2};
+    dense.setQ(Q), cv_kf.setQ(Q), select_kf.setQ(Q);
+    dense.setR(R), cv_kf.setR(R), select_kf.setR(R);
+    dense.init({1, 2, 3, 0, 0, 0}, 1e3);
+    cv_kf.init({1, 2, 3, 0, 0, 0}, 1e3);
+    select_kf.init({1, 2, 3, 0, 0, 0}, 1e3);
+    dense.setH({1, 0, 0, 0, 0, 0,
+                0, 1, 0, 0, 0, 0,
+                0, 0, 1, 0, 0, 0});
+    for (int i = 0; i <= 100; i++)
+    {
+        double t{0.01 + 0.001 * (i % 5)};
+        cv::Matx66d A{1, 0, 0, t, 0, 0,
+                      0, 1, 0, 0, t, 0,
+                      0, 0, 1, 0, 0, t,
+                      0, 0, 0, 1, 0, 0,
+                      0, 0, 0, 0, 1, 0,
+                      0, 0, 0, 0, 0, 1};
+        dense.setA(A), cv_kf.setA(A), select_kf.setA(A);
+        auto x1_ = dense.predict();
+        auto x2_ = cv_kf.predict();
+        auto x3_ = select_kf.predict();
+        cv::Matx31d z{1 + 0.3 * i + err(ng), 2 - 0.1 * i + err(ng), 3 + err(ng)};
+        auto x1 = dense.correct(z);
+        auto x2 = cv_kf.correct(z);
+        auto x3 = select_kf.correct(z);
+        for (int j = 0; j < 6; j++)
+        {
+            EXPECT_NEAR(x1_(j), x2_(j), 1e-6);
+            EXPECT_NEAR(x1_(j), x3_(j), 1e-6);
+            EXPECT_NEAR(x1(j), x2(j), 1e-6);
+            EXPECT_NEAR(x1(j), x3(j), 1e-6);
+        }
+    }
+}
+
+// 稳态卡尔曼滤波器与完整卡尔曼滤波器的一致性测试
+TEST(KalmanTest, kf_steady_state)
+{
+    std::default_random_engine ng;
+    std::uniform_real_distribution<double> err{-1, 1};
+
+    rm::KF63dCV full, online, offline;
+    for (auto *kf : {&full, &online, &offline})
+    {
+        kf->setQ(1e-2 * cv::Matx66d::eye());
+        kf->setR(1e-1 * cv::Matx33d::eye());
+        kf->setDt(0.01);
+        kf->init({1, 2, 3, 0, 0, 0}, 1e3);
+    }
+    online.enableSteadyState(true, 1e-8);
+    EXPECT_TRUE(offline.solveSteadyState());
+    EXPECT_TRUE(offline.isSteady());
+
+    double max_err{};
+    for (int i = 0; i < 1500; i++)
+    {
+        cv::Matx31d z{1 + 0.03 * i + err(ng), 2 - 0.01 * i + err(ng), 3 + err(ng)};
+        full.predict(), online.predict(), offline.predict();
+        auto x1 = full.correct(z);
+        auto x2 = online.correct(z);
+        auto x3 = offline.correct(z);
+        // 在线检测进入稳态前与完整滤波器逐帧相同，收敛后仅有微小偏差
+        for (int j = 0; j < 6; j++)
+            EXPECT_NEAR(x1(j), x2(j), 1e-4);
+        // 离线求解的稳态增益与完整滤波器的时变增益在初始阶段存在差异，仅比较收敛后的部分
+        if (i >= 1000)
+            for (int j = 0; j < 6; j++)
+                max_err = std::max(max_err, std::abs(x1(j) - x3(j)));
+    }
+    EXPECT_TRUE(online.isSteady());
+    EXPECT_LT(max_err, 1e-3);
+
+    // 帧差时间或噪声参数发生变化时退出稳态
+    online.setDt(0.01);
+    EXPECT_TRUE(online.isSteady());
+    online.setDt(0.02);
+    EXPECT_FALSE(online.isSteady());
+    offline.setR(2e-1 * cv::Matx33d::eye());
+    EXPECT_FALSE(offline.isSteady());
+    EXPECT_TRUE(offline.solveSteadyState());
+    offline.setA(cv::Matx66d::eye());
+    EXPECT_FALSE(offline.isSteady());
+}
+
+// 帧差时间存在抖动时稳态卡尔曼滤波器仍能进入稳态
+TEST(KalmanTest, kf_steady_state_jittered_dt)
+{
+    std::default_random_engine ng;
+    std::uniform_real_distribution<double> err{-1, 1};
+    std::uniform_real_distribution<double> jitter{0.0095, 0.0105};
+
+    rm::KF63dCV full, online;
+    for (auto *kf : {&full, &online})
+    {
+        kf->setQ(1e-2 * cv::Matx66d::eye());
+        kf->setR(1e-1 * cv::Matx33d::eye());
+        kf->setDt(0.01);
+        kf->init({1, 2, 3, 0, 0, 0}, 1e3);
+    }
+    online.enableSteadyState(true, 1e-8);
+
+    double t{}, max_err{};
+    for (int i = 0; i < 1500; i++)
+    {
+        double dt = jitter(ng);
+        t += dt;
+        full.setDt(dt), online.setDt(dt);
+        cv::Matx31d z{1 + 3 * t + err(ng), 2 - t + err(ng), 3 + err(ng)};
+        full.predict(), online.predict();
+        auto x1 = full.correct(z);
+        auto x2 = online.correct(z);
+        // 协方差递推使用参考帧差时间，与完整滤波器仅有微小偏差
+        for (int j = 0; j < 3; j++)
+            max_err = std::max(max_err, std::abs(x1(j) - x2(j)));
+    }
+    EXPECT_TRUE(online.isSteady());
+    EXPECT_LT(max_err, 5e-2);
+
+    // 超出相对容差时退出稳态
+    online.setDt(0.012);
+    EXPECT_FALSE(online.isSteady());
+}
+
+// 卡尔曼滤波器组与逐个更新的卡尔曼滤波器结果一致性测试
+TEST(KalmanTest, kf_bank)
+{
+    std::default_random_engine ng;
+    std::uniform_real_distribution<double> err{-1, 1};
+
+    constexpr std::size_t K = 9;
+    rm::KFBank42d bank(2);
+    std::vector<rm::KF42d> kfs(K);
+    std::vector<std::size_t> idx;
+    for (std::size_t k = 0; k < K; k++)
+        idx.push_back(bank.add());
+    // 注销后重新注册，复用下标
+    bank.remove(idx[4]);
+    EXPECT_EQ(bank.size(), K - 1);
+    idx[4] = bank.add();
+    EXPECT_EQ(bank.size(), K);
+
+    for (std::size_t k = 0; k < K; k++)
+    {
+        kfs[k].init({10. * k, 0, 0, 0}, 1e5);
+        bank.init(idx[k], {10. * k, 0, 0, 0}, 1e5);
+        kfs[k].setQ((0.1 + 0.01 * k) * cv::Matx44d::eye());
+        bank.setQ(idx[k], (0.1 + 0.01 * k) * cv::Matx44d::eye());
+        kfs[k].setR({1e-3 * (k + 1), 1e-4, 1e-4, 1e-3});
+        bank.setR(idx[k], {1e-3 * (k + 1), 1e-4, 1e-4, 1e-3});
+        kfs[k].setH({1, 0, 0, 0, 0, 1, 0, 0});
+        bank.setH(idx[k], {1, 0, 0, 0, 0, 1, 0, 0});
+    }
+    for (int i = 0; i <= 100; i++)
+    {
+        std::vector<cv::Matx41d> xs(K);
+        for (std::size_t k = 0; k < K; k++)
+        {
+            double t{0.01 * (1 + k % 3)};
+            cv::Matx44d A{1, 0, t, 0,
+                          0, 1, 0, t,
+                          0, 0, 1, 0,
+                          0, 0, 0, 1};
+            kfs[k].setA(A);
+            bank.setA(idx[k], A);
+            kfs[k].predict();
+            cv::Matx21d z{10. * k + 0.3 * i + err(ng), 0.2 * i + err(ng)};
+            xs[k] = kfs[k].correct(z);
+            bank.setZ(idx[k], z);
+        }
+        bank.predict();
+        bank.correct();
+        for (std::size_t k = 0; k < K; k++)
+            for (int j = 0; j < 4; j++)
+                EXPECT_NEAR(bank.state(idx[k])(j), xs[k](j), 1e-6);
+    }
+}
+
+// 卡尔曼滤波器组中未设置观测量的滤波器仅执行预测
+TEST(KalmanTest, kf_bank_unmeasured)
+{
+    rm::KFBank42d bank;
+    auto k0 = bank.add(), k1 = bank.add(), k2 = bank.add();
+    bank.remove(k2);
+    cv::Matx44d A{1, 0, 0.01, 0,
+                  0, 1, 0, 0.01,
+                  0, 0, 1, 0,
+                  0, 0, 0, 1};
+    for (auto k : {k0, k1})
+    {
+        bank.init(k, {1, 2, 3, 4}, 1e3);
+        bank.setA(k, A);
+        bank.setH(k, {1, 0, 0, 0, 0, 1, 0, 0});
+    }
+    bank.setZ(k0, {1.5, 2.5});
+    EXPECT_TRUE(bank.hasZ(k0));
+    EXPECT_FALSE(bank.hasZ(k1));
+    bank.predict();
+    bank.correct();
+    EXPECT_FALSE(bank.hasZ(k0));
+    // 有观测的滤波器被校正
+    EXPECT_GT(std::abs(bank.state(k0)(0) - bank.priorState(k0)(0)), 1e-3);
+    // 无观测的滤波器后验估计等于先验估计
+    auto x1 = bank.state(k1), x1_ = bank.priorState(k1);
+    for (int j = 0; j < 4; j++)
+        EXPECT_DOUBLE_EQ(x1(j), x1_(j));
+    EXPECT_NEAR(x1(0), 1.03, 1e-12);
+    EXPECT_GT(bank.covariance(k1)(0, 0), 1e3);
+    // 整块无观测时同样仅执行预测
+    bank.predict();
+    bank.correct();
+    EXPECT_NEAR(bank.state(k1)(0), 1.06, 1e-12);
+    EXPECT_DOUBLE_EQ(bank.state(k0)(0), bank.priorState(k0)(0));
+}
+
 // 二维匀速圆周运动 EKF 测试
 TEST(KalmanTest, ekf)
 {
@@ -149,6 +377,61 @@ TEST(KalmanTest, ekf)
     EXPECT_NEAR(x(3), 2, 0.1); // 0.02 / 0.01
 }
 
+// 自动微分 EKF 与手写雅可比矩阵 EKF 结果一致性测试
+TEST(KalmanTest, autodiff_ekf)
+{
+    std::default_random_engine ng;
+    std::normal_distribution<double> err{0, 1};
+
+    double t{0.01};
+    using Dual5d = rm::Dual<double, 5>;
+    auto ad_ekf = rm::make_autodiff_ekf<double, 5, 3>(
+        [&t](const cv::Matx<Dual5d, 5, 1> &x) -> cv::Matx<Dual5d, 5, 1> {
+            return {x(0), x(1), x(2) + x(3) * t, x(3), x(4)};
+        },
+        [](const cv::Matx<Dual5d, 5, 1> &x) -> cv::Matx<Dual5d, 3, 1> {
+            return {x(0) + x(4) * cos(x(2)), x(1) + x(4) * sin(x(2)), x(2)};
+        });
+    rm::EKF53d ekf;
+    for (auto *p : std::initializer_list<rm::KalmanFilterStaticDatas<double, 5, 3> *>{&ad_ekf, &ekf})
+    {
+        p->init({0, 0, 0, 0, 150}, 1e5);
+        p->setQ(1e-1 * cv::Matx<double, 5, 5>::eye());
+        p->setR(cv::Matx33d::diag({1e-3, 1e-3, 1e-3}));
+    }
+    ekf.setFa([=](const cv::Matx<double, 5, 1> &x) -> cv::Matx<double, 5, 1> {
+        return {x(0), x(1), x(2) + x(3) * t, x(3), x(4)};
+    });
+    ekf.setFh([=](const cv::Matx<double, 5, 1> &x) -> cv::Matx<double, 3, 1> {
+        return {x(0) + x(4) * std::cos(x(2)), x(1) + x(4) * std::sin(x(2)), x(2)};
+    });
+
+    for (int i = 0; i <= 200; i++)
+    {
+        ekf.setJa({1, 0, 0, 0, 0,
+                   0, 1, 0, 0, 0,
+                   0, 0, 1, t, 0,
+                   0, 0, 0, 1, 0,
+                   0, 0, 0, 0, 1});
+        auto x1_ = ekf.predict();
+        auto x2_ = ad_ekf.predict();
+        ekf.setJh({1, 0, -x1_(4) * std::sin(x1_(2)), 0, std::cos(x1_(2)),
+                   0, 1, x1_(4) * std::cos(x1_(2)), 0, std::sin(x1_(2)),
+                   0, 0, 1, 0, 0});
+        cv::Matx31d z{500 + 200 * std::cos(0.02 * i) + err(ng),
+                      500 + 200 * std::sin(0.02 * i) + err(ng),
+                      0.02 * i + 0.01 * err(ng)};
+        auto x1 = ekf.correct(z);
+        auto x2 = ad_ekf.correct(z);
+        for (int j = 0; j < 5; j++)
+        {
+            EXPECT_NEAR(x1_(j), x2_(j), 1e-6);
+            EXPECT_NEAR(x1(j), x2(j), 1e-6);
+        }
+    }
+    EXPECT_NEAR(ad_ekf.getJa()(2, 3), t, 1e-12);
+}
+
 } // namespace rm_test
 
 #endif // HAVE_OPENCV
@@ -14,6 +14,7 @@
 #include <gtest/gtest.h>
 
 #include "rmvl/algorithm/numcal.hpp"
+#include "rmvl/core/util.hpp"
 
 namespace rm_test
 {
@@ -34,6 +35,68 @@ TEST(NumberCalculation, function_interpolator)
     EXPECT_EQ(foo(4), -7); // a0 = 1, a1=-10/3, a2=3, a3=-2/3
 }
 
+TEST(NumberCalculation, polynomial_batch)
+{
+    rm::Polynomial foo({1, -2, 0.5, 3});
+    std::vector<double> xs(21);
+    for (std::size_t i = 0; i < xs.size(); ++i)
+        xs[i] = -1 + 0.1 * i;
+    auto ys = foo.eval(xs);
+    ASSERT_EQ(ys.size(), xs.size());
+    for (std::size_t i = 0; i < xs.size(); ++i)
+        EXPECT_NEAR(ys[i], foo(xs[i]), 1e-12);
+}
+
+TEST(NumberCalculation, function_interpolator_sliding)
+{
+    // 滑动 3 个点，与由窗口内的样本直接构造的插值器一致
+    rm::Interpolator foo({0, 1, 2}, {1, 3, 2});
+    foo.pop().add(3, 5);
+    EXPECT_EQ(foo.size(), 3);
+    rm::Interpolator bar({1, 2, 3}, {3, 2, 5});
+    for (double x : {0.0, 1.5, 2.5, 4.0})
+        EXPECT_NEAR(foo(x), bar(x), 1e-12);
+    foo.pop().pop().pop();
+    EXPECT_EQ(foo.size(), 0);
+    EXPECT_THROW(foo.pop(), rm::Exception);
+}
+
+TEST(NumberCalculation, sliding_curve_fitter)
+{
+    // 窗口内的样本均取自 2x^2 + 3x - 1，滑动过程中拟合曲线始终精确
+    auto f = [](double x) { return 2 * x * x + 3 * x - 1; };
+    rm::SlidingCurveFitter foo(5, 0b111);
+    EXPECT_THROW(foo(0), rm::Exception);
+    for (int i = 0; i < 40; ++i)
+    {
+        foo.add(0.1 * i, f(0.1 * i));
+        if (foo.size() >= 3)
+        {
+            EXPECT_NEAR(foo(0.1 * i + 0.5), f(0.1 * i + 0.5), 1e-8);
+        }
+    }
+    EXPECT_EQ(foo.size(), 5);
+    EXPECT_THROW(rm::SlidingCurveFitter(2, 0b111), rm::Exception);
+}
+
+TEST(NumberCalculation, sliding_curve_fitter_least_squares)
+{
+    // y = x + e_i，e_i 以 [1, -1, -1, 1] 为周期，与窗口对齐时残差与 1、x 均正交，最小二乘直线即为 y = x
+    rm::SlidingCurveFitter foo(4, 0b11);
+    for (int i = 0; i < 30; ++i)
+    {
+        foo.add(i, i + (i % 4 == 0 || i % 4 == 3 ? 1 : -1));
+        if (i % 4 == 3)
+        {
+            EXPECT_NEAR(foo(i), i, 1e-9);
+            EXPECT_NEAR(foo(i - 3), i - 3, 1e-9);
+        }
+    }
+    // 删除样本至少于拟合项数
+    foo.pop().pop().pop();
+    EXPECT_THROW(foo(0), rm::Exception);
+}
+
 #ifdef HAVE_OPENCV
 
 TEST(NumberCalculation, curve_fitter_ax_b)
@@ -123,6 +186,94 @@ TEST(NumberCalculation, runge_kutta_odes)
     EXPECT_NEAR(res4[1], real_x2, 1e-6);
 }
 
+TEST(NumberCalculation, ode_integrator_fixed)
+{
+    rm::Odes fs = {[](double t, const std::vector<double> &x) { return 2 * x[1] + t; },
+                   [](double, const std::vector<double> &x) { return -x[0] - 3 * x[1]; }};
+    rm::RungeKutta4 rk4(fs);
+    rk4.init(0, {1, -1});
+    auto res = rk4.solve(0.01, 100);
+
+    auto integrator = rm::make_ode_integrator<2, rm::ButcherRK4>([](double t, const std::array<double, 2> &x) {
+        return std::array<double, 2>{2 * x[1] + t, -x[0] - 3 * x[1]};
+    });
+    integrator.init(0, {1, -1}, 0.01);
+    for (std::size_t i = 1; i <= 100; i++)
+    {
+        integrator.step();
+        EXPECT_NEAR(integrator.x()[0], res[i][0], 1e-12);
+        EXPECT_NEAR(integrator.x()[1], res[i][1], 1e-12);
+    }
+    EXPECT_EQ(integrator.accepted(), 100);
+}
+
+TEST(NumberCalculation, ode_integrator_adaptive)
+{
+    auto f = [](double t, const std::array<double, 2> &x) { return std::array<double, 2>{2 * x[1] + t, -x[0] - 3 * x[1]}; };
+    double real_x1 = 3.0 / 4.0 * std::exp(-2) + 2 * std::exp(-1) + 3.0 / 2.0 - 7.0 / 4.0;
+    double real_x2 = -3.0 / 4.0 * std::exp(-2) - std::exp(-1) - 1.0 / 2.0 + 3.0 / 4.0;
+
+    auto dp54 = rm::make_ode_integrator<2>(f);
+    dp54.setTolerance(1e-9, 1e-12);
+    dp54.init(0, {1, -1}, 0.1);
+    auto res_dp54 = dp54.integrate(1);
+    EXPECT_EQ(dp54.t(), 1);
+    EXPECT_NEAR(res_dp54[0], real_x1, 1e-8);
+    EXPECT_NEAR(res_dp54[1], real_x2, 1e-8);
+
+    auto bs32 = rm::make_ode_integrator<2, rm::ButcherBS32>(f);
+    bs32.setTolerance(1e-9, 1e-12);
+    bs32.init(0, {1, -1}, 0.1);
+    auto res_bs32 = bs32.integrate(1);
+    EXPECT_NEAR(res_bs32[0], real_x1, 1e-7);
+    EXPECT_NEAR(res_bs32[1], real_x2, 1e-7);
+    // 高阶方法所需的步数更少
+    EXPECT_LT(dp54.accepted(), bs32.accepted());
+
+
+    // 稠密输出
+    auto expo = rm::make_ode_integrator<1>([](double, const std::array<double, 1> &x) { return x; });
+    expo.init(0, {1}, 0.1);
+    expo.step();
+    double t1 = expo.t();
+    for (double r : {0.25, 0.5, 0.75})
+        EXPECT_NEAR(expo.dense(r * t1)[0], std::exp(r * t1), 1e-6);
+}
+
+TEST(NumberCalculation, ode_integrator_until)
+{
+    // 真空中的抛体运动，状态量为 [x, vx, y, vy]
+    constexpr double g = 9.8, v = 20, theta = 0.3;
+    auto f = [](double, const std::array<double, 4> &s) { return std::array<double, 4>{s[1], 0, s[3], -g}; };
+    auto integrator = rm::make_ode_integrator<4>(f);
+    integrator.init(0, {0, v * std::cos(theta), 0, v * std::sin(theta)}, 0.01);
+    // 在水平距离到达 8 m 时停止
+    ASSERT_TRUE(integrator.until([](double, const std::array<double, 4> &s) { return s[0] >= 8; }, 10));
+    double t = 8 / (v * std::cos(theta));
+    EXPECT_NEAR(integrator.t(), t, 1e-10);
+    EXPECT_NEAR(integrator.x()[0], 8, 1e-9);
+    EXPECT_NEAR(integrator.x()[2], v * std::sin(theta) * t - 0.5 * g * t * t, 1e-9);
+    // 事件未在上限前发生
+    EXPECT_FALSE(integrator.until([](double, const std::array<double, 4> &s) { return s[0] >= 1000; }, 5));
+    EXPECT_EQ(integrator.t(), 5);
+}
+
+TEST(NumberCalculation, ode_integrator_bad_step)
+{
+    auto f = [](double, const std::array<double, 1> &x) { return x; };
+    auto integrator = rm::make_ode_integrator<1, rm::ButcherRK4>(f);
+    // 未设置初值时步长为 0
+    EXPECT_THROW(integrator.step(), rm::Exception);
+    EXPECT_THROW(integrator.integrate(1), rm::Exception);
+    EXPECT_THROW(integrator.init(0, {1}, 0), rm::Exception);
+    EXPECT_THROW(integrator.init(0, {1}, -0.01), rm::Exception);
+    EXPECT_THROW(integrator.init(0, {1}, std::nan("")), rm::Exception);
+    integrator.init(0, {1}, 0.01);
+    integrator.integrate(0.5);
+    EXPECT_THROW(integrator.step(0.2), rm::Exception);
+    EXPECT_NEAR(integrator.x()[0], std::exp(0.5), 1e-9);
+}
+
 #if __cpp_lib_generator >= 202207L
 TEST(NumberCalculation, runge_kutta_ode_generator)
 {
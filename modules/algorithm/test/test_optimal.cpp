@@ -13,6 +13,7 @@
 #include <gtest/gtest.h>
 
 #include <rmvl/algorithm/numcal.hpp>
+#include <rmvl/core/util.hpp>
 
 namespace rm_test
 {
@@ -99,6 +100,13 @@ TEST(Optimal, fmincon_inequality_con)
     EXPECT_NEAR(fval, 8, 1e-3);
 }
 
+// 待拟合曲线: 0.8sin(1.9FPSx) + 2.09 - 0.8
+static inline double real_f(double x)
+{
+    constexpr double FPS = 100;
+    return 0.8 * std::sin(1.9 / FPS * x - 0.2) + 1.29;
+}
+
 #ifdef HAVE_OPENCV
 
 static inline double lsq_linear1(const std::vector<double> &x) { return x[0] + x[1] - 6; }
@@ -117,13 +125,6 @@ TEST(Optimal, lsqnonlin_linear)
     EXPECT_NEAR(x[1], 1, 1e-3);
 }
 
-// 待拟合曲线: 0.8sin(1.9FPSx) + 2.09 - 0.8
-static inline double real_f(double x)
-{
-    constexpr double FPS = 100;
-    return 0.8 * std::sin(1.9 / FPS * x - 0.2) + 1.29;
-}
-
 TEST(Optimal, lsqnonlin_sine)
 {
     rm::FuncNds lsq_sine(5);
@@ -172,4 +173,215 @@ TEST(Optimal, lsqnonlinRKF_sine)
 
 #endif // HAVE_OPENCV
 
+TEST(Optimal, lsqnonlinVec_sine)
+{
+    auto residual = [](const double *x, double *r) {
+        for (int i = 0; i < 5; ++i)
+            r[i] = x[0] * std::sin(x[1] * i + x[2]) + x[3] - real_f(i);
+    };
+    auto jacobian = [](const double *x, double *J) {
+        for (int i = 0; i < 5; ++i, J += 4)
+        {
+            double s = std::sin(x[1] * i + x[2]), c = std::cos(x[1] * i + x[2]);
+            J[0] = s, J[1] = x[0] * c * i, J[2] = x[0] * c, J[3] = 1;
+        }
+    };
+    for (auto mode : {rm::LsqMode::GN, rm::LsqMode::LM})
+    {
+        rm::OptimalOptions options;
+        options.lsq_mode = mode;
+        options.max_iter = mode == rm::LsqMode::GN ? 50 : 2000;
+        for (bool analytic : {false, true})
+        {
+            auto x = rm::lsqnonlinVec(residual, 5, {1, 0.02, 0, 1.09}, options, analytic ? rm::JacobianFunc(jacobian) : nullptr);
+            EXPECT_NEAR(x[0], 0.8, 1e-4);
+            EXPECT_NEAR(x[1], 0.019, 1e-4);
+            EXPECT_NEAR(x[2], -0.2, 1e-4);
+            EXPECT_NEAR(x[3], 2.09 - 0.8, 1e-4);
+        }
+    }
+}
+
+TEST(Optimal, lsqnonlinVec_blocks)
+{
+    // 多段观测共享振幅与角频率 [A, ω]，每段观测的相位与偏置 [φ_k, b_k] 相互独立
+    constexpr int K = 6, N = 20;
+    auto y = [](int k, int i) { return 0.8 * std::sin(1.9 * i / 10. + 0.3 * k) + 1.2 + 0.1 * k; };
+    auto residual = [&](const double *x, double *r) {
+        for (int k = 0; k < K; ++k)
+            for (int i = 0; i < N; ++i)
+                *r++ = x[0] * std::sin(x[1] * i / 10. + x[2 + 2 * k]) + x[3 + 2 * k] - y(k, i);
+    };
+    std::vector<rm::LsqBlock> blocks(K);
+    std::vector<double> x0 = {1, 2};
+    for (std::size_t k = 0; k < K; ++k)
+    {
+        blocks[k] = {N, {0, 1, 2 + 2 * k, 3 + 2 * k}};
+        x0.push_back(0.3 * k + 0.1);
+        x0.push_back(1);
+    }
+    rm::OptimalOptions options;
+    options.lsq_mode = rm::LsqMode::LM;
+    options.max_iter = 200;
+    auto dense = rm::lsqnonlinVec(residual, K * N, x0, options);
+    auto sparse = rm::lsqnonlinVec(residual, K * N, x0, options, nullptr, blocks);
+    EXPECT_NEAR(sparse[0], 0.8, 1e-4);
+    EXPECT_NEAR(sparse[1], 1.9, 1e-4);
+    for (int k = 0; k < K; ++k)
+    {
+        EXPECT_NEAR(sparse[2 + 2 * k], 0.3 * k, 1e-4);
+        EXPECT_NEAR(sparse[3 + 2 * k], 1.2 + 0.1 * k, 1e-4);
+    }
+    for (std::size_t i = 0; i < x0.size(); ++i)
+        EXPECT_NEAR(dense[i], sparse[i], 1e-6);
+    // 残差块需要覆盖全部残差
+    blocks.pop_back();
+    EXPECT_THROW(rm::lsqnonlinVec(residual, K * N, x0, options, nullptr, blocks), rm::Exception);
+}
+
+TEST(Optimal, lsq_solver_reuse)
+{
+    // 同一求解器依次拟合相位不同的数据
+    double phase{};
+    rm::ResidualFunc residual = [&](const double *x, double *r) {
+        for (int i = 0; i < 20; ++i)
+            r[i] = x[0] * std::sin(0.19 * i + x[1]) + x[2] - (0.8 * std::sin(0.19 * i + phase) + 1.29);
+    };
+    rm::OptimalOptions options;
+    options.lsq_mode = rm::LsqMode::LM;
+    options.max_iter = 200;
+    rm::LsqSolver solver(20, 3);
+    for (phase = -0.4; phase < 0.45; phase += 0.2)
+    {
+        const auto &x = solver.solve(residual, {1, 0, 1}, options);
+        EXPECT_NEAR(x[0], 0.8, 1e-4);
+        EXPECT_NEAR(x[1], phase, 1e-4);
+        EXPECT_NEAR(x[2], 1.29, 1e-4);
+    }
+    EXPECT_THROW(solver.solve(residual, {1, 0}), rm::Exception);
+}
+
+TEST(Optimal, fminunc_parallel)
+{
+    // 6 维二次函数，并行计算的结果应与串行计算完全一致
+    auto func = [](const std::vector<double> &x) {
+        double sum{};
+        for (std::size_t i = 0; i < x.size(); ++i)
+            sum += (i + 1) * (x[i] - 0.5 * i) * (x[i] - 0.5 * i) + 0.1 * x[i] * x[(i + 1) % x.size()];
+        return sum;
+    };
+    std::vector<double> x0{1, -1, 2, 0, 3, -2};
+    for (auto mode : {rm::FminMode::ConjGrad, rm::FminMode::Simplex})
+    {
+        rm::OptimalOptions options;
+        options.fmin_mode = mode;
+        auto [x_serial, fval_serial] = rm::fminunc(func, x0, options);
+        options.parallel = true;
+        auto [x_parallel, fval_parallel] = rm::fminunc(func, x0, options);
+        EXPECT_EQ(x_serial, x_parallel);
+        EXPECT_EQ(fval_serial, fval_parallel);
+    }
+}
+
+TEST(Optimal, lsqnonlinVec_parallel)
+{
+    // 两段正弦信号，共 6 个参数
+    rm::ResidualFunc residual = [](const double *x, double *r) {
+        for (int i = 0; i < 20; ++i)
+        {
+            r[i] = x[0] * std::sin(0.19 * i + x[1]) + x[2] - (0.8 * std::sin(0.19 * i + 0.3) + 1.29);
+            r[20 + i] = x[3] * std::sin(0.23 * i + x[4]) + x[5] - (1.2 * std::sin(0.23 * i - 0.2) + 0.5);
+        }
+    };
+    std::vector<rm::LsqBlock> blocks{{20, {0, 1, 2}}, {20, {3, 4, 5}}};
+    for (auto mode : {rm::LsqMode::GN, rm::LsqMode::LM})
+    {
+        rm::OptimalOptions options;
+        options.lsq_mode = mode;
+        options.max_iter = 200;
+        for (const auto &b : {std::vector<rm::LsqBlock>{}, blocks})
+        {
+            rm::LsqSolver solver(40, 6, b);
+            auto x_serial = solver.solve(residual, {1, 0, 1, 1, 0, 1}, options);
+            options.parallel = true;
+            auto x_parallel = solver.solve(residual, {1, 0, 1, 1, 0, 1}, options);
+            options.parallel = false;
+            EXPECT_EQ(x_serial, x_parallel);
+            EXPECT_NEAR(x_parallel[4], -0.2, 1e-4);
+        }
+    }
+}
+
+TEST(Optimal, fminuncN)
+{
+    auto quadratic2 = [](const std::array<double, 2> &x) { return 60 - 10 * x[0] - 4 * x[1] + x[0] * x[0] + x[1] * x[1] - x[0] * x[1]; };
+    auto [x, fval] = rm::fminuncN<2>(quadratic2, {0, 0});
+    EXPECT_NEAR(x[0], 8, 1e-4);
+    EXPECT_NEAR(x[1], 6, 1e-4);
+    EXPECT_NEAR(fval, 8, 1e-4);
+
+    rm::OptimalOptions options;
+    options.fmin_mode = rm::FminMode::Simplex;
+    auto rosenbrock2 = [](const std::array<double, 2> &x) { return rosenbrock({x[0], x[1]}); };
+    auto [xs, fs] = rm::fminuncN<2>(rosenbrock2, {1, -2}, options);
+    EXPECT_NEAR(xs[0], 1, 1e-2);
+    EXPECT_NEAR(xs[1], 1, 1e-2);
+    EXPECT_NEAR(fs, 0, 1e-2);
+}
+
+TEST(Optimal, fminconN)
+{
+    auto quadratic2 = [](const std::array<double, 2> &x) { return quadratic({x[0], x[1]}); };
+    auto none = [](const std::array<double, 2> &) { return std::array<double, 0>{}; };
+    // 等式约束 x1 + x2 = 10
+    rm::OptimalOptions options;
+    options.tol = 1e-3;
+    options.exterior = 1e2;
+    auto eq = [](const std::array<double, 2> &x) { return std::array{x[0] + x[1] - 10}; };
+    auto [x, fval] = rm::fminconN<2>(quadratic2, {0, 0}, none, eq, options);
+    EXPECT_NEAR(x[0], 6, 1e-2);
+    EXPECT_NEAR(x[1], 4, 1e-2);
+    EXPECT_NEAR(fval, 12, 1e-2);
+    // 不起作用的不等式约束
+    auto le = [](const std::array<double, 2> &x) { return std::array{-x[0] - x[1] + 10, 2 * x[0] + x[1] - 30}; };
+    auto [x2, fval2] = rm::fminconN<2>(quadratic2, {5, 5}, le, none);
+    EXPECT_NEAR(x2[0], 8, 1e-3);
+    EXPECT_NEAR(x2[1], 6, 1e-3);
+    EXPECT_NEAR(fval2, 8, 1e-3);
+}
+
+TEST(Optimal, lsqnonlinN)
+{
+    auto residual = [](const std::array<double, 4> &x) {
+        std::array<double, 5> r{};
+        for (int i = 0; i < 5; ++i)
+            r[i] = x[0] * std::sin(x[1] * i + x[2]) + x[3] - real_f(i);
+        return r;
+    };
+    auto jacobian = [](const std::array<double, 4> &x) {
+        std::array<std::array<double, 4>, 5> J{};
+        for (int i = 0; i < 5; ++i)
+        {
+            double s = std::sin(x[1] * i + x[2]), c = std::cos(x[1] * i + x[2]);
+            J[i] = {s, x[0] * c * i, x[0] * c, 1};
+        }
+        return J;
+    };
+    for (auto mode : {rm::LsqMode::GN, rm::LsqMode::LM})
+    {
+        rm::OptimalOptions options;
+        options.lsq_mode = mode;
+        options.max_iter = mode == rm::LsqMode::GN ? 50 : 2000;
+        auto x = rm::lsqnonlinN<4>(residual, {1, 0.02, 0, 1.09}, options);
+        auto xj = rm::lsqnonlinN<4>(residual, {1, 0.02, 0, 1.09}, options, jacobian);
+        for (const auto &v : std::array{x, xj})
+        {
+            EXPECT_NEAR(v[0], 0.8, 1e-4);
+            EXPECT_NEAR(v[1], 0.019, 1e-4);
+            EXPECT_NEAR(v[2], -0.2, 1e-4);
+            EXPECT_NEAR(v[3], 2.09 - 0.8, 1e-4);
+        }
+    }
+}
+
 } // namespace rm_test
@@ -17,6 +17,7 @@
 
 #ifdef HAVE_RMVL_CAMERA
 #include "camera/camutils.hpp"
+#include "camera/camera_group.hpp"
 
 #ifdef HAVE_RMVL_MV_CAMERA
 #include "camera/mv_camera.h"
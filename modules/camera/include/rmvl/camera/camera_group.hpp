@@ -0,0 +1,255 @@
+/**
+ * @file camera_group.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 多相机同步采集
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+
+#include "rmvl/core/rmvldef.hpp"
+
+namespace rm
+{
+
+//! @addtogroup camera
+//! @{
+
+/**
+ * @brief 虚拟相机，按照固定帧率产生图像，接口与 `MvCamera`、`HikCamera`、`OptCamera` 一致，用于在没有相机硬件时测试采集流程
+ * @note
+ * - 第 `k` 帧的曝光时间点为 `phase + k / fps`（`Timer::now()` 时基），在曝光结束 `latency` 秒后才能被读取，`timestamp()`
+ *   返回曝光时间点
+ * - 读取不及时的帧会被新帧覆盖，与相机 SDK 的缓冲区行为一致
+ */
+class RMVL_EXPORTS VirtualCamera
+{
+public:
+    //! 图像生成函数，参数依次为待填充的图像、帧序号
+    using Generator = std::function<void(cv::Mat &, uint64_t)>;
+
+    /**
+     * @brief 创建虚拟相机
+     *
+     * @param[in] fps 帧率
+     * @param[in] phase 首帧的曝光时间点相对于创建时刻的偏移（单位：s），用于模拟不同相机之间的相位差
+     * @param[in] latency 曝光至图像可读取的传输延迟（单位：s）
+     * @param[in] size 图像尺寸
+     */
+    VirtualCamera(double fps, double phase = 0, double latency = 0, cv::Size size = {640, 480});
+
+    /**
+     * @brief 设置图像生成函数，未设置时产生全黑图像
+     *
+     * @param[in] generator 图像生成函数
+     */
+    inline void setGenerator(Generator generator) { _generator = std::move(generator); }
+
+    //! 相机是否打开
+    inline bool isOpened() const { return _opened; }
+
+    /**
+     * @brief 阻塞读取最新的一帧图像
+     *
+     * @param[out] image 输出图像
+     * @return 是否读取成功，相机关闭后返回 `false`
+     */
+    bool read(cv::OutputArray image);
+
+    //! 最近一次读取的图像的曝光时间点（单位：s）
+    inline double timestamp() const { return _timestamp; }
+
+    //! 被新帧覆盖而未被读取的帧数
+    inline uint64_t dropped() const { return _dropped; }
+
+    //! 关闭相机，正在阻塞的 `read` 会在当前帧结束后返回
+    inline void release() { _opened = false; }
+
+private:
+    double _period;                 //!< 帧间隔
+    double _start;                  //!< 首帧的曝光时间点
+    double _latency;                //!< 传输延迟
+    cv::Size _size;                 //!< 图像尺寸
+    Generator _generator;           //!< 图像生成函数
+    uint64_t _next{};               //!< 下一帧的帧序号
+    uint64_t _dropped{};            //!< 被覆盖的帧数
+    double _timestamp{};            //!< 最近一次读取的图像的曝光时间点
+    std::atomic_bool _opened{true}; //!< 相机是否打开
+};
+
+//! 多相机同步采集的统计信息
+struct CameraGroupStats
+{
+    std::size_t sets{};                 //!< 已输出的同步帧组数量
+    std::vector<std::size_t> captured;  //!< 各相机采集的帧数
+    std::vector<std::size_t> discarded; //!< 各相机因无法配对或缓冲区溢出而丢弃的帧数
+    double mean_skew{};                 //!< 同步帧组内时间戳最大差值的均值（单位：s）
+    double max_skew{};                  //!< 同步帧组内时间戳最大差值的最大值（单位：s）
+    double throughput{};                //!< 同步帧组的输出速率（单位：Hz）
+};
+
+/**
+ * @brief 多相机同步采集
+ * @brief
+ * - 每个相机由独立的采集线程并发读取，图像连同时间戳写入各自的缓冲区，`read` 按照时间戳将各相机的图像配对为同步帧组，
+ *   组内各帧的时间戳相差不超过 `tolerance`，无法配对的图像会被丢弃
+ * - 若相机配置为硬触发（`GrabMode::Hardware`）并共用同一路触发信号，各相机在同一时刻曝光，组内时间差仅来自时间戳误差；
+ *   连续采集时，组内时间差最大为帧间隔的一半
+ * - `process` 将同步帧组中的各帧分发至 `cv::parallel_for_` 的共享线程池，每个相机对应一条独立的处理流水线
+ *
+ * @code{.cpp}
+ * rm::CameraGroup cameras(0.003);
+ * cameras.add(long_focus_camera);
+ * cameras.add(wide_camera);
+ * cameras.start();
+ * std::vector<cv::Mat> frames;
+ * std::vector<double> ticks;
+ * while (cameras.read(frames, ticks))
+ * {
+ *     cameras.process(frames, ticks, [&](std::size_t idx, const cv::Mat &frame, double tick) {
+ *         infos[idx] = detectors[idx]->detect(groups[idx], frame, color, gyro_data, tick);
+ *     });
+ * }
+ * @endcode
+ */
+class RMVL_EXPORTS CameraGroup
+{
+public:
+    //! 相机读取函数，参数依次为输出图像、输出的时间戳，返回是否读取成功
+    using Reader = std::function<bool(cv::Mat &, double &)>;
+
+    /**
+     * @brief 创建多相机同步采集
+     *
+     * @param[in] tolerance 同步帧组内允许的最大时间戳差值（单位：s）
+     * @param[in] depth 每个相机的缓冲区容量，溢出时丢弃最旧的图像
+     */
+    explicit CameraGroup(double tolerance = 0.005, std::size_t depth = 4) : _tolerance(tolerance), _depth(depth) {}
+
+    CameraGroup(const CameraGroup &) = delete;
+    CameraGroup &operator=(const CameraGroup &) = delete;
+
+    ~CameraGroup() { stop(); }
+
+    /**
+     * @brief 添加相机，需要在 `start` 之前调用
+     * @note 相机需提供 `read(cv::OutputArray)` 与 `timestamp()` 接口，例如 `MvCamera`、`HikCamera`、`OptCamera`、`VirtualCamera`，
+     *       不满足该接口的可调用对象（例如 lambda 表达式）按照读取函数添加
+     *
+     * @param[in] camera 相机，生命周期需覆盖采集过程
+     * @return 相机在同步帧组中的下标
+     */
+    template <typename Camera, typename = std::void_t<decltype(std::declval<Camera &>().read(std::declval<cv::Mat &>())),
+                                                      decltype(std::declval<Camera &>().timestamp())>>
+    inline std::size_t add(Camera &camera)
+    {
+        return add([&camera](cv::Mat &image, double &tick) {
+            bool ok = camera.read(image);
+            tick = camera.timestamp();
+            return ok;
+        });
+    }
+
+    /**
+     * @brief 以读取函数的形式添加相机，需要在 `start` 之前调用
+     *
+     * @param[in] reader 相机读取函数，在该相机的采集线程中被调用
+     * @return 相机在同步帧组中的下标
+     */
+    std::size_t add(Reader reader);
+
+    //! 相机数量
+    inline std::size_t size() const { return _channels.size(); }
+
+    //! 启动所有相机的采集线程
+    void start();
+
+    //! 停止所有相机的采集线程，采集线程会在当前的 `read` 返回后退出
+    void stop();
+
+    /**
+     * @brief 读取同步帧组
+     *
+     * @param[out] frames 各相机的图像，按照添加的顺序排列
+     * @param[out] ticks 各相机图像的时间戳
+     * @param[in] timeout 最长等待时间（单位：s）
+     * @return 是否在等待时间内读取到同步帧组
+     */
+    bool read(std::vector<cv::Mat> &frames, std::vector<double> &ticks, double timeout = 1);
+
+    /**
+     * @brief 在共享线程池中并行处理同步帧组，每个相机的图像调用一次 `func`
+     * @note `func` 会在多个线程中同时调用，不同相机的处理流水线（例如识别模块、序列组）需相互独立，且 `func` 不应抛出异常
+     *
+     * @param[in] frames 各相机的图像
+     * @param[in] ticks 各相机图像的时间戳
+     * @param[in] func 处理函数，参数依次为相机下标、图像、时间戳
+     */
+    template <typename Func>
+    static void process(const std::vector<cv::Mat> &frames, const std::vector<double> &ticks, Func &&func)
+    {
+        cv::parallel_for_(cv::Range(0, static_cast<int>(frames.size())), [&](const cv::Range &range) {
+            for (int i = range.start; i < range.end; ++i)
+                func(static_cast<std::size_t>(i), frames[i], ticks[i]);
+        });
+    }
+
+    //! 获取统计信息
+    CameraGroupStats stats() const;
+
+private:
+    //! 单个相机的采集通道
+    struct Channel
+    {
+        Reader reader;                                //!< 读取函数
+        std::deque<std::pair<cv::Mat, double>> queue; //!< 已采集、尚未配对的图像及其时间戳
+        std::size_t captured{};                       //!< 采集的帧数
+        std::size_t discarded{};                      //!< 丢弃的帧数
+        std::thread worker;                           //!< 采集线程
+    };
+
+    //! 采集线程
+    void capture(Channel &channel);
+
+    /**
+     * @brief 尝试从各通道的缓冲区中配对出同步帧组，调用前需持有 `_mtx`
+     *
+     * @return 是否配对成功，成功时各通道的队首即为同步帧组
+     */
+    bool match();
+
+    double _tolerance;                               //!< 组内允许的最大时间戳差值
+    std::size_t _depth;                              //!< 缓冲区容量
+    std::vector<std::unique_ptr<Channel>> _channels; //!< 采集通道
+    std::atomic_bool _running{};                     //!< 采集线程是否运行
+    mutable std::mutex _mtx;                         //!< 保护缓冲区与统计信息的互斥锁
+    std::condition_variable _cv;                     //!< 新图像到达的条件变量
+
+    std::size_t _sets{}; //!< 已输出的同步帧组数量
+    double _skew_sum{};  //!< 组内时间戳差值之和
+    double _skew_max{};  //!< 组内时间戳差值的最大值
+    double _start{};     //!< 启动的时间点
+    double _stop{};      //!< 停止的时间点
+};
+
+//! @} camera
+
+} // namespace rm
@@ -180,6 +180,41 @@ private:
     cv::Matx44f _t = cv::Matx44f::eye(); //!< 外参矩阵
 };
 
+/**
+ * @brief 相机时间戳同步器，将相机设备时钟下的帧时间戳映射至主机时钟 `Timer::now()`
+ * @note
+ * - 每帧的主机时间戳与设备时间戳之差为时钟偏移与传输延迟之和，传输延迟非负，因此取历史最小值作为时钟偏移
+ * - 为容忍两个时钟之间的漂移，最小值以 `drift` 的速率随时间向上松弛；设备时间戳回退（例如相机重连）时重新同步
+ */
+class RMVL_EXPORTS TimestampSync
+{
+public:
+    /**
+     * @brief 创建时间戳同步器
+     *
+     * @param[in] drift 允许的最大时钟漂移率，默认为 `100 ppm`
+     */
+    explicit TimestampSync(double drift = 1e-4) : _drift(drift) {}
+
+    /**
+     * @brief 同步一帧图像的时间戳
+     *
+     * @param[in] device 设备时钟下的帧时间戳（单位：s）
+     * @param[in] host 主机在获取到该帧时的时间戳，一般为 `Timer::now()`（单位：s）
+     * @return 主机时钟下的帧时间戳（单位：s）
+     */
+    double operator()(double device, double host);
+
+    //! 重置同步器
+    inline void reset() { _synced = false; }
+
+private:
+    double _drift;         //!< 时钟漂移率
+    double _offset{};      //!< 主机时钟与设备时钟的偏移量
+    double _last_device{}; //!< 上一帧的设备时间戳
+    bool _synced{};        //!< 是否已同步
+};
+
 //! @} camera
 
 } // namespace rm
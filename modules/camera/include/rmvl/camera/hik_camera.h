@@ -117,6 +117,13 @@ public:
         return *this;
     }
 
+    /**
+     * @brief 获取最近一次成功读取的图像的捕获时间戳，与 `Timer::now()` 使用相同的时基，可作为组合体的时间点
+     *
+     * @return 捕获时间戳（单位：s）
+     */
+    RMVL_W double timestamp() const;
+
     /**
      * @brief 相机重连
      *
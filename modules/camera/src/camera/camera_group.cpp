@@ -0,0 +1,202 @@
+/**
+ * @file camera_group.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 多相机同步采集
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include "rmvl/camera/camera_group.hpp"
+#include "rmvl/core/timer.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm
+{
+
+using namespace std::chrono_literals;
+
+VirtualCamera::VirtualCamera(double fps, double phase, double latency, cv::Size size)
+    : _period(1. / fps), _start(Timer::now() + phase), _latency(latency), _size(size)
+{
+    if (fps <= 0)
+        RMVL_Error_(RMVL_StsBadArg, "Bad argument of the \"fps\", fps = %f", fps);
+}
+
+bool VirtualCamera::read(cv::OutputArray image)
+{
+    if (!_opened)
+        return false;
+    // 已完成传输的最新一帧，更早的未读取的帧均被覆盖
+    double now = Timer::now();
+    double ready = (now - _latency - _start) / _period;
+    if (ready >= 0)
+    {
+        auto newest = static_cast<uint64_t>(std::floor(ready));
+        if (newest > _next)
+        {
+            _dropped += newest - _next;
+            _next = newest;
+        }
+    }
+    // 等待该帧完成传输
+    double exposure = _start + static_cast<double>(_next) * _period;
+    if (exposure + _latency > now)
+        std::this_thread::sleep_for(std::chrono::duration<double>(exposure + _latency - now));
+    cv::Mat img = cv::Mat::zeros(_size, CV_8UC3);
+    if (_generator)
+        _generator(img, _next);
+    image.assign(img);
+    _timestamp = exposure;
+    ++_next;
+    return _opened;
+}
+
+std::size_t CameraGroup::add(Reader reader)
+{
+    if (_running)
+        RMVL_Error(RMVL_StsError, "Cameras can not be added while the camera group is running");
+    auto p_channel = std::make_unique<Channel>();
+    p_channel->reader = std::move(reader);
+    _channels.push_back(std::move(p_channel));
+    return _channels.size() - 1;
+}
+
+void CameraGroup::start()
+{
+    if (_running.exchange(true))
+        return;
+    {
+        std::lock_guard lk(_mtx);
+        for (auto &p_channel : _channels)
+        {
+            p_channel->queue.clear();
+            p_channel->captured = p_channel->discarded = 0;
+        }
+        _sets = 0;
+        _skew_sum = _skew_max = 0;
+        _start = Timer::now();
+    }
+    for (auto &p_channel : _channels)
+        p_channel->worker = std::thread(&CameraGroup::capture, this, std::ref(*p_channel));
+}
+
+void CameraGroup::stop()
+{
+    if (!_running.exchange(false))
+        return;
+    _cv.notify_all();
+    for (auto &p_channel : _channels)
+        if (p_channel->worker.joinable())
+            p_channel->worker.join();
+    std::lock_guard lk(_mtx);
+    _stop = Timer::now();
+}
+
+void CameraGroup::capture(Channel &channel)
+{
+    while (_running)
+    {
+        cv::Mat image;
+        double tick{};
+        if (!channel.reader(image, tick))
+        {
+            // 读取失败时短暂等待，避免相机断开时空转
+            std::this_thread::sleep_for(1ms);
+            continue;
+        }
+        {
+            std::lock_guard lk(_mtx);
+            channel.queue.emplace_back(std::move(image), tick);
+            ++channel.captured;
+            if (channel.queue.size() > _depth)
+            {
+                channel.queue.pop_front();
+                ++channel.discarded;
+            }
+        }
+        _cv.notify_all();
+    }
+}
+
+bool CameraGroup::match()
+{
+    while (true)
+    {
+        for (const auto &p_channel : _channels)
+            if (p_channel->queue.empty())
+                return false;
+        // 各通道最旧图像的最大时间戳，其余通道中比它早 tolerance 以上的图像已无法配对
+        double pivot = -std::numeric_limits<double>::infinity();
+        for (const auto &p_channel : _channels)
+            pivot = std::max(pivot, p_channel->queue.front().second);
+        bool discarded = false;
+        for (auto &p_channel : _channels)
+        {
+            auto &queue = p_channel->queue;
+            // 丢弃无法配对的图像，以及下一帧更接近 pivot 时的当前帧
+            while (!queue.empty() && (queue.front().second < pivot - _tolerance ||
+                                      (queue.size() > 1 && std::abs(queue[1].second - pivot) < std::abs(queue.front().second - pivot))))
+            {
+                queue.pop_front();
+                ++p_channel->discarded;
+                discarded = true;
+            }
+        }
+        // 未发生丢弃时，各通道的队首均位于 [pivot - tolerance, pivot] 内
+        if (!discarded)
+            return true;
+    }
+}
+
+bool CameraGroup::read(std::vector<cv::Mat> &frames, std::vector<double> &ticks, double timeout)
+{
+    if (_channels.empty())
+        RMVL_Error(RMVL_StsBadSize, "The camera group is empty");
+    std::unique_lock lk(_mtx);
+    if (!_cv.wait_for(lk, std::chrono::duration<double>(timeout), [this] { return !_running || match(); }) || !_running)
+        return false;
+    frames.resize(_channels.size());
+    ticks.resize(_channels.size());
+    double lo = std::numeric_limits<double>::infinity(), hi = -lo;
+    for (std::size_t i = 0; i < _channels.size(); ++i)
+    {
+        auto &queue = _channels[i]->queue;
+        frames[i] = std::move(queue.front().first);
+        ticks[i] = queue.front().second;
+        queue.pop_front();
+        lo = std::min(lo, ticks[i]);
+        hi = std::max(hi, ticks[i]);
+    }
+    ++_sets;
+    _skew_sum += hi - lo;
+    _skew_max = std::max(_skew_max, hi - lo);
+    return true;
+}
+
+CameraGroupStats CameraGroup::stats() const
+{
+    std::lock_guard lk(_mtx);
+    CameraGroupStats retval;
+    retval.sets = _sets;
+    for (const auto &p_channel : _channels)
+    {
+        retval.captured.push_back(p_channel->captured);
+        retval.discarded.push_back(p_channel->discarded);
+    }
+    if (_sets > 0)
+        retval.mean_skew = _skew_sum / static_cast<double>(_sets);
+    retval.max_skew = _skew_max;
+    double elapsed = (_running ? Timer::now() : _stop) - _start;
+    if (elapsed > 0)
+        retval.throughput = static_cast<double>(_sets) / elapsed;
+    return retval;
+}
+
+} // namespace rm
@@ -9,6 +9,8 @@
  *
  */
 
+#include <algorithm>
+
 #include <Eigen/Dense>
 
 #include <opencv2/calib3d.hpp>
@@ -64,3 +66,14 @@ void rm::CameraExtrinsics::R(const cv::Matx33f &R)
     _pitch = rad2deg(euler_angles[1]);
     _yaw = rad2deg(euler_angles[0]);
 }
+
+double rm::TimestampSync::operator()(double device, double host)
+{
+    double offset = host - device;
+    if (!_synced || device < _last_device)
+        _offset = offset, _synced = true;
+    else
+        _offset = std::min(_offset + _drift * (device - _last_device), offset);
+    _last_device = device;
+    return device + _offset;
+}
@@ -14,6 +14,8 @@
 
 #include <opencv2/imgproc.hpp>
 
+#include "rmvl/core/timer.hpp"
+
 #include "hik_camera_impl.h"
 
 namespace rm
@@ -25,6 +27,7 @@ HikCamera::HikCamera(CameraConfig init_mode, std::string_view serial) : _impl(ne
 bool HikCamera::set(int propId, double value) { return _impl->set(propId, value); }
 double HikCamera::get(int propId) const { return _impl->get(propId); }
 bool HikCamera::read(cv::OutputArray image) { return _impl->read(image); }
+double HikCamera::timestamp() const { return _impl->timestamp(); }
 bool HikCamera::isOpened() const { return _impl->isOpened(); }
 bool HikCamera::reconnect() { return _impl->reconnect(); }
 
@@ -146,6 +149,14 @@ bool HikCamera::Impl::open() noexcept
             return false;
         }
     }
+    // ------------------- 设备时间戳单位 --------------------
+    // GigE 相机由 GevTimestampTickFrequency 给出时钟频率，USB3 Vision 相机的时间戳固定以 ns 为单位
+    MVCC_INTVALUE tick_freq{};
+    if (MV_CC_GetIntValue(_handle, "GevTimestampTickFrequency", &tick_freq) == MV_OK && tick_freq.nCurValue > 0)
+        _tick_period = 1. / tick_freq.nCurValue;
+    else
+        _tick_period = 1e-9;
+    _sync.reset();
     // ----------------------- 开始取流 -----------------------
     ret = MV_CC_StartGrabbing(_handle);
     if (ret != MV_OK)
@@ -248,7 +259,13 @@ bool HikCamera::Impl::read(cv::OutputArray image) noexcept
     // 获取图像地址
     auto ret = MV_CC_GetImageBuffer(_handle, &_p_out, 1000);
     if (ret == MV_OK)
+    {
+        // 使用设备时间戳，并映射至主机时钟，避免将 SDK 取流、排队的延迟计入捕获时间戳
+        const auto &info = _p_out.stFrameInfo;
+        uint64_t dev_tick = (static_cast<uint64_t>(info.nDevTimeStampHigh) << 32) | info.nDevTimeStampLow;
+        _timestamp = _sync(dev_tick * _tick_period, Timer::now());
         retrieve(image, _init_mode.retrieve_mode);
+    }
     else
     {
         WARNING_("hik - No data in getting image buffer");
@@ -30,6 +30,9 @@ class HikCamera::Impl
     // -------------------------- 图像信息 --------------------------
     MV_FRAME_OUT _p_out;          //!< 输出图像的数据及信息
     std::vector<uchar> _p_dstbuf; //!< 输出数据缓存
+    double _tick_period{1e-9};    //!< 设备时间戳的单位（单位：s）
+    TimestampSync _sync;          //!< 设备时间戳同步器
+    double _timestamp{};          //!< 主机时钟下的捕获时间戳
 
 public:
     /**
@@ -63,6 +66,9 @@ public:
     //! 相机是否打开
     inline bool isOpened() const noexcept { return _opened; }
 
+    //! 捕获时间戳
+    inline double timestamp() const noexcept { return _timestamp; }
+
     //! 释放相机资源
     void release() noexcept;
 
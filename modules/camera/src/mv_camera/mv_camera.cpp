@@ -25,6 +25,7 @@ bool MvCamera::set(int propId, double value) { return _impl->set(propId, value);
 double MvCamera::get(int propId) const { return _impl->get(propId); }
 bool MvCamera::isOpened() const { return _impl->isOpened(); }
 bool MvCamera::read(cv::OutputArray image) { return _impl->read(image); }
+double MvCamera::timestamp() const { return _impl->timestamp(); }
 bool MvCamera::reconnect() { return _impl->reconnect(); }
 
 MvCamera::Impl::Impl(CameraConfig init_mode, std::string_view serial) noexcept
@@ -182,6 +183,7 @@ bool MvCamera::Impl::reconnect() noexcept
     INFO_("mv - camera device reconnect");
     release();
     std::this_thread::sleep_for(100ms);
+    _sync.reset();
 
     // 重置相机数量
     _camera_counts = 8;
@@ -14,6 +14,7 @@
 #include <CameraApi.h>
 
 #include "rmvl/camera/mv_camera.h"
+#include "rmvl/core/timer.hpp"
 
 namespace rm
 {
@@ -36,6 +37,8 @@ class MvCamera::Impl
 
     // ------------------------- 图像信息 -------------------------
     tSdkFrameHead _frame_info;   //!< 图像帧头信息
+    TimestampSync _sync;         //!< 设备时间戳同步器
+    double _timestamp{};         //!< 主机时钟下的捕获时间戳
     int _channel = 3;            //!< 通道数
     bool _auto_exposure = false; //!< 相机自动曝光
     double _exposure = 1200;     //!< 相机设备曝光时间
@@ -62,8 +65,18 @@ public:
     //! 相机是否打开
     inline bool isOpened() const noexcept { return _is_opened; }
 
+    //! 捕获时间戳
+    inline double timestamp() const noexcept { return _timestamp; }
+
     //! 相机采集
-    inline bool grab() noexcept { return CameraGetImageBuffer(_handle, &_frame_info, &_pbyBuffer, 1000) == CAMERA_STATUS_SUCCESS; }
+    inline bool grab() noexcept
+    {
+        if (CameraGetImageBuffer(_handle, &_frame_info, &_pbyBuffer, 1000) != CAMERA_STATUS_SUCCESS)
+            return false;
+        // 设备时间戳的单位为 0.1 ms
+        _timestamp = _sync(_frame_info.uiTimeStamp * 1e-4, Timer::now());
+        return true;
+    }
 
     //! 相机处理
     bool retrieve(cv::OutputArray image) noexcept;
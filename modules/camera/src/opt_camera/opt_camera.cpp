@@ -12,6 +12,8 @@
 #include <opencv2/imgproc.hpp>
 #include <thread>
 
+#include "rmvl/core/timer.hpp"
+
 #include "opt_camera_impl.h"
 
 namespace rm
@@ -24,6 +26,7 @@ bool OptCamera::set(int propId, double value) { return _impl->set(propId, value)
 double OptCamera::get(int propId) const { return _impl->get(propId); }
 bool OptCamera::isOpened() const { return _impl->isOpened(); }
 bool OptCamera::read(cv::OutputArray image) { return _impl->read(image); }
+double OptCamera::timestamp() const { return _impl->timestamp(); }
 bool OptCamera::reconnect() { return _impl->reconnect(); }
 
 /**
@@ -124,6 +127,10 @@ bool OptCamera::Impl::open() noexcept
         ERROR_("opt - Failed to open camera! %s", optGetErrorString(status));
         return false;
     }
+    // 设备时间戳单位，GigE 相机由 GevTimestampTickFrequency 给出时钟频率，USB3 Vision 相机的时间戳固定以 ns 为单位
+    int64_t tick_freq{};
+    _tick_period = OPT_GetIntFeatureValue(_handle, "GevTimestampTickFrequency", &tick_freq) == OPT_OK && tick_freq > 0 ? 1. / tick_freq : 1e-9;
+    _sync.reset();
     // 设置采集方式
     status = OPT_SetEnumFeatureSymbol(_handle, "AcquisitionMode", grab_mode == GrabMode::Continuous ? "Continuous" : "SingleFrame");
     if (status != OPT_OK)
@@ -184,6 +191,8 @@ bool OptCamera::Impl::retrieve(cv::OutputArray image) noexcept
         image.assign(cv::Mat());
         return false;
     }
+    // 使用设备时间戳，并映射至主机时钟，避免将 SDK 取流、排队的延迟计入捕获时间戳
+    _timestamp = _sync(_src_frame.frameInfo.timeStamp * _tick_period, Timer::now());
     // 图像格式
     OPT_FrameInfo &frame_info = _src_frame.frameInfo;
     // 像素格式
@@ -30,7 +30,10 @@ class OptCamera::Impl
     bool _is_opened{};             //!< 相机是否打开
 
     // 图像数据
-    OPT_Frame _src_frame; //!< SDK 直接得到的 Frame 类型指针
+    OPT_Frame _src_frame;      //!< SDK 直接得到的 Frame 类型指针
+    double _tick_period{1e-9}; //!< 设备时间戳的单位（单位：s）
+    TimestampSync _sync;       //!< 设备时间戳同步器
+    double _timestamp{};       //!< 主机时钟下的捕获时间戳
 
 public:
     Impl(CameraConfig init_mode, std::string_view handle_info) noexcept;
@@ -48,6 +51,8 @@ public:
     bool retrieve(cv::OutputArray image) noexcept;
     //! 读取图片
     bool read(cv::OutputArray image) noexcept;
+    //! 捕获时间戳
+    inline double timestamp() const noexcept { return _timestamp; }
     //! 相机设备是否打开
     inline bool isOpened() const noexcept { return _is_opened; }
     //! 释放资源
@@ -0,0 +1,120 @@
+/**
+ * @file test_camera_group.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 多相机同步采集单元测试
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <atomic>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/camera/camera_group.hpp"
+
+namespace rm_test
+{
+
+TEST(CameraGroupTest, virtual_camera)
+{
+    rm::VirtualCamera camera(100, 0, 0.002, {64, 48});
+    camera.setGenerator([](cv::Mat &img, uint64_t idx) { img.setTo(cv::Scalar::all(static_cast<double>(idx % 256))); });
+    cv::Mat img;
+    ASSERT_TRUE(camera.read(img));
+    EXPECT_EQ(img.size(), cv::Size(64, 48));
+    EXPECT_EQ(img.at<cv::Vec3b>(0, 0)[0], 0);
+    ASSERT_TRUE(camera.read(img));
+    EXPECT_EQ(img.at<cv::Vec3b>(0, 0)[0], 1);
+    // 读取间隔超过帧间隔时，旧帧被覆盖
+    std::this_thread::sleep_for(std::chrono::milliseconds(35));
+    ASSERT_TRUE(camera.read(img));
+    EXPECT_GE(camera.dropped(), 2u);
+    camera.release();
+    EXPECT_FALSE(camera.read(img));
+}
+
+/**
+ * @brief 3 台 100 Hz 的虚拟相机，首帧相位分别为 0、1、2.5 ms，同步帧组的时间差应不超过 2.5 ms，输出速率接近 100 Hz，
+ *        并在共享线程池中为每台相机各调用一次处理函数
+ */
+TEST(CameraGroupTest, same_rate)
+{
+    rm::VirtualCamera cam0(100, 0, 0.001), cam1(100, 0.001, 0.001), cam2(100, 0.0025, 0.001);
+    rm::CameraGroup cameras(0.004);
+    EXPECT_EQ(cameras.add(cam0), 0u);
+    EXPECT_EQ(cameras.add(cam1), 1u);
+    EXPECT_EQ(cameras.add(cam2), 2u);
+    cameras.start();
+
+    std::vector<cv::Mat> frames;
+    std::vector<double> ticks;
+    std::atomic_size_t calls{};
+    for (int i = 0; i < 30; ++i)
+    {
+        ASSERT_TRUE(cameras.read(frames, ticks));
+        ASSERT_EQ(frames.size(), 3u);
+        EXPECT_LE(*std::max_element(ticks.begin(), ticks.end()) - *std::min_element(ticks.begin(), ticks.end()), 0.004);
+        rm::CameraGroup::process(frames, ticks, [&](std::size_t idx, const cv::Mat &frame, double) {
+            EXPECT_LT(idx, 3u);
+            EXPECT_FALSE(frame.empty());
+            ++calls;
+        });
+    }
+    auto stats = cameras.stats();
+    cameras.stop();
+    EXPECT_EQ(calls, 90u);
+    EXPECT_EQ(stats.sets, 30u);
+    EXPECT_NEAR(stats.mean_skew, 0.0025, 0.0005);
+    EXPECT_LE(stats.max_skew, 0.004);
+    EXPECT_NEAR(stats.throughput, 100, 15);
+}
+
+//! 50 Hz 与 100 Hz 的虚拟相机，同步帧组按照 50 Hz 输出，100 Hz 相机中无法配对的帧被丢弃
+TEST(CameraGroupTest, mixed_rate)
+{
+    rm::VirtualCamera slow(50), fast(100, 0.0005);
+    rm::CameraGroup cameras(0.002);
+    cameras.add(slow);
+    cameras.add(fast);
+    cameras.start();
+
+    std::vector<cv::Mat> frames;
+    std::vector<double> ticks;
+    for (int i = 0; i < 15; ++i)
+    {
+        ASSERT_TRUE(cameras.read(frames, ticks));
+        EXPECT_LE(std::abs(ticks[0] - ticks[1]), 0.002);
+    }
+    auto stats = cameras.stats();
+    cameras.stop();
+    EXPECT_NEAR(stats.throughput, 50, 10);
+    EXPECT_GT(stats.discarded[1], 0u);
+    EXPECT_FALSE(cameras.read(frames, ticks, 0.01));
+}
+
+//! 左值的读取函数按照读取函数添加，而不是被视为相机
+TEST(CameraGroupTest, add_reader)
+{
+    rm::VirtualCamera cam0(100), cam1(100, 0.0005);
+    auto reader = [&cam1](cv::Mat &image, double &tick) {
+        bool ok = cam1.read(image);
+        tick = cam1.timestamp();
+        return ok;
+    };
+    rm::CameraGroup cameras(0.002);
+    EXPECT_EQ(cameras.add(cam0), 0u);
+    EXPECT_EQ(cameras.add(reader), 1u);
+    cameras.start();
+
+    std::vector<cv::Mat> frames;
+    std::vector<double> ticks;
+    ASSERT_TRUE(cameras.read(frames, ticks));
+    EXPECT_EQ(frames.size(), 2u);
+    EXPECT_LE(std::abs(ticks[0] - ticks[1]), 0.002);
+    cameras.stop();
+}
+
+} // namespace rm_test
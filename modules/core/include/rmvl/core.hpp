@@ -29,6 +29,7 @@
 #include <rmvl/rmvl_modules.hpp>
 
 // 通用
+#include "core/deadline.hpp"
 #include "core/io.hpp"
 #include "core/timer.hpp"
 #include "core/util.hpp"
@@ -0,0 +1,196 @@
+/**
+ * @file deadline.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 帧截止时间策略
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+#include "timer.hpp"
+
+namespace rm
+{
+
+//! @addtogroup core_timer
+//! @{
+
+//! 帧处理方式
+enum class FrameAction : uint8_t
+{
+    Process, //!< 完整处理
+    Degrade, //!< 降级处理，例如缩小识别区域、跳过已追踪目标的分类
+    Drop     //!< 丢弃该帧，转而处理最新的帧
+};
+
+//! 帧截止时间策略的统计信息
+struct DeadlineStats
+{
+    std::size_t processed{}; //!< 完整处理的帧数
+    std::size_t degraded{};  //!< 降级处理的帧数
+    std::size_t dropped{};   //!< 丢弃的帧数
+};
+
+/**
+ * @brief 帧截止时间策略
+ * @brief
+ * - 每帧图像自捕获起拥有固定的处理预算，流水线的各阶段根据帧龄（当前时间与捕获时间点之差）决定处理方式：
+ *   帧龄超过预算时丢弃该帧，超过预算的 `degrade_ratio` 倍时降级处理，否则完整处理
+ * - 相比于让帧在队列中排队，丢弃过期的帧可以使端到端延迟保持有界
+ * @note
+ * - `check` 为只读操作，可在流水线的任意阶段、任意线程调用；统计量使用原子变量，可在其他线程读取
+ */
+class FrameDeadline
+{
+public:
+    /**
+     * @brief 创建帧截止时间策略
+     *
+     * @param[in] budget 每帧的处理预算（单位：s）
+     * @param[in] degrade_ratio 开始降级处理时帧龄占预算的比例，取值范围为 `[0, 1]`
+     */
+    explicit FrameDeadline(double budget, double degrade_ratio = 0.5) : _budget(budget), _degrade(budget * degrade_ratio) {}
+
+    FrameDeadline(const FrameDeadline &) = delete;
+    FrameDeadline &operator=(const FrameDeadline &) = delete;
+
+    /**
+     * @brief 根据帧龄决定帧的处理方式
+     *
+     * @param[in] capture 帧的捕获时间点（单位：s）
+     * @param[in] now 当前时间点（单位：s）
+     * @return 帧处理方式
+     */
+    inline FrameAction check(double capture, double now) const
+    {
+        double age = now - capture;
+        if (age > _budget)
+            return FrameAction::Drop;
+        return age > _degrade ? FrameAction::Degrade : FrameAction::Process;
+    }
+
+    /**
+     * @brief 以 `Timer::now()` 作为当前时间点决定帧的处理方式
+     *
+     * @param[in] capture 帧的捕获时间点（单位：s）
+     * @return 帧处理方式
+     */
+    inline FrameAction check(double capture) const { return check(capture, Timer::now()); }
+
+    /**
+     * @brief 记录一帧的最终处理方式
+     *
+     * @param[in] action 帧处理方式
+     */
+    inline void record(FrameAction action)
+    {
+        switch (action)
+        {
+        case FrameAction::Process:
+            ++_processed;
+            break;
+        case FrameAction::Degrade:
+            ++_degraded;
+            break;
+        default:
+            ++_dropped;
+            break;
+        }
+    }
+
+    //! 获取统计信息
+    inline DeadlineStats stats() const { return {_processed.load(), _degraded.load(), _dropped.load()}; }
+
+    //! 重置统计信息
+    inline void reset() { _processed = _degraded = _dropped = 0; }
+
+    //! 获取每帧的处理预算（单位：s）
+    inline double budget() const { return _budget; }
+
+private:
+    double _budget;                  //!< 处理预算
+    double _degrade;                 //!< 开始降级处理的帧龄
+    std::atomic_size_t _processed{}; //!< 完整处理的帧数
+    std::atomic_size_t _degraded{};  //!< 降级处理的帧数
+    std::atomic_size_t _dropped{};   //!< 丢弃的帧数
+};
+
+/**
+ * @brief 仅保存最新一帧的帧缓冲区，用于连接采集线程与处理线程
+ * @brief
+ * - 采集线程写入的新帧会覆盖尚未被取走的旧帧，处理线程总是取到最新的帧，不会在队列中积压
+ *
+ * @tparam Tp 帧数据类型，例如 `cv::Mat`
+ */
+template <typename Tp>
+class LatestFrame
+{
+public:
+    /**
+     * @brief 写入最新的帧
+     *
+     * @param[in] frame 帧数据
+     * @param[in] tick 帧的捕获时间点（单位：s）
+     * @return 是否覆盖了尚未被取走的旧帧
+     */
+    bool push(Tp frame, double tick)
+    {
+        bool overwritten{};
+        {
+            std::lock_guard lk(_mtx);
+            overwritten = _ready;
+            _frame = std::move(frame);
+            _tick = tick;
+            _ready = true;
+        }
+        if (overwritten)
+            ++_overwritten;
+        _cv.notify_one();
+        return overwritten;
+    }
+
+    /**
+     * @brief 取走最新的帧
+     *
+     * @param[out] frame 帧数据
+     * @param[out] tick 帧的捕获时间点（单位：s）
+     * @param[in] timeout 最长等待时间（单位：s）
+     * @return 是否在等待时间内取到帧
+     */
+    bool pop(Tp &frame, double &tick, double timeout)
+    {
+        std::unique_lock lk(_mtx);
+        if (!_cv.wait_for(lk, std::chrono::duration<double>(timeout), [this] { return _ready; }))
+            return false;
+        frame = std::move(_frame);
+        tick = _tick;
+        _ready = false;
+        return true;
+    }
+
+    //! 被新帧覆盖而未被处理的帧数
+    inline std::size_t overwritten() const { return _overwritten; }
+
+private:
+    std::mutex _mtx;                   //!< 互斥锁
+    std::condition_variable _cv;       //!< 新帧到达的条件变量
+    Tp _frame{};                       //!< 帧数据
+    double _tick{};                    //!< 帧的捕获时间点
+    bool _ready{};                     //!< 是否有尚未被取走的帧
+    std::atomic_size_t _overwritten{}; //!< 被覆盖的帧数
+};
+
+//! @} core_timer
+
+} // namespace rm
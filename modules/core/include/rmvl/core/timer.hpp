@@ -11,7 +11,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
 
 #include "rmvldef.hpp"
 
@@ -51,6 +54,84 @@ private:
 
 inline std::chrono::steady_clock::time_point Timer::_tick = {};
 
+/**
+ * @brief 流水线延迟估计器，记录从图像捕获到控制指令生效的延迟
+ * @brief
+ * - 每发送一次控制指令后调用 `update()`，传入该指令所用图像的捕获时间戳以及指令生效的时间戳
+ * - 预测模块可外推至 `捕获时间戳 + value() + 子弹飞行时间` 的时刻，代替手动标定的固定延迟
+ * @note
+ * - 前若干个样本取算术平均以快速收敛，之后使用系数为 `alpha` 的指数滑动平均跟踪延迟的变化
+ * - 同时估计平均绝对偏差，收敛后偏离均值超过 4 倍偏差的样本在更新前会被截断，以抑制偶发的调度卡顿，截断宽度不小于
+ *   `0.1 ms + 5% × 延迟估计值`
+ */
+class LatencyEstimator
+{
+public:
+    /**
+     * @brief 创建延迟估计器
+     *
+     * @param[in] alpha 指数滑动平均系数，取值范围为 `(0, 1]`，越大跟踪越快、抖动越大
+     */
+    explicit LatencyEstimator(double alpha = 0.05) : _alpha(alpha) {}
+
+    /**
+     * @brief 使用一次实测的延迟更新估计值
+     *
+     * @param[in] capture 图像捕获时间戳，与 `Timer::now()` 使用相同的时基（单位：s）
+     * @param[in] apply 控制指令生效的时间戳，一般为指令发送时的 `Timer::now()` 加上固定的传输时间（单位：s）
+     */
+    inline void update(double capture, double apply)
+    {
+        double sample = apply - capture;
+        // 取反的比较可同时排除 NaN
+        if (!(sample >= 0))
+            return;
+        ++_count;
+        if (_count == 1)
+        {
+            _mean = sample, _dev = 0;
+            return;
+        }
+        double err = sample - _mean;
+        if (_count > WARMUP)
+        {
+            // 截断宽度设有下限，预热样本完全相同（偏差为 0）时估计值仍可跟踪延迟的变化
+            double width = std::max(4 * _dev, CLIP_ABS + CLIP_REL * _mean);
+            err = std::clamp(err, -width, width);
+        }
+        double a = std::max(_alpha, 1.0 / static_cast<double>(_count));
+        _mean += a * err;
+        _dev += a * (std::abs(err) - _dev);
+    }
+
+    /**
+     * @brief 获取延迟估计值
+     *
+     * @param[in] dft 尚无样本时的默认值（单位：s）
+     * @return 延迟估计值（单位：s）
+     */
+    inline double value(double dft = 0) const { return _count > 0 ? _mean : dft; }
+
+    //! 获取延迟的平均绝对偏差（单位：s）
+    inline double deviation() const { return _dev; }
+
+    //! 获取已使用的样本数
+    inline std::size_t count() const { return _count; }
+
+    //! 重置估计器
+    inline void reset() { _mean = _dev = 0, _count = 0; }
+
+private:
+    static constexpr std::size_t WARMUP = 8;  //!< 取算术平均的样本数
+    static constexpr double CLIP_ABS = 1e-4;  //!< 截断宽度下限的绝对部分（单位：s）
+    static constexpr double CLIP_REL = 0.05;  //!< 截断宽度下限相对延迟估计值的比例
+
+    double _alpha;        //!< 指数滑动平均系数
+    double _mean{};       //!< 延迟估计值
+    double _dev{};        //!< 平均绝对偏差
+    std::size_t _count{}; //!< 样本数
+};
+
 //! @} core_timer
 
 } // namespace rm
@@ -0,0 +1,198 @@
+/**
+ * @file test_timer.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 定时、计时模块单元测试
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/deadline.hpp"
+
+namespace rm_test
+{
+
+TEST(LatencyEstimatorTest, default_value)
+{
+    rm::LatencyEstimator latency;
+    EXPECT_EQ(latency.count(), 0u);
+    EXPECT_EQ(latency.value(0.02), 0.02);
+    // 负延迟与 NaN 均被丢弃
+    latency.update(1.0, 0.9);
+    latency.update(1.0, std::nan(""));
+    EXPECT_EQ(latency.count(), 0u);
+    latency.update(1.0, 1.03);
+    EXPECT_EQ(latency.count(), 1u);
+    EXPECT_NEAR(latency.value(), 0.03, 1e-12);
+    latency.reset();
+    EXPECT_EQ(latency.value(), 0);
+}
+
+/**
+ * @brief 回放一段注入了合成延迟的流水线：100 Hz 捕获，延迟为 30 ms 基准 + ±3 ms 抖动，每 97 帧出现一次 40 ms
+ *        的调度卡顿，第 500 帧起基准延迟变为 45 ms。目标以 2 m/s 匀速运动，每帧外推至指令生效时刻后的子弹飞行时间，
+ *        分别使用延迟估计值与手动标定的 30 ms 固定延迟，对比外推误差
+ */
+TEST(LatencyEstimatorTest, replay_with_injected_latency)
+{
+    constexpr double fps = 100, speed = 2, tof = 0.2, fixed_delay = 0.03;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> jitter(-0.003, 0.003);
+    auto position = [&](double t) { return speed * t; };
+
+    rm::LatencyEstimator latency;
+    double est_err2{}, fixed_err2{};
+    std::size_t samples{};
+    for (int i = 0; i < 1000; ++i)
+    {
+        double capture = i / fps;
+        double base = i < 500 ? 0.03 : 0.045;
+        bool stall = i % 97 == 96;
+        double real = base + jitter(rng) + (stall ? 0.04 : 0);
+        // 外推至 捕获时间戳 + 延迟 + 子弹飞行时间
+        double truth = position(capture + real + tof);
+        double est = position(capture) + speed * (latency.value(fixed_delay) + tof);
+        double fixed = position(capture) + speed * (fixed_delay + tof);
+        // 统计稳态（第 650 帧之后）的非卡顿帧
+        if (i >= 650 && !stall)
+        {
+            est_err2 += (est - truth) * (est - truth);
+            fixed_err2 += (fixed - truth) * (fixed - truth);
+            ++samples;
+        }
+        double last = latency.value();
+        latency.update(capture, capture + real);
+        // 收敛后单次卡顿对估计值的影响有限
+        if (stall && i > 100)
+        {
+            EXPECT_LT(latency.value() - last, 0.002);
+        }
+        if (i == 499)
+        {
+            EXPECT_NEAR(latency.value(), 0.03, 0.002);
+        }
+    }
+    EXPECT_NEAR(latency.value(), 0.045, 0.002);
+    EXPECT_GT(latency.deviation(), 0);
+    double est_rms = std::sqrt(est_err2 / samples), fixed_rms = std::sqrt(fixed_err2 / samples);
+    // 基准延迟改变后，固定延迟的外推误差约为 2 m/s × 15 ms = 30 mm
+    EXPECT_GT(fixed_rms, 0.025);
+    EXPECT_LT(est_rms, 0.006);
+}
+
+// 预热样本完全相同时偏差为 0，截断宽度的下限保证估计值仍能跟踪延迟的阶跃
+TEST(LatencyEstimatorTest, constant_warmup)
+{
+    rm::LatencyEstimator latency;
+    for (int i = 0; i < 20; ++i)
+        latency.update(i * 0.01, i * 0.01 + 0.03);
+    EXPECT_NEAR(latency.value(), 0.03, 1e-12);
+    EXPECT_LT(latency.deviation(), 1e-12);
+    for (int i = 20; i < 120; ++i)
+        latency.update(i * 0.01, i * 0.01 + 0.045);
+    EXPECT_NEAR(latency.value(), 0.045, 0.001);
+}
+
+TEST(FrameDeadlineTest, check)
+{
+    rm::FrameDeadline deadline(0.01, 0.5);
+    EXPECT_EQ(deadline.check(1.0, 1.004), rm::FrameAction::Process);
+    EXPECT_EQ(deadline.check(1.0, 1.006), rm::FrameAction::Degrade);
+    EXPECT_EQ(deadline.check(1.0, 1.011), rm::FrameAction::Drop);
+    deadline.record(rm::FrameAction::Process);
+    deadline.record(rm::FrameAction::Degrade);
+    deadline.record(rm::FrameAction::Drop);
+    deadline.record(rm::FrameAction::Drop);
+    auto stats = deadline.stats();
+    EXPECT_EQ(stats.processed, 1u);
+    EXPECT_EQ(stats.degraded, 1u);
+    EXPECT_EQ(stats.dropped, 2u);
+    deadline.reset();
+    EXPECT_EQ(deadline.stats().dropped, 0u);
+}
+
+TEST(FrameDeadlineTest, latest_frame)
+{
+    rm::LatestFrame<int> latest;
+    int frame{};
+    double tick{};
+    EXPECT_FALSE(latest.pop(frame, tick, 0));
+    EXPECT_FALSE(latest.push(1, 0.1));
+    EXPECT_TRUE(latest.push(2, 0.2));
+    EXPECT_TRUE(latest.pop(frame, tick, 0));
+    EXPECT_EQ(frame, 2);
+    EXPECT_EQ(tick, 0.2);
+    EXPECT_EQ(latest.overwritten(), 1u);
+    EXPECT_FALSE(latest.pop(frame, tick, 0));
+}
+
+/**
+ * @brief 虚拟相机以 1 kHz 产生图像，传输延迟随机取 0.5、2.5、5 ms，处理线程完整处理一帧耗时 3 ms，降级处理耗时 1 ms，
+ *        每帧预算 4 ms。处理线程总是取最新的帧，并按帧龄完整处理、降级处理或丢弃，端到端延迟应保持有界
+ */
+TEST(FrameDeadlineTest, virtual_camera_overload)
+{
+    using namespace std::chrono_literals;
+    constexpr double budget = 0.004, full_cost = 0.003;
+    rm::FrameDeadline deadline(budget, 0.5);
+    rm::LatestFrame<int> latest;
+
+    std::atomic_bool stop{};
+    std::size_t produced{};
+    std::thread camera([&] {
+        constexpr double transfer[] = {0.0005, 0.0025, 0.005};
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> pick(0, 2);
+        for (int i = 0; !stop; ++i, ++produced)
+        {
+            latest.push(i, rm::Timer::now() - transfer[pick(rng)]);
+            std::this_thread::sleep_for(1ms);
+        }
+    });
+
+    std::size_t consumed{};
+    std::vector<double> latencies;
+    int frame{};
+    double tick{};
+    auto start = rm::Timer::now();
+    while (rm::Timer::now() - start < 0.3)
+    {
+        if (!latest.pop(frame, tick, 0.1))
+            continue;
+        ++consumed;
+        auto action = deadline.check(tick);
+        deadline.record(action);
+        if (action == rm::FrameAction::Drop)
+            continue;
+        std::this_thread::sleep_for(action == rm::FrameAction::Process ? 3ms : 1ms);
+        latencies.push_back(rm::Timer::now() - tick);
+    }
+    stop = true;
+    camera.join();
+
+    auto stats = deadline.stats();
+    EXPECT_EQ(stats.processed + stats.degraded + stats.dropped, consumed);
+    EXPECT_GT(stats.processed, 0u);
+    EXPECT_GT(stats.degraded, 0u);
+    EXPECT_GT(stats.dropped, 0u);
+    // 处理速度低于帧率，未被处理的旧帧被新帧覆盖，而不是排队
+    EXPECT_GT(latest.overwritten(), 0u);
+    EXPECT_LE(consumed + latest.overwritten(), produced);
+    // 端到端延迟不超过 帧预算 + 完整处理耗时，除个别受调度抖动影响的帧外均应满足；若所有帧排队处理，运行结束时延迟将达到 0.2 s
+    auto late = std::count_if(latencies.begin(), latencies.end(), [&](double t) { return t > budget + full_cost + 0.002; });
+    EXPECT_LT(late, static_cast<long>(latencies.size() / 10));
+    EXPECT_LT(*std::max_element(latencies.begin(), latencies.end()), 0.1);
+}
+
+} // namespace rm_test